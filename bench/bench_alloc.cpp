@@ -0,0 +1,108 @@
+#include "../compiler/cgn/codegen.h"
+#include "../compiler/core/metadata.h"
+#include "../compiler/core/options.h"
+#include "../compiler/lexer/lexer.h"
+#include "../compiler/mir/segment.h"
+#include "../compiler/parser/parser.h"
+#include "../compiler/tree/context.h"
+#include "../compiler/tree/nameres.h"
+#include "../compiler/tree/sema.h"
+#include "../compiler/tree/unit.h"
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace meddle;
+
+static std::atomic<size_t> g_Allocs = 0;
+
+void *operator new(size_t size) {
+    g_Allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+/// Generate a module of \p count structures and functions, so that most of
+/// the frontend's allocations are tree nodes, scopes and types.
+static String generate(unsigned count) {
+    String src;
+    for (unsigned i = 0; i != count; ++i) {
+        String n = std::to_string(i);
+        src += "Box_" + n + " :: { a: i64, b: i32*, c: f64[4] }\n\n";
+        src += "fn_" + n + " :: (x: i64, y: i32*, z: Box_" + n + "*) -> i64 {\n";
+        src += "    mut box: Box_" + n + " = Box_" + n +
+               " { a: x, b: y, c: [1.0, 2.0, 3.0, 4.0] };\n";
+        src += "    mut s: i64 = box.a + x * 2;\n";
+        src += "    until s > 100 { s += cast<i64> *y; }\n";
+        src += "    if z != nil { s -= z.a; } else { s += 1; }\n";
+        src += "    match s { 0 -> ret 1; 1 -> ret 2; _ -> ret s; }\n";
+        src += "}\n\n";
+    }
+
+    return src;
+}
+
+int main(int argc, char **argv) {
+    unsigned count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5000;
+
+    File file = File("bench.mdl", "", "bench.mdl", generate(count));
+    std::printf("building %u structures and functions\n", count);
+
+    Options opts;
+    size_t before = g_Allocs.load();
+    auto start = std::chrono::high_resolution_clock::now();
+
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+    unit->getContext()->sanitate();
+    NameResolution NR = NameResolution(opts, unit);
+    Sema sema = Sema(opts, unit);
+
+    auto frontend = std::chrono::high_resolution_clock::now();
+    size_t frontendAllocs = g_Allocs.load() - before;
+    Arena &arena = unit->getContext()->getArena();
+    size_t objects = arena.getNumObjects();
+    size_t used = arena.getBytesAllocated();
+    size_t reserved = arena.getBytesReserved();
+
+    before = g_Allocs.load();
+    mir::Segment *seg = new mir::Segment(mir::Target(
+        mir::Arch::X86_64, mir::OS::Linux, mir::ABI::SystemV));
+    CGN *cgn = new CGN(opts, unit, seg);
+    delete cgn;
+
+    auto codegen = std::chrono::high_resolution_clock::now();
+    size_t codegenAllocs = g_Allocs.load() - before;
+
+    delete seg;
+    delete unit;
+    auto end = std::chrono::high_resolution_clock::now();
+
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    std::chrono::duration<double, std::milli> frontendTime = frontend - start;
+    std::chrono::duration<double, std::milli> codegenTime = codegen - frontend;
+    std::chrono::duration<double, std::milli> teardownTime = end - codegen;
+    std::printf("  frontend    %10zu allocations %10.2f ms\n", frontendAllocs,
+                frontendTime.count());
+    std::printf("  codegen     %10zu allocations %10.2f ms\n", codegenAllocs,
+                codegenTime.count());
+    std::printf("  teardown    %33.2f ms\n", teardownTime.count());
+    std::printf("  peak rss    %10ld KiB\n", usage.ru_maxrss);
+    std::printf("  arena       %10zu objects, %zu/%zu KiB\n", objects, 
+                used / 1024, reserved / 1024);
+    return 0;
+}
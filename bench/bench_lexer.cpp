@@ -0,0 +1,61 @@
+#include "../compiler/core/metadata.h"
+#include "../compiler/lexer/lexer.h"
+#include "../compiler/lexer/scan.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace meddle;
+
+/// Generate roughly \p size bytes of source with long comment blocks, blank
+/// lines, indentation, long identifiers and string literals.
+static String generate(size_t size) {
+    String src;
+    src.reserve(size + 512);
+
+    for (unsigned i = 0; src.size() < size; ++i) {
+        src += "// " + String(120, 'c') + "\n";
+        src += "// helper number " + std::to_string(i) + " of the module\n\n\n";
+        src += "some_rather_long_function_name_" + std::to_string(i) +
+               " :: (first_parameter: i64, second_parameter: i64) -> i64 {\n";
+        src += "                mut accumulated_value: i64 = first_parameter;\n";
+        src += "                mut message: char[64] = \"the quick brown fox "
+               "jumps over the lazy dog\";\n";
+        src += "\t\t\t\tret accumulated_value + second_parameter * 3;\n";
+        src += "}\n\n";
+    }
+
+    return src;
+}
+
+static double run(const File &file, unsigned iters) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (unsigned i = 0; i != iters; ++i) {
+        Lexer lexer = Lexer(file);
+        if (lexer.unwrap().getTokens().empty())
+            std::abort();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> secs = end - start;
+    return (double(file.contents.size()) * iters) / secs.count() / 1e6;
+}
+
+int main(int argc, char **argv) {
+    size_t size = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16 << 20;
+    unsigned iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5;
+
+    File file = File("bench.mdl", "", "bench.mdl", generate(size));
+    std::printf("lexing %zu bytes x %u\n", file.contents.size(), iters);
+
+    const char *names[] = { "scalar", "sse2", "avx2" };
+    ScanLevel best = getBestScanLevel();
+    for (unsigned L = 0; L <= unsigned(best); ++L) {
+        setScanLevel(ScanLevel(L));
+        run(file, 1);
+        std::printf("  %-6s %8.1f MB/s\n", names[L], run(file, iters));
+    }
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "../compiler/core/metadata.h"
+#include "../compiler/core/options.h"
+#include "../compiler/lexer/lexer.h"
+#include "../compiler/parser/parser.h"
+#include "../compiler/tree/decl.h"
+#include "../compiler/tree/unit.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace meddle;
+
+/// Generate a library of \p count functions with bodies of a realistic size,
+/// of which an importer would only use a few.
+static String generate(unsigned count) {
+    String src;
+    for (unsigned i = 0; i != count; ++i) {
+        String n = std::to_string(i);
+        src += "$public util_" + n + " :: (a: i64, b: i64) -> i64 {\n";
+        src += "    mut sum: i64 = 0;\n";
+        src += "    mut i: i64 = a;\n";
+        src += "    until i >= b {\n";
+        src += "        if i % 3 == 0 { sum += i * " + n + "; }\n";
+        src += "        else if i % 5 == 0 { sum -= (i << 2) / (b - a + 1); }\n";
+        src += "        else { sum = sum ^ (i & 255) | " + n + "; }\n";
+        src += "        i += 1;\n";
+        src += "    }\n";
+        src += "    mut buf: i64[8] = [ a, b, sum, 1, 2, 3, 4, 5 ];\n";
+        src += "    ret sum + buf[2] - cast<i64> (a == b);\n";
+        src += "}\n\n";
+    }
+
+    return src;
+}
+
+/// Parse \p file, then the bodies of \p used of its functions.
+///
+/// \returns The time taken in milliseconds.
+static double run(const File &file, bool lazy, unsigned used) {
+    Options opts;
+    opts.LazyBodies = lazy;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer, &opts);
+    TranslationUnit *unit = parser.get();
+
+    const std::vector<Decl *> &decls = unit->getDecls();
+    for (unsigned i = 0; i != used && i != decls.size(); ++i)
+        if (!cast<FunctionDecl>(decls[i])->getBody())
+            std::abort();
+
+    auto end = std::chrono::high_resolution_clock::now();
+    delete unit;
+
+    std::chrono::duration<double, std::milli> ms = end - start;
+    return ms.count();
+}
+
+int main(int argc, char **argv) {
+    unsigned count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    unsigned used = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10;
+
+    File file = File("bench.mdl", "", "bench.mdl", generate(count));
+    std::printf("parsing %u functions (%zu bytes), using %u\n", count,
+                file.contents.size(), used);
+
+    run(file, false, used);
+    std::printf("  eager %8.2f ms\n", run(file, false, used));
+    std::printf("  lazy  %8.2f ms\n", run(file, true, used));
+    std::printf("  lazy  %8.2f ms (every body)\n", run(file, true, count));
+    return 0;
+}
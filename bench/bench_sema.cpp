@@ -0,0 +1,75 @@
+#include "../compiler/core/metadata.h"
+#include "../compiler/core/options.h"
+#include "../compiler/lexer/lexer.h"
+#include "../compiler/parser/parser.h"
+#include "../compiler/tree/context.h"
+#include "../compiler/tree/nameres.h"
+#include "../compiler/tree/sema.h"
+#include "../compiler/tree/unit.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace meddle;
+
+/// Generate a module of \p count functions which mix every primitive type
+/// with pointers, arrays, casts and comparisons, so that Sema spends most of
+/// its time querying types.
+static String generate(unsigned count) {
+    String src;
+    for (unsigned i = 0; i != count; ++i) {
+        String n = std::to_string(i);
+        src += "fn_" + n + " :: (a: i64, b: u32, c: f64, p: i64*) -> i64 {\n";
+        src += "    mut s: i64 = a;\n";
+        src += "    mut t: u32 = b;\n";
+        src += "    mut f: f64 = c;\n";
+        src += "    mut g: f32 = cast<f32> c;\n";
+        src += "    mut h: u8 = cast<u8> a;\n";
+        src += "    mut k: i16 = cast<i16> t;\n";
+        src += "    mut q: i64* = p;\n";
+        src += "    mut msg: char[6] = \"hello\";\n";
+        src += "    fix ok: bool = q != nil;\n";
+        src += "    s += cast<i64> t;\n";
+        src += "    f *= cast<f64> s;\n";
+        src += "    g += cast<f32> h;\n";
+        src += "    if s < 10 { s -= cast<i64> k; } else { s += 1; }\n";
+        src += "    until s > 100 { s += cast<i64> cast<u8> t; t <<= 1; }\n";
+        src += "    if f >= 1.0 { f /= 2.0; }\n";
+        src += "    ret s + (cast<i64> f) + (cast<i64> g) + sizeof<i32>;\n";
+        src += "}\n\n";
+    }
+
+    return src;
+}
+
+int main(int argc, char **argv) {
+    unsigned count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5000;
+    unsigned iters = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5;
+
+    File file = File("bench.mdl", "", "bench.mdl", generate(count));
+    std::printf("analyzing %u functions x %u\n", count, iters);
+
+    Options opts;
+    double best = 0;
+    for (unsigned i = 0; i != iters; ++i) {
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer);
+        TranslationUnit *unit = parser.get();
+        unit->getContext()->sanitate();
+        NameResolution NR = NameResolution(opts, unit);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        Sema sema = Sema(opts, unit);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<double, std::milli> ms = end - start;
+        if (i == 0 || ms.count() < best)
+            best = ms.count();
+
+        delete unit;
+    }
+
+    std::printf("  sema   %8.2f ms\n", best);
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "../compiler/core/metadata.h"
+#include "../compiler/core/options.h"
+#include "../compiler/lexer/lexer.h"
+#include "../compiler/parser/parser.h"
+#include "../compiler/tree/context.h"
+#include "../compiler/tree/decl.h"
+#include "../compiler/tree/nameres.h"
+#include "../compiler/tree/sema.h"
+#include "../compiler/tree/unit.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace meddle;
+
+static const char *Elements[] = { "i8", "i16", "i32", "i64", "u8", "u16",
+                                  "u32", "u64", "f32", "f64" };
+
+/// \returns The type argument of the \p i-th specialization.
+static String getArg(unsigned i) {
+    return String(Elements[i % 10]) + "[" + std::to_string(i / 10 + 1) + "]";
+}
+
+/// Generate a module in which each of \p count functions specializes the same
+/// struct and function templates with a distinct array type, and references
+/// every specialization a few times, so that resolution spends most of its
+/// time looking up specializations.
+static String generate(unsigned count) {
+    String src = "box<T> { x: T*, y: T }\n"
+                 "get<T> :: (x: T) -> T { ret x; }\n\n";
+    for (unsigned i = 0; i != count; ++i) {
+        String n = std::to_string(i);
+        String arg = getArg(i);
+        src += "fn_" + n + " :: (p: box<" + arg + ">*) -> i64 {\n";
+        src += "    mut a: box<" + arg + ">* = p;\n";
+        src += "    mut b: box<" + arg + ">* = get<box<" + arg + ">*>(a);\n";
+        src += "    mut c: " + arg + "* = get<" + arg + "*>(b.x);\n";
+        src += "    ret 0;\n";
+        src += "}\n\n";
+    }
+
+    return src;
+}
+
+int main(int argc, char **argv) {
+    unsigned count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000;
+    unsigned jobs = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4;
+
+    File file = File("bench.mdl", "", "bench.mdl", generate(count));
+    std::printf("specializing %u argument types\n", count);
+
+    Options opts;
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    unit->getContext()->sanitate();
+    NameResolution NR = NameResolution(opts, unit);
+    Sema sema = Sema(opts, unit);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double, std::milli> ms = end - start;
+    std::printf("  analysis %8.2f ms\n", ms.count());
+
+    // Look every specialization up again from several threads at once, with
+    // argument types rebuilt in the context of the unit.
+    Context *ctx = unit->getContext();
+    Type *elements[] = { ctx->getI8Type(), ctx->getI16Type(), 
+                         ctx->getI32Type(), ctx->getI64Type(), 
+                         ctx->getU8Type(), ctx->getU16Type(), 
+                         ctx->getU32Type(), ctx->getU64Type(), 
+                         ctx->getF32Type(), ctx->getF64Type() };
+
+    auto *box = cast<StructDecl>(unit->getDecls().at(0));
+    std::vector<std::vector<Type *>> args;
+    args.reserve(count);
+    for (unsigned i = 0; i != count; ++i)
+        args.push_back({ ArrayType::get(ctx, elements[i % 10], i / 10 + 1) });
+
+    start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    std::atomic<unsigned> missing = 0;
+    for (unsigned j = 0; j != jobs; ++j) {
+        threads.emplace_back([&, j] {
+            unsigned misses = 0;
+            for (unsigned r = 0; r != 16; ++r)
+                for (unsigned i = j; i < args.size(); i += jobs)
+                    misses += box->fetchSpecialization(args[i]) == nullptr;
+
+            missing += misses;
+        });
+    }
+
+    for (auto &T : threads)
+        T.join();
+
+    end = std::chrono::high_resolution_clock::now();
+    ms = end - start;
+    std::printf("  lookup   %8.2f ms (%zu x 16 on %u threads)\n", ms.count(),
+                args.size(), jobs);
+
+    if (missing)
+        std::printf("  %u lookups missed\n", missing.load());
+
+    delete unit;
+    return missing ? 1 : 0;
+}
@@ -17,18 +17,26 @@ CGN::CGN(const Options &opts, TranslationUnit *U, mir::Segment *S)
     U->accept(this);
 }
 
-String CGN::mangle_name(NamedDecl *D) {
+const String &CGN::mangle_name(NamedDecl *D) {
 	auto it = m_Mangled.find(D);
 	if (it != m_Mangled.end())
-		return it->second;
+		return it->second.str();
 
 	String mangled = "";
 	if (D->hasPublicRune())
 		mangled = D->getPUnit()->getID() + ".";
 
-	if (auto *F = dynamic_cast<FunctionDecl *>(D)) {
-		if (F->hasParent()) {
-			mangled += F->getParent()->getName() + "." + F->getName();
+	// Specializations are named by the qualified names of their arguments,
+	// as the private types of different units may share a name, and their
+	// specializations all live in the unit of the template.
+	if (auto *F = dyn_cast<FunctionDecl>(D)) {
+		if (auto *spec = dyn_cast<FunctionTemplateSpecializationDecl>(F)) {
+			mangled += spec->getQualifiedName();
+		} else if (F->hasParent()) {
+			auto *parent = dyn_cast<StructTemplateSpecializationDecl>(
+				F->getParent());
+			mangled += (parent ? parent->getQualifiedName() : 
+				F->getParent()->getName()) + "." + F->getName();
 		} else {
 			mangled += F->getName();
 		}
@@ -36,8 +44,9 @@ String CGN::mangle_name(NamedDecl *D) {
 		mangled += D->getName();
 	}
 
-	m_Mangled[D] = mangled;
-	return mangled;
+	Ident ident = Ident::get(mangled);
+	m_Mangled[D] = ident;
+	return ident.str();
 }
 
 mir::Value *CGN::inject_cmp(mir::Value *V) {
@@ -74,36 +83,37 @@ mir::Value *CGN::inject_cmp(mir::Value *V) {
 mir::Type *CGN::cgn_type(Type *T) {
     assert(T && "Cannot generate from a null type.");
 
-	if (auto *PT = dynamic_cast<PrimitiveType *>(T)) {
-		switch (PT->getKind()) {
-		case PrimitiveType::Kind::Void:
-			return m_Builder.get_void_ty();
-		case PrimitiveType::Kind::Bool:
-			return m_Builder.get_i1_ty();
-		case PrimitiveType::Kind::Char:
-		case PrimitiveType::Kind::Int8:
-		case PrimitiveType::Kind::UInt8:
-			return m_Builder.get_i8_ty();
-		case PrimitiveType::Kind::Int16:
-		case PrimitiveType::Kind::UInt16:
-			return m_Builder.get_i16_ty();
-		case PrimitiveType::Kind::Int32:
-		case PrimitiveType::Kind::UInt32:
-			return m_Builder.get_i32_ty();
-		case PrimitiveType::Kind::Int64:
-		case PrimitiveType::Kind::UInt64:
-			return m_Builder.get_i64_ty();
-		case PrimitiveType::Kind::Float32:
-			return m_Builder.get_f32_ty();
-		case PrimitiveType::Kind::Float64:
-			return m_Builder.get_f64_ty();
-		}
-	} else if (auto *defer = dynamic_cast<DeferredType *>(T)) {
-		return cgn_type(defer->getUnderlying());
-	} else if (auto *arr = dynamic_cast<ArrayType *>(T)) {
+	switch (T->getTypeKind()) {
+	case TypeKind::Void:
+		return m_Builder.get_void_ty();
+	case TypeKind::Bool:
+		return m_Builder.get_i1_ty();
+	case TypeKind::Char:
+	case TypeKind::Int8:
+	case TypeKind::UInt8:
+		return m_Builder.get_i8_ty();
+	case TypeKind::Int16:
+	case TypeKind::UInt16:
+		return m_Builder.get_i16_ty();
+	case TypeKind::Int32:
+	case TypeKind::UInt32:
+		return m_Builder.get_i32_ty();
+	case TypeKind::Int64:
+	case TypeKind::UInt64:
+		return m_Builder.get_i64_ty();
+	case TypeKind::Float32:
+		return m_Builder.get_f32_ty();
+	case TypeKind::Float64:
+		return m_Builder.get_f64_ty();
+	case TypeKind::Deferred:
+		return cgn_type(cast<DeferredType>(T)->getUnderlying());
+	case TypeKind::Array: {
+		auto *arr = cast<ArrayType>(T);
 		return mir::ArrayType::get(m_Segment, cgn_type(arr->getElement()), 
 			arr->getSize());
-	} else if (auto *fty = dynamic_cast<FunctionType *>(T)) {
+	}
+	case TypeKind::Function: {
+		auto *fty = cast<FunctionType>(T);
 		mir::Type *retTy = nullptr;
 		std::vector<mir::Type *> params;
 		params.reserve(fty->getNumParams());
@@ -121,29 +131,31 @@ mir::Type *CGN::cgn_type(Type *T) {
 		}
 
 		return mir::FunctionType::get(m_Segment, params, retTy);
-	} else if (auto *PT = dynamic_cast<PointerType *>(T)) {
-		return mir::PointerType::get(m_Segment, cgn_type(PT->getPointee()));
-	} else if (auto *ET = dynamic_cast<EnumType *>(T)) {
-		return cgn_type(ET->getUnderlying());
-	} else if (auto *ST = dynamic_cast<StructType *>(T)) {
-		mir::StructType *mirTy = mir::StructType::get(m_Segment, ST->getName());
-		assert(mirTy && "Struct type not lowered.");
-		return mirTy;
-	} else if (auto *param = dynamic_cast<TemplateParamType *>(T)) {
+	}
+	case TypeKind::Pointer:
+		return mir::PointerType::get(m_Segment, 
+			cgn_type(cast<PointerType>(T)->getPointee()));
+	case TypeKind::Enum:
+		return cgn_type(cast<EnumType>(T)->getUnderlying());
+	case TypeKind::Struct:
+	case TypeKind::TemplateStruct: {
+		auto it = m_Structs.find(cast<StructType>(T));
+		if (it != m_Structs.end())
+			return it->second;
+
+		return declare_struct(cast<StructType>(T));
+	}
+	case TypeKind::TemplateParam: {
 		assert(m_SubstEnv && "Substitution environment is null.");
-		Type *conc = m_SubstEnv->substType(m_Unit->getContext(), param);
+		Type *conc = m_SubstEnv->substType(m_Unit->getContext(), 
+			cast<TemplateParamType>(T));
 		assert(conc && "Substitution type is null.");
 		return cgn_type(conc);
-	} else if (auto *dep = dynamic_cast<DependentTemplateStructType *>(T)) {
-		std::vector<Type *> nonDependents;
-		nonDependents.reserve(dep->getArgs().size());
-
-		for (auto &arg : dep->getArgs())
-			nonDependents.push_back(m_SubstEnv->substType(
-				m_Unit->getContext(), arg));
-
-		auto *spec = dep->getTemplateDecl()->fetchSpecialization(nonDependents);
-		return cgn_type(spec->getDefinedType());
+	}
+	case TypeKind::DependentTemplateStruct: {
+		assert(m_SubstEnv && "Substitution environment is null.");
+		return cgn_type(m_SubstEnv->substType(m_Unit->getContext(), T));
+	}
 	}
 
 	assert(false && "Unable to generate a type.");
@@ -164,17 +176,51 @@ CGN::TypeClass CGN::type_class(Type *T) const {
 		return TypeClass::Unknown;
 }
 
+mir::StructType *CGN::declare_struct(StructType *T) {
+	// Struct types are lowered into a segment on their first use, as those
+	// of another unit, i.e. the type argument of a specialization defined
+	// here, are never visited by this unit.
+	[[maybe_unused]] bool inserted = m_Lowering.insert(T).second;
+	assert(inserted && "Recursive struct types are not supported.");
+
+	std::vector<mir::Type *> memberTys;
+	memberTys.reserve(T->getNumFields());
+	for (auto &field : T->getFields())
+		memberTys.push_back(cgn_type(field));
+
+	m_Lowering.erase(T);
+
+	// Types of other units are named after their unit, so that the private
+	// types of two units that share a name stay apart in this segment.
+	String name = T->getQualifiedName();
+	if (T->getDecl()->getPUnit() == m_Unit)
+		name = name.substr(m_Unit->getID().size() + 1);
+
+	mir::StructType *mirTy = mir::StructType::get(m_Segment, name);
+	if (!mirTy)
+		mirTy = mir::StructType::create(m_Segment, name, memberTys);
+
+	m_Structs[T] = mirTy;
+	return mirTy;
+}
+
 void CGN::declare_function(FunctionDecl *FD) {
 	// Lowering of function types have special behavior: aggregate parameters
 	// are wrapped in pointers and return types are converted to void.
 	mir::FunctionType *FT = static_cast<mir::FunctionType *>
 		(cgn_type(FD->getType()));
 
+	// Specializations of a template loaded from an interface are defined by
+	// every unit that uses them, so each definition stays private.
+	bool is_copy = isa<FunctionTemplateSpecializationDecl>(FD) && 
+		FD->getPUnit()->isInterface();
+
 	mir::Function::Linkage L = mir::Function::Linkage::Internal;
-	if (FD->hasPublicRune())
+	if (FD->hasPublicRune() && !is_copy)
 		L = mir::Function::Linkage::External;
 
-	mir::Function *FN = new mir::Function(mangle_name(FD), FT, L, m_Segment, {});
+	mir::Function *FN = m_Segment->create<mir::Function>(mangle_name(FD), FT, L, m_Segment, 
+		std::vector<mir::Argument *>());
 
 	std::vector<mir::Argument *> args;
 	args.reserve(FD->getNumParams());
@@ -186,13 +232,16 @@ void CGN::declare_function(FunctionDecl *FD) {
 
 		// Aggregate return types are passed via pointer with the `ARet`
 		// attribute on the first parameter, which we implicitly inject here.
-		mir::Argument *aret = new mir::Argument(
-			m_Opts.NamedMIR ? "aret.ptr" : m_Segment->get_ssa(),
+		mir::Argument *aret = m_Segment->create<mir::Argument>(
+			m_Opts.NamedMIR ? "aret.ptr" : "",
 			mir::PointerType::get(m_Segment, cgn_type(FD->getReturnType())),
 			FN,
 			0,
 			nullptr // No slot, rets should copy themselves to this argument.
 		);
+		if (!aret->is_named())
+			aret->set_number(m_Segment->get_ssa());
+
 		aret->add_attribute(mir::Attribute::ARet);
 		args.push_back(aret);
 	}
@@ -205,7 +254,7 @@ void CGN::declare_function(FunctionDecl *FD) {
 
 		mir::Type *ty = FT->get_param_type(i);
 		mir::Slot *slot = nullptr;
-		mir::Argument *arg = new mir::Argument(P->getName(), ty, FN, 
+		mir::Argument *arg = m_Segment->create<mir::Argument>(P->getName(), ty, FN, 
 			args.size(), slot);
 
 		if (type_class(paramTy) == TypeClass::Aggregate) {
@@ -237,7 +286,7 @@ void CGN::define_function(FunctionDecl *FD, FunctionDecl *tmpl) {
 		return;
 
 	// Create a new entry block for the function.
-	mir::BasicBlock *entry = new mir::BasicBlock(
+	mir::BasicBlock *entry = m_Segment->create<mir::BasicBlock>(
 		m_Opts.NamedMIR ? "entry" : "", FN);
 	m_Builder.set_insert(entry);
 
@@ -254,7 +303,7 @@ void CGN::define_function(FunctionDecl *FD, FunctionDecl *tmpl) {
 			mir::Slot *slot = arg->get_slot();
 			assert(slot && "Slot does not exist for argument with AArg attribute.");
 
-			mir::DataLayout DL = m_Segment->get_data_layout();
+			const mir::DataLayout &DL = m_Segment->get_data_layout();
 			mir::PointerType *PT = static_cast<mir::PointerType *>(arg->get_type());
 			mir::Type *ty = PT->get_pointee();
 
@@ -311,10 +360,70 @@ void CGN::visit(TranslationUnit *unit) {
 	m_Phase = Phase::Define;
 	for (auto &D : unit->getDecls())
 		D->accept(this);
+
+	define_pending();
+}
+
+mir::Function *CGN::get_function(FunctionDecl *FD) {
+	if (mir::Function *FN = m_Segment->get_function(mangle_name(FD)))
+		return FN;
+
+	if (auto *spec = dyn_cast<FunctionTemplateSpecializationDecl>(FD)) {
+		request_specialization(spec);
+	} else if (FD->hasParent() && 
+	  isa<StructTemplateSpecializationDecl>(FD->getParent())) {
+		declare_function(FD);
+	} else {
+		return nullptr;
+	}
+
+	return m_Segment->get_function(mangle_name(FD));
+}
+
+void CGN::request_specialization(FunctionTemplateSpecializationDecl *spec) {
+	push_subst_env(spec->m_Mapping);
+	declare_function(spec);
+	pop_subst_env();
+
+	// Specializations of imported templates are left to the unit that owns
+	// the template, where name resolution marked them as external, so that
+	// the program has a single definition of each. An interface is never
+	// lowered, so its specializations are defined where they are used.
+	if ((spec->getPUnit() == m_Unit && m_Opts.LazySpecs) || 
+	  spec->getPUnit()->isInterface())
+		m_Pending.push_back(spec);
+}
+
+void CGN::define_pending() {
+	// Defining a specialization may refer to new ones, which are queued in
+	// turn, so this walks the transitive closure of the references made by
+	// the non-template functions of the unit.
+	while (!m_Pending.empty()) {
+		FunctionTemplateSpecializationDecl *spec = m_Pending.back();
+		m_Pending.pop_back();
+
+		push_subst_env(spec->m_Mapping);
+		define_function(spec, spec->getTemplateFunction());
+		pop_subst_env();
+	}
 }
 
 void CGN::visit(FunctionDecl *decl) {
-	if (decl->isTemplate()) {
+	if (decl->isTemplate() && decl->getPUnit() != m_Unit) {
+		// Specializations of an imported template are defined by the unit
+		// that owns it, and only declared here once they are called.
+		return;
+	} else if (decl->isTemplate() && m_Opts.LazySpecs) {
+		// Only specializations referred to by other units are known to be
+		// needed up front. The rest are requested as calls to them are 
+		// lowered.
+		if (m_Phase == Phase::Define) {
+			for (auto &spec : decl->m_TemplateSpecs)
+				if (spec->isExternal() && 
+				  !m_Segment->get_function(mangle_name(spec)))
+					request_specialization(spec);
+		}
+	} else if (decl->isTemplate()) {
 		for (auto &spec : decl->m_TemplateSpecs)
 			spec->accept(this);
 	} else if (m_Phase == Phase::Define) {
@@ -326,7 +435,7 @@ void CGN::visit(FunctionDecl *decl) {
 
 void CGN::visit(VarDecl *decl) {
 	mir::Type *ty = cgn_type(decl->getType());
-	mir::DataLayout DL = m_Segment->get_data_layout();
+	const mir::DataLayout &DL = m_Segment->get_data_layout();
 
 	if (decl->isGlobal() && m_Phase == Phase::Declare) {
 		mir::Data::Linkage L = mir::Data::Linkage::Internal;
@@ -336,7 +445,7 @@ void CGN::visit(VarDecl *decl) {
 		assert(m_Value && "Variable initializer does not produce a value.");
 		mir::Constant *C = static_cast<mir::Constant *>(m_Value);
 
-		new mir::Data(
+		m_Segment->create<mir::Data>(
 			mangle_name(decl), 
 			ty, 
 			L, 
@@ -396,21 +505,19 @@ void CGN::visit(VarDecl *decl) {
 
 void CGN::visit(StructDecl *decl) {
 	if (decl->isTemplate()) {
+		// Specialized types of imported templates, or of any template when
+		// specializations are lazy, are lowered on their first use.
+		if (decl->getPUnit() != m_Unit || m_Opts.LazySpecs)
+			return;
+
 		for (auto &spec : decl->m_TemplateSpecs)
 			spec->accept(this);
 
 		return;
 	}
 
-	if (m_Phase == Phase::Declare) {
-		std::vector<mir::Type *> memberTys;
-		memberTys.reserve(decl->getNumFields());
-
-		for (auto &field : decl->m_Fields)
-			memberTys.push_back(cgn_type(field->getType()));
-
-		mir::StructType::create(m_Segment, decl->getName(), memberTys);
-	}
+	if (m_Phase == Phase::Declare)
+		cgn_type(decl->getDefinedType());
 	
 	for (auto &F : decl->getFunctions())
 		F->accept(this);
@@ -434,15 +541,8 @@ void CGN::visit(FunctionTemplateSpecializationDecl *decl) {
 void CGN::visit(StructTemplateSpecializationDecl *decl) {
 	push_subst_env(decl->m_Mapping);
 
-	if (m_Phase == Phase::Declare) {
-		std::vector<mir::Type *> memberTys;
-		memberTys.reserve(decl->getNumFields());
-
-		for (auto &field : decl->m_Fields)
-			memberTys.push_back(cgn_type(field->getType()));
-
-		mir::StructType::create(m_Segment, decl->getName(), memberTys);
-	}
+	if (m_Phase == Phase::Declare)
+		cgn_type(decl->getDefinedType());
 
 	for (auto &fn : decl->m_Functions)
 		fn->accept(this);
@@ -478,14 +578,14 @@ void CGN::visit(IfStmt *stmt) {
 	assert(cond && "'if' condition does not produce a value.");
 	cond = inject_cmp(cond);
 
-	mir::BasicBlock *thenBB = new mir::BasicBlock( 
+	mir::BasicBlock *thenBB = m_Segment->create<mir::BasicBlock>( 
 		m_Opts.NamedMIR ? "if.then" : "", m_Function);
-	mir::BasicBlock *mergeBB = new mir::BasicBlock(
+	mir::BasicBlock *mergeBB = m_Segment->create<mir::BasicBlock>(
 		m_Opts.NamedMIR ? "if.merge" : "");
 	mir::BasicBlock *elseBB = nullptr;
 
 	if (stmt->hasElse()) {
-		elseBB = new mir::BasicBlock(m_Opts.NamedMIR ? "if.else" : "");
+		elseBB = m_Segment->create<mir::BasicBlock>(m_Opts.NamedMIR ? "if.else" : "");
 		m_Builder.build_brif(cond, thenBB, elseBB);
 	} else {
 		m_Builder.build_brif(cond, thenBB, mergeBB);
@@ -508,7 +608,7 @@ void CGN::visit(IfStmt *stmt) {
 		m_Function->append(mergeBB);
 		m_Builder.set_insert(mergeBB);
 	} else {
-		delete mergeBB;
+		m_Segment->destroy(mergeBB);
 	}
 }
 
@@ -520,11 +620,11 @@ void CGN::visit(MatchStmt *stmt) {
     assert(matchV && "'match' expression does not produce a value.");
 
     // Create a merge block, without inserting it since it should come last.
-    mir::BasicBlock *mergeBB = new mir::BasicBlock(
+    mir::BasicBlock *mergeBB = m_Segment->create<mir::BasicBlock>(
 		m_Opts.NamedMIR ? "match.merge" : "");
     mir::BasicBlock *defBB = nullptr;
     if (stmt->getDefault())
-        defBB = new mir::BasicBlock(m_Opts.NamedMIR ? "match.def" : "");
+        defBB = m_Segment->create<mir::BasicBlock>(m_Opts.NamedMIR ? "match.def" : "");
 
     // Create a "chain" block for every case in the statement.
     //
@@ -533,7 +633,7 @@ void CGN::visit(MatchStmt *stmt) {
 	const std::vector<CaseStmt *> cases = stmt->getCases();
     std::vector<mir::BasicBlock *> chains;
     for (auto &C : cases)
-        chains.push_back(new mir::BasicBlock(m_Opts.NamedMIR ? "match.chain" : ""));
+        chains.push_back(m_Segment->create<mir::BasicBlock>(m_Opts.NamedMIR ? "match.chain" : ""));
 
     // Begin at the first case.
     assert(chains.size() > 0 && "'match' statement has no cases.");
@@ -577,7 +677,7 @@ void CGN::visit(MatchStmt *stmt) {
 			break;
 		}
 
-        mir::BasicBlock *body = new mir::BasicBlock( 
+        mir::BasicBlock *body = m_Segment->create<mir::BasicBlock>( 
 			m_Opts.NamedMIR ? "match.case" : "", m_Function);
 
         // Branch to the case block if the comparison succeeded, otherwise
@@ -617,7 +717,7 @@ void CGN::visit(MatchStmt *stmt) {
         m_Function->append(mergeBB);
 		m_Builder.set_insert(mergeBB);
     } else
-		delete mergeBB;
+		m_Segment->destroy(mergeBB);
 }
 
 void CGN::visit(RetStmt *stmt) {
@@ -627,7 +727,7 @@ void CGN::visit(RetStmt *stmt) {
 	}
 
 	mir::Type *ty = cgn_type(stmt->getExpr()->getType());
-	mir::DataLayout DL = m_Segment->get_data_layout();
+	const mir::DataLayout &DL = m_Segment->get_data_layout();
 
 	if (stmt->getExpr()->isAggregateInit()) {
 		assert(m_Function->hasARetAttribute() && 
@@ -661,11 +761,11 @@ void CGN::visit(RetStmt *stmt) {
 }
 
 void CGN::visit(UntilStmt *stmt) {
-	mir::BasicBlock *condBB = new mir::BasicBlock( 
+	mir::BasicBlock *condBB = m_Segment->create<mir::BasicBlock>( 
 		m_Opts.NamedMIR ? "until.cond" : "", m_Function);
-	mir::BasicBlock *bodyBB = new mir::BasicBlock(
+	mir::BasicBlock *bodyBB = m_Segment->create<mir::BasicBlock>(
 		m_Opts.NamedMIR ? "until.body" : "");
-	mir::BasicBlock *mergeBB = new mir::BasicBlock(
+	mir::BasicBlock *mergeBB = m_Segment->create<mir::BasicBlock>(
 		m_Opts.NamedMIR ? "until.merge" : "");
 	mir::BasicBlock *oldCond = m_Cond;
 	mir::BasicBlock *oldMerge = m_Merge;
@@ -724,10 +824,10 @@ void CGN::visit(CharLiteral *expr) {
 }
 
 void CGN::visit(StringLiteral *expr) {
-	mir::ConstantString *STR = new mir::ConstantString(
+	mir::ConstantString *STR = m_Segment->create<mir::ConstantString>(
 		cgn_type(expr->getType()), expr->getValue());
 
-	m_Value = new mir::Data(
+	m_Value = m_Segment->create<mir::Data>(
 		"__const.str", // name
 		mir::PointerType::get(m_Segment, STR->get_type()), // data pointer type 
 		mir::Data::Linkage::Internal, // linkage 
@@ -876,7 +976,7 @@ void CGN::visit(BinaryExpr *expr) {
 }
 
 void CGN::visit(CallExpr *expr) {
-	mir::Function *callee = m_Segment->get_function(mangle_name(expr->getCallee()));
+	mir::Function *callee = get_function(expr->getCallee());
 	assert(callee && "Callee does not exist.");
 
 	std::vector<mir::Value *> args;
@@ -896,7 +996,7 @@ void CGN::visit(CallExpr *expr) {
 			// Aggregate arguments must be copied before being passed to the
 			// callee, since the caller is always responsible for cloning the
 			// argument, regardless if its to be spilled in the callee.
-			mir::DataLayout DL = m_Segment->get_data_layout();
+			const mir::DataLayout &DL = m_Segment->get_data_layout();
 			mir::Type *aargTy = cgn_type(arg->getType());
 			mir::Slot *aargSlot = m_Builder.build_slot(aargTy, 
 				m_Opts.NamedMIR ? "aarg.tmp" : "");
@@ -961,7 +1061,7 @@ void CGN::visit(CastExpr *expr) {
 	mir::Type *srcTyIR = cgn_type(srcTy);
 	mir::Type *destTyIR = cgn_type(destTy);
 	mir::Value *V = m_Value;
-	mir::DataLayout DL = m_Segment->get_data_layout();
+	const mir::DataLayout &DL = m_Segment->get_data_layout();
 	String name;
 
     if (srcTyIR == destTyIR) {
@@ -1060,7 +1160,7 @@ void CGN::visit(CastExpr *expr) {
 }
 
 void CGN::visit(MethodCallExpr *expr) {
-	mir::Function *callee = m_Segment->get_function(mangle_name(expr->getCallee()));
+	mir::Function *callee = get_function(expr->getCallee());
 	assert(callee && "Callee does not exist.");
 
 	std::vector<mir::Value *> args;
@@ -1091,7 +1191,7 @@ void CGN::visit(MethodCallExpr *expr) {
 			// Aggregate arguments must be copied before being passed to the
 			// callee, since the caller is always responsible for cloning the
 			// argument, regardless if its to be spilled in the callee.
-			mir::DataLayout DL = m_Segment->get_data_layout();
+			const mir::DataLayout &DL = m_Segment->get_data_layout();
 			mir::Type *aargTy = cgn_type(arg->getType());
 			mir::Slot *aargSlot = m_Builder.build_slot(aargTy, 
 				m_Opts.NamedMIR ? "aarg.tmp" : "");
@@ -1137,7 +1237,7 @@ void CGN::visit(ParenExpr *expr) {
 void CGN::visit(RefExpr *expr) {
 	NamedDecl *ref = expr->getRef();
 
-	if (auto *field = dynamic_cast<FieldDecl *>(ref)) {
+	if (auto *field = dyn_cast<FieldDecl>(ref)) {
 		assert(m_Self && "Reference to field decl, but no self set.");
 
 		unsigned field_idx = field->getIndex();
@@ -1161,7 +1261,7 @@ void CGN::visit(RefExpr *expr) {
 			m_Value = m_Builder.build_load(field_ty, field_ptr);
 
 		return;
-	} else if (auto *var = dynamic_cast<EnumVariantDecl *>(ref)) {
+	} else if (auto *var = dyn_cast<EnumVariantDecl>(ref)) {
 		m_Value = mir::ConstantInt::get(m_Segment, cgn_type(var->getType()), var->getValue());
 		return;
 	}
@@ -1178,7 +1278,7 @@ void CGN::visit(RefExpr *expr) {
 }
 
 void CGN::visit(SizeofExpr *expr) {
-	mir::DataLayout DL = m_Segment->get_data_layout();
+	const mir::DataLayout &DL = m_Segment->get_data_layout();
 	mir::Type *T = cgn_type(expr->getTarget());
 	
 	m_Value = mir::ConstantInt::get(m_Segment, cgn_type(expr->getType()), 
@@ -1217,7 +1317,7 @@ void CGN::visit(SubscriptExpr *expr) {
 void CGN::visit(TypeSpecExpr *expr) {
 	RefExpr *ref = expr->getExpr();
 
-	if (auto *EVD = dynamic_cast<EnumVariantDecl *>(ref->getRef())) {
+	if (auto *EVD = dyn_cast<EnumVariantDecl>(ref->getRef())) {
 		m_Value = mir::ConstantInt::get(m_Segment, cgn_type(EVD->getType()), 
 			EVD->getValue());
 	} else {
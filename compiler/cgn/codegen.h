@@ -14,6 +14,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace meddle {
 
@@ -45,9 +46,19 @@ class CGN final : public Visitor {
     mir::Slot *m_Self = nullptr;
     mir::BasicBlock *m_Merge = nullptr;
     mir::BasicBlock *m_Cond = nullptr;
-    std::unordered_map<NamedDecl *, String> m_Mangled = {};
+    std::unordered_map<NamedDecl *, Ident> m_Mangled = {};
     SubstEnv *m_SubstEnv = nullptr;
 
+    /// Specializations of templates in this unit that lowered code refers to,
+    /// but which are not defined yet. Only used with lazy specialization.
+    std::vector<FunctionTemplateSpecializationDecl *> m_Pending = {};
+
+    /// Struct types lowered into the segment of this unit.
+    std::unordered_map<StructType *, mir::StructType *> m_Structs = {};
+
+    /// Struct types whose members are being lowered.
+    std::unordered_set<StructType *> m_Lowering = {};
+
     void push_subst_env(const std::unordered_map<TemplateParamType *, Type *> &map)
     { m_SubstEnv = new SubstEnv(map, m_SubstEnv); }
 
@@ -58,16 +69,31 @@ class CGN final : public Visitor {
         delete old;
     }
 
-    String mangle_name(NamedDecl *D);
+    const String &mangle_name(NamedDecl *D);
 
     mir::Type *cgn_type(Type *T);
     TypeClass type_class(Type *T) const;
 
     mir::Value *inject_cmp(mir::Value *V);
 
+    /// Lower struct type \p T into the segment of this unit, named by its
+    /// qualified name unless this unit declares it.
+    mir::StructType *declare_struct(StructType *T);
+
     void declare_function(FunctionDecl *FD);
     void define_function(FunctionDecl *FD, FunctionDecl *tmpl = nullptr);
 
+    /// \returns The lowered function for \p FD. With lazy specialization, a
+    /// specialization is declared here on its first reference, and queued to
+    /// be defined if its template belongs to this unit.
+    mir::Function *get_function(FunctionDecl *FD);
+
+    /// Declare \p spec, and queue it to be defined if this unit owns it.
+    void request_specialization(FunctionTemplateSpecializationDecl *spec);
+
+    /// Define queued specializations until none are left.
+    void define_pending();
+
     void cgn_aggregate_init(mir::Value *base, Expr *expr, Type *ty);
 
     void cgn_assign(BinaryExpr *BIN);
@@ -18,7 +18,7 @@ void CGN::cgn_assign(BinaryExpr *BIN) {
     mir::Value *dest = m_Value;
 
     mir::Type *ty = cgn_type(BIN->getType());
-    mir::DataLayout DL = m_Segment->get_data_layout();
+    const mir::DataLayout &DL = m_Segment->get_data_layout();
 
     if (BIN->getRHS()->isAggregateInit()) {
         // The right hand side is some aggregate initializer e.g. struct, array.
@@ -684,9 +684,9 @@ void CGN::cgn_logic_and(BinaryExpr *BIN) {
 
     mir::BasicBlock *falseBB = m_Builder.get_insert();
     
-    mir::BasicBlock *rightBB = new mir::BasicBlock(
+    mir::BasicBlock *rightBB = m_Segment->create<mir::BasicBlock>(
         m_Opts.NamedMIR ? "land.rhs" : "");
-    mir::BasicBlock *mergeBB = new mir::BasicBlock(
+    mir::BasicBlock *mergeBB = m_Segment->create<mir::BasicBlock>(
         m_Opts.NamedMIR ? "land.merge" : "");
     
     m_VC = ValueContext::RValue;
@@ -724,9 +724,9 @@ void CGN::cgn_logic_or(BinaryExpr *BIN) {
 
     mir::BasicBlock *trueBB = m_Builder.get_insert();
     
-    mir::BasicBlock *rightBB = new mir::BasicBlock(
+    mir::BasicBlock *rightBB = m_Segment->create<mir::BasicBlock>(
         m_Opts.NamedMIR ? "lor.rhs" : "");
-    mir::BasicBlock *mergeBB = new mir::BasicBlock(
+    mir::BasicBlock *mergeBB = m_Segment->create<mir::BasicBlock>(
         m_Opts.NamedMIR ? "lor.merge" : "");
 
     m_VC = ValueContext::RValue;
@@ -0,0 +1,59 @@
+#include "arena.h"
+
+#include <cstdlib>
+
+using namespace meddle;
+
+void *Arena::allocateSlow(size_t size) {
+    // Oversized objects get a slab of their own, so that the rest of the
+    // current slab is not wasted. Memory from malloc is aligned for any
+    // object, so the start of a slab is always suitably aligned.
+    bool oversized = size > SlabSize / 4;
+    size_t slabSize = oversized ? size : SlabSize;
+    char *slab = static_cast<char *>(std::malloc(slabSize));
+    if (!slab)
+        throw std::bad_alloc();
+
+    m_BytesReserved += slabSize;
+    m_BytesAllocated += size;
+
+    // The current slab is always the last one, and is only closed off once
+    // the arena moves on from it.
+    if (oversized) {
+        Slab S = { slab, slab + size };
+        m_Slabs.insert(m_Ptr ? m_Slabs.end() - 1 : m_Slabs.end(), S);
+        return slab;
+    }
+
+    if (m_Ptr)
+        m_Slabs.back().end = m_Ptr;
+
+    m_Slabs.push_back({ slab, nullptr });
+    m_Ptr = slab + size;
+    m_End = slab + slabSize;
+    return slab;
+}
+
+void Arena::reset() {
+    if (m_Ptr)
+        m_Slabs.back().end = m_Ptr;
+
+    // Objects may refer to each other, so nothing is released until every
+    // destructor has run.
+    for (Slab &S : m_Slabs) {
+        for (char *ptr = S.begin; ptr != S.end; ) {
+            Destroy destroy = *reinterpret_cast<Destroy *>(ptr);
+            ptr += sizeof(Destroy);
+            ptr += destroy(ptr);
+        }
+    }
+
+    for (Slab &S : m_Slabs)
+        std::free(S.begin);
+
+    m_Slabs.clear();
+    m_Ptr = m_End = nullptr;
+    m_NumObjects = 0;
+    m_BytesAllocated = 0;
+    m_BytesReserved = 0;
+}
@@ -0,0 +1,116 @@
+#ifndef MEDDLE_ARENA_H
+#define MEDDLE_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace meddle {
+
+/// A bump-pointer allocator for objects which all die together.
+///
+/// Objects are carved out of large slabs and are never freed one at a time.
+/// Instead, reset() hands every slab back at once. Every object is preceded
+/// by a word that knows how to destroy it and how large it is, so reset() can
+/// walk the slabs and run each destructor without any other bookkeeping. This
+/// way a node which owns a container does not need to be torn down by its
+/// parent.
+///
+/// An arena is not thread-safe, and must be guarded by its owner if shared.
+class Arena final {
+    static constexpr size_t SlabSize = 64 * 1024;
+
+    /// Destroys the object at the given address, and returns its size.
+    using Destroy = size_t (*)(void *);
+
+    static constexpr size_t Align = alignof(Destroy);
+
+    /// A slab, and one past the last object carved out of it.
+    struct Slab final {
+        char *begin;
+        char *end;
+    };
+
+    std::vector<Slab> m_Slabs;
+    char *m_Ptr = nullptr;
+    char *m_End = nullptr;
+
+    size_t m_NumObjects = 0;
+    size_t m_BytesAllocated = 0;
+    size_t m_BytesReserved = 0;
+
+    static constexpr size_t roundUp(size_t size)
+    { return (size + Align - 1) & ~(Align - 1); }
+
+    /// \returns Uninitialized memory of \p size bytes, which must be a
+    /// multiple of the arena alignment.
+    void *allocate(size_t size) {
+        if (size > size_t(m_End - m_Ptr))
+            return allocateSlow(size);
+
+        void *mem = m_Ptr;
+        m_Ptr += size;
+        m_BytesAllocated += size;
+        return mem;
+    }
+
+    /// Allocate \p size bytes from a new slab.
+    void *allocateSlow(size_t size);
+
+    /// Stands in for the destructor of an object still being constructed, so
+    /// that an object whose constructor throws is skipped over by reset().
+    template <typename T>
+    static size_t skip(void *) { return roundUp(sizeof(T)); }
+
+    template <typename T>
+    static size_t destroy(void *P) {
+        static_cast<T *>(P)->~T();
+        return roundUp(sizeof(T));
+    }
+
+public:
+    Arena() = default;
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() { reset(); }
+
+    /// Construct a new \p T in this arena from \p args.
+    template <typename T, typename... Args>
+    T *create(Args &&...args) {
+        static_assert(alignof(T) <= Align, "Over-aligned arena object.");
+
+        char *mem = static_cast<char *>(
+            allocate(sizeof(Destroy) + roundUp(sizeof(T))));
+        Destroy *header = reinterpret_cast<Destroy *>(mem);
+        *header = &skip<T>;
+
+        T *obj = new (mem + sizeof(Destroy)) T(std::forward<Args>(args)...);
+        *header = &destroy<T>;
+        ++m_NumObjects;
+        return obj;
+    }
+
+    /// Destroy every object in this arena and release all of its memory.
+    void reset();
+
+    /// \returns The number of objects created in this arena.
+    size_t getNumObjects() const { return m_NumObjects; }
+
+    /// \returns The number of bytes handed out by this arena, including the
+    /// header of each object.
+    size_t getBytesAllocated() const { return m_BytesAllocated; }
+
+    /// \returns The number of bytes held by the slabs of this arena.
+    size_t getBytesReserved() const { return m_BytesReserved; }
+
+    /// \returns The number of slabs held by this arena.
+    size_t getNumSlabs() const { return m_Slabs.size(); }
+};
+
+} // namespace meddle
+
+#endif // MEDDLE_ARENA_H
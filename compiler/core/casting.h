@@ -0,0 +1,57 @@
+#ifndef MEDDLE_CASTING_H
+#define MEDDLE_CASTING_H
+
+#include <cassert>
+
+namespace meddle {
+
+// Checked casts over class hierarchies with a kind discriminator. Every class
+// that can be the target of a cast defines a static `classof` predicate over
+// the root of its hierarchy, which compares the kind of the node, so none of
+// these need RTTI.
+
+/// \returns If \p V is an instance of \p To.
+template <typename To, typename From>
+inline bool isa(const From *V) {
+    assert(V && "isa<> used on a null pointer.");
+    return To::classof(V);
+}
+
+/// \returns \p V as a \p To, which it must be an instance of.
+template <typename To, typename From>
+inline To *cast(From *V) {
+    assert(isa<To>(V) && "cast<> argument of incompatible type.");
+    return static_cast<To *>(V);
+}
+
+template <typename To, typename From>
+inline const To *cast(const From *V) {
+    assert(isa<To>(V) && "cast<> argument of incompatible type.");
+    return static_cast<const To *>(V);
+}
+
+/// \returns \p V as a \p To, or null if it is not an instance of \p To.
+template <typename To, typename From>
+inline To *dyn_cast(From *V) {
+    return isa<To>(V) ? static_cast<To *>(V) : nullptr;
+}
+
+template <typename To, typename From>
+inline const To *dyn_cast(const From *V) {
+    return isa<To>(V) ? static_cast<const To *>(V) : nullptr;
+}
+
+/// \returns \p V as a \p To, or null if \p V is null or not a \p To.
+template <typename To, typename From>
+inline To *dyn_cast_or_null(From *V) {
+    return V && isa<To>(V) ? static_cast<To *>(V) : nullptr;
+}
+
+template <typename To, typename From>
+inline const To *dyn_cast_or_null(const From *V) {
+    return V && isa<To>(V) ? static_cast<const To *>(V) : nullptr;
+}
+
+} // namespace meddle
+
+#endif // MEDDLE_CASTING_H
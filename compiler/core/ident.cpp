@@ -0,0 +1,68 @@
+#include "ident.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+using namespace meddle;
+
+namespace {
+
+/// The interner is split into shards by spelling, so that threads interning
+/// different names rarely wait on each other.
+constexpr unsigned g_ShardCount = 16;
+
+struct Shard final {
+    std::shared_mutex lock;
+
+    /// Each spelling is owned by the deque, which never moves its elements,
+    /// and the map keys view into it.
+    std::deque<String> strings;
+    std::unordered_map<std::string_view, const String *> map;
+};
+
+Shard &getShard(std::string_view S) {
+    static Shard g_Shards[g_ShardCount];
+    return g_Shards[std::hash<std::string_view>()(S) % g_ShardCount];
+}
+
+const String g_Empty;
+
+} // namespace
+
+Ident Ident::get(std::string_view S) {
+    if (S.empty())
+        return Ident();
+
+    Shard &shard = getShard(S);
+    {
+        std::shared_lock<std::shared_mutex> lock(shard.lock);
+        auto it = shard.map.find(S);
+        if (it != shard.map.end())
+            return Ident(it->second);
+    }
+
+    // Another thread may have interned the same spelling in the meantime, so
+    // check again before adding it.
+    std::unique_lock<std::shared_mutex> lock(shard.lock);
+    auto it = shard.map.find(S);
+    if (it != shard.map.end())
+        return Ident(it->second);
+
+    const String &str = shard.strings.emplace_back(S);
+    shard.map.emplace(str, &str);
+    return Ident(&str);
+}
+
+Ident Ident::find(std::string_view S) {
+    if (S.empty())
+        return Ident();
+
+    Shard &shard = getShard(S);
+    std::shared_lock<std::shared_mutex> lock(shard.lock);
+    auto it = shard.map.find(S);
+    return it != shard.map.end() ? Ident(it->second) : Ident();
+}
+
+const String &Ident::str() const { return m_Str ? *m_Str : g_Empty; }
@@ -0,0 +1,61 @@
+#ifndef MEDDLE_IDENT_H
+#define MEDDLE_IDENT_H
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+using String = std::string;
+
+namespace meddle {
+
+/// An interned identifier.
+///
+/// Every distinct spelling is stored once for the whole process, so two
+/// identifiers are equal exactly when they refer to the same entry, and
+/// comparing or hashing an identifier never looks at its characters. Entries
+/// live until the process exits, and interning is safe from any thread.
+///
+/// The empty identifier is spelled "".
+class Ident final {
+    const String *m_Str = nullptr;
+
+    explicit Ident(const String *S) : m_Str(S) {}
+
+public:
+    Ident() = default;
+
+    /// \returns The identifier spelled \p S, interning it if it is new.
+    static Ident get(std::string_view S);
+
+    /// \returns The identifier spelled \p S if it has ever been interned, and
+    /// the empty identifier otherwise. Nothing is interned by this.
+    static Ident find(std::string_view S);
+
+    bool empty() const { return m_Str == nullptr; }
+
+    const String &str() const;
+
+    std::string_view view() const { return str(); }
+
+    size_t hash() const { return std::hash<const void *>()(m_Str); }
+
+    bool operator==(const Ident &other) const { return m_Str == other.m_Str; }
+
+    bool operator!=(const Ident &other) const { return m_Str != other.m_Str; }
+};
+
+inline std::ostream &operator<<(std::ostream &OS, const Ident &I) {
+    return OS << I.str();
+}
+
+} // namespace meddle
+
+template<>
+struct std::hash<meddle::Ident> {
+    size_t operator()(const meddle::Ident &I) const { return I.hash(); }
+};
+
+#endif // MEDDLE_IDENT_H
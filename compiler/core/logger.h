@@ -7,34 +7,34 @@
 
 namespace meddle {
 
+/// Print the diagnostic prefix for \p md, or the tool name if there is none.
+inline void print_location(const Metadata *md) {
+    if (md && md->isValid())
+        std::cout << md->getFile().filename << ":" << md->getLine() << ":" 
+                  << md->getCol() << ": ";
+    else
+        std::cout << "meddle: ";
+}
+
 inline void log(const String &m) {
     std::cout << "meddle: " << m << "\n";
 }
 
 inline void info(const String &m, const Metadata *md = nullptr) {
-    if (md)
-        std::cout << md->file.filename << ":" << md->line << ":" << md->col << ": ";
-    else
-        std::cout << "meddle: ";
+    print_location(md);
 
     std::cout << "info: " << m << "\n";
 }
 
 inline void warn(const String &m, const Metadata *md = nullptr) {
-    if (md)
-        std::cout << md->file.filename << ":" << md->line << ":" << md->col << ": ";
-    else
-        std::cout << "meddle: ";
+    print_location(md);
 
     std::cout << "warning: " << m << "\n";
 }
 
 __attribute__((noreturn))
 inline void fatal(const String &m, const Metadata *md = nullptr) {
-    if (md)
-        std::cout << md->file.filename << ":" << md->line << ":" << md->col << ": ";
-    else
-        std::cout << "meddle: ";
+    print_location(md);
 
     std::cout << "error: " << m << "\n";
     exit(1);
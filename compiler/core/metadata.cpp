@@ -3,7 +3,15 @@
 
 #include <boost/filesystem.hpp>
 
-#include <fstream>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace meddle;
 
@@ -16,24 +24,152 @@ File meddle::parseInputFile(const String &path) {
         fatal("file does not exist: " + path, nullptr);
     }
 
-    String buffer;
-    try {
-        unsigned size = boost::filesystem::file_size(path);
-        buffer.resize(size);
-
-        std::ifstream file(path, std::ios::binary);
-        if (!file)
-            fatal("failed to open file: " + path, nullptr);
-
-        file.read(&buffer[0], size);
-        
-        if (file.gcount() != static_cast<std::streamsize>(size))
-            fatal("failed to read entire file: " + path, nullptr);
-    } catch (const std::exception &e) {
-        fatal("failed to parse input file: " + String(e.what()), nullptr);
-    }
+    std::string_view contents = SourceManager::get().mapFile(absol);
 
     String filename = boost::filesystem::path(path).filename().string();
     String directory = boost::filesystem::path(path).parent_path().string();
-    return File(filename, directory, absol, buffer);
+    return File(filename, directory, absol, contents);
+}
+
+File::File(
+    const String &filename,
+    const String &dir,
+    const String &path,
+    const String &contents
+) : filename(filename), dir(dir), path(path), 
+    contents(SourceManager::get().copyBuffer(contents)) {}
+
+const File &Metadata::getFile() const {
+    return SourceManager::get().getFile(*this);
+}
+
+unsigned Metadata::getLine() const {
+    return SourceManager::get().getLine(*this);
+}
+
+unsigned Metadata::getCol() const {
+    return SourceManager::get().getCol(*this);
+}
+
+SourceManager::~SourceManager() {
+    for (auto &E : m_Entries)
+        delete E;
+    m_Entries.clear();
+
+    for (auto &B : m_Buffers) {
+        if (B.mapped)
+            munmap(B.data, B.size);
+        else
+            delete[] B.data;
+    }
+    m_Buffers.clear();
+}
+
+SourceManager &SourceManager::get() {
+    static SourceManager SM;
+    return SM;
+}
+
+std::string_view SourceManager::mapFile(const String &path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        fatal("failed to open file: " + path, nullptr);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        fatal("failed to stat file: " + path, nullptr);
+    }
+
+    // Empty files cannot be mapped, but there is nothing to keep alive anyway.
+    size_t size = st.st_size;
+    if (size == 0) {
+        close(fd);
+        return std::string_view();
+    }
+
+    void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        fatal("failed to map file: " + path, nullptr);
+
+    // Sources are lexed front to back exactly once.
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    std::lock_guard<std::mutex> lock(m_Lock);
+    m_Buffers.push_back({ static_cast<char *>(data), size, true });
+    return std::string_view(static_cast<char *>(data), size);
+}
+
+std::string_view SourceManager::copyBuffer(std::string_view S) {
+    if (S.empty())
+        return std::string_view();
+
+    char *data = new char[S.size()];
+    std::memcpy(data, S.data(), S.size());
+
+    std::lock_guard<std::mutex> lock(m_Lock);
+    m_Buffers.push_back({ data, S.size(), false });
+    return std::string_view(data, S.size());
+}
+
+Metadata SourceManager::addFile(const File &F) {
+    std::lock_guard<std::mutex> lock(m_Lock);
+    if (F.contents.size() >= UINT32_MAX - m_Next)
+        fatal("source space exhausted by file: " + F.path, nullptr);
+
+    Entry *E = new Entry(F, m_Next);
+    m_Entries.push_back(E);
+
+    // Reserve one extra offset so that the end of the file is addressable.
+    m_Next += F.contents.size() + 1;
+    return Metadata(E->base);
+}
+
+const SourceManager::Entry *SourceManager::getEntry(uint32_t loc) const {
+    assert(loc != 0 && loc < m_Next && "Invalid source location.");
+
+    // Entries are appended in increasing order of their base, so the owning
+    // entry is the last one starting at or before the location.
+    auto it = std::upper_bound(m_Entries.begin(), m_Entries.end(), loc, 
+        [](uint32_t L, const Entry *E) { return L < E->base; });
+    return *(it - 1);
+}
+
+unsigned SourceManager::findLine(uint32_t loc) const {
+    Entry *E = const_cast<Entry *>(getEntry(loc));
+    if (E->lines.empty()) {
+        std::string_view C = E->file.contents;
+        E->lines.reserve(C.size() / 32 + 1);
+        E->lines.push_back(0);
+        for (uint32_t i = 0, e = C.size(); i != e; ++i)
+            if (C[i] == '\n')
+                E->lines.push_back(i + 1);
+    }
+
+    uint32_t offset = loc - E->base;
+    auto it = std::upper_bound(E->lines.begin(), E->lines.end(), offset);
+    return it - E->lines.begin();
+}
+
+const File &SourceManager::getFile(Metadata md) const {
+    std::lock_guard<std::mutex> lock(m_Lock);
+    return getEntry(md.loc)->file;
+}
+
+uint32_t SourceManager::getOffset(Metadata md) const {
+    std::lock_guard<std::mutex> lock(m_Lock);
+    return md.loc - getEntry(md.loc)->base;
+}
+
+unsigned SourceManager::getLine(Metadata md) const {
+    std::lock_guard<std::mutex> lock(m_Lock);
+    return findLine(md.loc);
+}
+
+unsigned SourceManager::getCol(Metadata md) const {
+    std::lock_guard<std::mutex> lock(m_Lock);
+    const Entry *E = getEntry(md.loc);
+    unsigned line = findLine(md.loc);
+    return md.loc - E->base - E->lines[line - 1] + 1;
 }
@@ -1,7 +1,11 @@
 #ifndef MEDDLE_METADATA_H
 #define MEDDLE_METADATA_H
 
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <vector>
 
 using String = std::string;
 
@@ -11,32 +15,146 @@ struct File final {
     String filename;
     String dir;
     String path;
-    String contents;
+    /// A view of the contents of this file. The underlying buffer is owned by
+    /// the SourceManager and lives for the whole compilation.
+    std::string_view contents;
 
+    /// Create a file whose contents are copied into a buffer owned by the
+    /// SourceManager.
     File(
-        const String &filename, 
-        const String &dir, 
-        const String &path, 
+        const String &filename,
+        const String &dir,
+        const String &path,
         const String &contents
+    );
+
+    /// Create a file over an existing buffer which outlives it.
+    File(
+        const String &filename,
+        const String &dir,
+        const String &path,
+        std::string_view contents
     ) : filename(filename), dir(dir), path(path), contents(contents) {}
+
+    File(
+        const String &filename,
+        const String &dir,
+        const String &path,
+        const char *contents
+    ) : File(filename, dir, path, String(contents)) {}
 };
 
+/// Memory-map the file at \p path and return it as an input file.
 File parseInputFile(const String &path);
 
+/// A compact source location. The location is an offset into the global
+/// source space of the SourceManager, and line and column information is only
+/// computed from it when asked for, i.e. for diagnostics.
 struct Metadata final {
-    File file;
-    unsigned line;
-    unsigned col;
+    /// The offset of this location, or 0 if it is invalid.
+    uint32_t loc;
+
+    Metadata() : loc(0) {}
+
+    explicit Metadata(uint32_t loc) : loc(loc) {}
+
+    bool isValid() const { return loc != 0; }
+
+    /// \returns The file this location is in.
+    const File &getFile() const;
+
+    /// \returns The 1-based line number of this location.
+    unsigned getLine() const;
+
+    /// \returns The 1-based column number of this location.
+    unsigned getCol() const;
+
+    bool operator<(const Metadata &other) const { return loc < other.loc; }
+
+    bool operator==(const Metadata &other) const { return loc == other.loc; }
+};
+
+/// Owns every source file in the compilation and maps compact locations
+/// back to their file, line and column.
+///
+/// Each file added to the manager is given a contiguous range of the global
+/// source space, one offset per byte plus one for the end of the file. The
+/// manager is safe to use from several threads at once.
+class SourceManager final {
+    struct Entry final {
+        File file;
+        uint32_t base;
+        /// Offsets of the start of each line, built on first use.
+        std::vector<uint32_t> lines = {};
+
+        Entry(const File &F, uint32_t B) : file(F), base(B) {}
+    };
+
+    /// A buffer of source text, either mapped from disk or allocated.
+    struct Buffer final {
+        char *data;
+        size_t size;
+        bool mapped;
+    };
+
+    std::vector<Entry *> m_Entries = {};
+    std::vector<Buffer> m_Buffers = {};
+    uint32_t m_Next = 1;
+
+    /// Guards the file and buffer tables, as files are lexed in parallel.
+    mutable std::mutex m_Lock;
+
+    SourceManager() = default;
+
+    /// \returns The entry containing \p loc. The lock must be held.
+    const Entry *getEntry(uint32_t loc) const;
+
+    /// \returns The 1-based line of \p loc, building the line table of its
+    /// file if needed. The lock must be held.
+    unsigned findLine(uint32_t loc) const;
+
+public:
+    SourceManager(const SourceManager &) = delete;
+    SourceManager &operator=(const SourceManager &) = delete;
+
+    ~SourceManager();
+
+    /// \returns The process-wide source manager.
+    static SourceManager &get();
+
+    /// Map the file at \p path into memory for the rest of the compilation.
+    ///
+    /// \returns A view of the mapped contents.
+    std::string_view mapFile(const String &path);
+
+    /// Copy \p S into a buffer that lives for the rest of the compilation.
+    ///
+    /// \returns A view of the copy.
+    std::string_view copyBuffer(std::string_view S);
+
+    /// Add a file to the manager.
+    ///
+    /// \returns The location of the start of the file.
+    Metadata addFile(const File &F);
+
+    /// \returns The location of the byte at \p offset in the file starting
+    /// at \p start.
+    Metadata getLoc(Metadata start, uint32_t offset) const
+    { return Metadata(start.loc + offset); }
+
+    /// \returns The file that \p md is in.
+    const File &getFile(Metadata md) const;
+
+    /// \returns The offset of \p md relative to the start of its file.
+    uint32_t getOffset(Metadata md) const;
 
-    Metadata(const File &file) : file(file), line(1), col(1) {}
-    
-    Metadata(const File &file, unsigned line, unsigned col) 
-      : file(file), line(line), col(col) {}
+    /// \returns The 1-based line of \p md.
+    unsigned getLine(Metadata md) const;
 
-    bool operator<(const Metadata &other) const 
-    { return line < other.line && col < other.col; }
+    /// \returns The 1-based column of \p md.
+    unsigned getCol(Metadata md) const;
 };
 
 } // namespace meddle
 
-#endif // MEDDLE_METADATA_H
\ No newline at end of file
+#endif // MEDDLE_METADATA_H
@@ -1,20 +1,64 @@
 #ifndef MEDDLE_OPTIONS_H
 #define MEDDLE_OPTIONS_H
 
+#include <atomic>
 #include <string>
 
 using String = std::string;
 
 namespace meddle {
 
+/// A statistic counter which may be bumped from several threads at once.
+class Counter final {
+    std::atomic<unsigned> m_Value;
+
+public:
+    Counter(unsigned V = 0) : m_Value(V) {}
+
+    Counter(const Counter &other) : m_Value(other.get()) {}
+
+    Counter &operator=(const Counter &other) {
+        m_Value.store(other.get(), std::memory_order_relaxed);
+        return *this;
+    }
+
+    Counter &operator+=(unsigned V) {
+        m_Value.fetch_add(V, std::memory_order_relaxed);
+        return *this;
+    }
+
+    unsigned get() const { return m_Value.load(std::memory_order_relaxed); }
+
+    operator unsigned() const { return get(); }
+};
+
 struct Options final {
-    unsigned lexedLines = 0;
+    Counter lexedLines = 0;
     String output = "main";
 
+    /// The number of threads to use, or 0 for one per hardware thread.
+    unsigned Jobs = 1;
+
     unsigned Debug:1;
     unsigned KeepCC:1;
     unsigned NamedMIR:1;
     unsigned Time:1;
+
+    /// Lower template function specializations on demand, only once lowered
+    /// code refers to them.
+    unsigned LazySpecs:1 = 0;
+
+    /// Skip over function bodies when parsing, and only parse a body once it
+    /// is first needed. Name resolution needs the body of every function of
+    /// an input, so this only saves work for callers that need the
+    /// declarations of a unit alone, and the driver leaves it off. Bodies kept
+    /// by a module interface are always put off until a specialization needs
+    /// them, regardless of this.
+    unsigned LazyBodies:1 = 0;
+
+    /// Write a module interface next to each input once it is analyzed, which
+    /// later compilations may use in place of the input.
+    unsigned EmitInterfaces:1 = 0;
 };
 
 } // namespace meddle
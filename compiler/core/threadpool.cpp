@@ -0,0 +1,126 @@
+#include "threadpool.h"
+
+using namespace meddle;
+
+namespace {
+
+/// The pool that the current thread works for, and its queue in that pool.
+thread_local const void *t_Pool = nullptr;
+thread_local unsigned t_Index = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned jobs) {
+    if (jobs == 0)
+        jobs = getHardwareJobs();
+
+    if (jobs == 1)
+        return;
+
+    m_Queues.reserve(jobs);
+    for (unsigned i = 0; i != jobs; ++i)
+        m_Queues.push_back(std::make_unique<Queue>());
+
+    m_Workers.reserve(jobs);
+    for (unsigned i = 0; i != jobs; ++i)
+        m_Workers.emplace_back([this, i] { run(i); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_Lock);
+        m_Stop = true;
+    }
+
+    m_Ready.notify_all();
+    for (auto &W : m_Workers)
+        W.join();
+}
+
+unsigned ThreadPool::getHardwareJobs() {
+    unsigned jobs = std::thread::hardware_concurrency();
+    return jobs ? jobs : 1;
+}
+
+bool ThreadPool::take(unsigned index, std::function<void()> &task) {
+    // Run the newest task of our own queue first, as it most likely depends on
+    // what this worker just finished.
+    {
+        Queue &Q = *m_Queues[index];
+        std::lock_guard<std::mutex> lock(Q.lock);
+        if (!Q.tasks.empty()) {
+            task = std::move(Q.tasks.back());
+            Q.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Otherwise steal the oldest task of another worker.
+    for (unsigned i = 1; i != m_Queues.size(); ++i) {
+        Queue &Q = *m_Queues[(index + i) % m_Queues.size()];
+        std::lock_guard<std::mutex> lock(Q.lock);
+        if (!Q.tasks.empty()) {
+            task = std::move(Q.tasks.front());
+            Q.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::run(unsigned index) {
+    t_Pool = this;
+    t_Index = index;
+
+    for (;;) {
+        std::function<void()> task;
+        if (!take(index, task)) {
+            std::unique_lock<std::mutex> lock(m_Lock);
+            m_Ready.wait(lock, [this] { return m_Stop || m_Queued != 0; });
+            if (m_Queued == 0)
+                return;
+
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_Lock);
+            --m_Queued;
+        }
+
+        task();
+
+        std::lock_guard<std::mutex> lock(m_Lock);
+        if (--m_Pending == 0)
+            m_Idle.notify_all();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    if (m_Workers.empty()) {
+        task();
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_Lock);
+    unsigned index = t_Pool == this ? t_Index : m_Next++ % m_Queues.size();
+    ++m_Queued;
+    ++m_Pending;
+
+    {
+        // Publish the task while still holding the pool lock, so that no
+        // worker can see the count before the task is in a queue.
+        Queue &Q = *m_Queues[index];
+        std::lock_guard<std::mutex> qlock(Q.lock);
+        Q.tasks.push_back(std::move(task));
+    }
+
+    lock.unlock();
+    m_Ready.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(m_Lock);
+    m_Idle.wait(lock, [this] { return m_Pending == 0; });
+}
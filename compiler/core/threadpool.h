@@ -0,0 +1,77 @@
+#ifndef MEDDLE_THREADPOOL_H
+#define MEDDLE_THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace meddle {
+
+/// A fixed-size, work-stealing pool of worker threads which run submitted
+/// tasks.
+///
+/// Every worker owns a deque of tasks. A task submitted from a worker goes to
+/// the back of that worker's own deque and is run next, which keeps chains of
+/// dependent tasks on one thread. An idle worker steals from the front of the
+/// other deques.
+///
+/// A pool with a single job runs every task inline on the submitting thread,
+/// so serial compilation never pays for any synchronization.
+class ThreadPool final {
+    struct Queue final {
+        std::mutex lock;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::thread> m_Workers;
+    std::vector<std::unique_ptr<Queue>> m_Queues;
+    std::mutex m_Lock;
+    std::condition_variable m_Ready;
+    std::condition_variable m_Idle;
+
+    /// The number of tasks sitting in a queue, and the number of tasks which
+    /// have not yet finished.
+    unsigned m_Queued = 0;
+    unsigned m_Pending = 0;
+
+    /// The queue that the next task from outside of the pool is given to.
+    unsigned m_Next = 0;
+    bool m_Stop = false;
+
+    void run(unsigned index);
+
+    /// Take a task from the queue at \p index, or steal one from another queue.
+    /// \returns If a task was found.
+    bool take(unsigned index, std::function<void()> &task);
+
+public:
+    /// Create a pool with \p jobs workers. A job count of 0 uses one worker per
+    /// hardware thread.
+    explicit ThreadPool(unsigned jobs);
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool();
+
+    /// \returns The number of hardware threads, or 1 if it is unknown.
+    static unsigned getHardwareJobs();
+
+    /// \returns The number of tasks which may run at once.
+    unsigned getJobs() const { return m_Workers.empty() ? 1 : m_Workers.size(); }
+
+    /// Queue \p task to be run by a worker. Tasks may submit further tasks.
+    void submit(std::function<void()> task);
+
+    /// Wait until every submitted task, including those submitted by other
+    /// tasks, has finished. This must not be called from within a task.
+    void wait();
+};
+
+} // namespace meddle
+
+#endif // MEDDLE_THREADPOOL_H
@@ -0,0 +1,108 @@
+#ifndef MEDDLE_KEYWORD_H
+#define MEDDLE_KEYWORD_H
+
+#include "token.h"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace meddle {
+
+namespace detail {
+
+struct KeywordEntry final {
+    std::string_view spelling;
+    KeywordKind kind;
+};
+
+constexpr std::array<KeywordEntry, 20> g_Keywords = {{
+    { "use", KeywordKind::Use },
+    { "fix", KeywordKind::Fix },
+    { "mut", KeywordKind::Mut },
+    { "break", KeywordKind::Break },
+    { "continue", KeywordKind::Continue },
+    { "if", KeywordKind::If },
+    { "else", KeywordKind::Else },
+    { "match", KeywordKind::Match },
+    { "ret", KeywordKind::Ret },
+    { "until", KeywordKind::Until },
+    { "cast", KeywordKind::Cast },
+    { "nil", KeywordKind::Nil },
+    { "true", KeywordKind::True },
+    { "false", KeywordKind::False },
+    { "sizeof", KeywordKind::Sizeof },
+    { "_", KeywordKind::Underscore },
+    { "associated", KeywordKind::Associated },
+    { "no_mangle", KeywordKind::NoMangle },
+    { "public", KeywordKind::Public },
+    { "syscall", KeywordKind::Syscall },
+}};
+
+/// The number of bits in a keyword hash, i.e. log2 of the table size.
+constexpr unsigned g_KeywordBits = 6;
+
+constexpr size_t g_MaxKeywordLength = [] {
+    size_t max = 0;
+    for (auto &K : g_Keywords)
+        max = K.spelling.size() > max ? K.spelling.size() : max;
+    return max;
+}();
+
+/// Hash a candidate keyword by its length and its first and last characters.
+constexpr uint32_t hashKeyword(std::string_view S, uint32_t seed) {
+    uint32_t key = (uint32_t(uint8_t(S.front())) << 16)
+                 | (uint32_t(uint8_t(S.back())) << 8)
+                 | uint32_t(S.size());
+    return (key * seed) >> (32 - g_KeywordBits);
+}
+
+/// \returns If the keywords all hash to different slots with \p seed.
+constexpr bool isPerfectSeed(uint32_t seed) {
+    bool used[1 << g_KeywordBits] = {};
+    for (auto &K : g_Keywords) {
+        uint32_t slot = hashKeyword(K.spelling, seed);
+        if (used[slot])
+            return false;
+
+        used[slot] = true;
+    }
+
+    return true;
+}
+
+/// The first odd multiplier which hashes every keyword to a unique slot.
+constexpr uint32_t g_KeywordSeed = [] {
+    for (uint32_t seed = 0x9E3779B1; ; seed += 2) {
+        if (isPerfectSeed(seed))
+            return seed;
+    }
+}();
+
+constexpr std::array<KeywordEntry, 1 << g_KeywordBits> g_KeywordTable = [] {
+    std::array<KeywordEntry, 1 << g_KeywordBits> table = {};
+    for (auto &K : g_Keywords)
+        table[hashKeyword(K.spelling, g_KeywordSeed)] = K;
+    return table;
+}();
+
+} // namespace detail
+
+/// \returns The keyword spelled by \p S, or KeywordKind::None if \p S is not
+/// a keyword. This is a single hash and at most one string compare.
+constexpr KeywordKind classifyKeyword(std::string_view S) {
+    if (S.empty() || S.size() > detail::g_MaxKeywordLength)
+        return KeywordKind::None;
+
+    const detail::KeywordEntry &E = detail::g_KeywordTable[
+        detail::hashKeyword(S, detail::g_KeywordSeed)];
+    return E.spelling == S ? E.kind : KeywordKind::None;
+}
+
+static_assert(classifyKeyword("until") == KeywordKind::Until);
+static_assert(classifyKeyword("no_mangle") == KeywordKind::NoMangle);
+static_assert(classifyKeyword("untill") == KeywordKind::None);
+
+} // namespace meddle
+
+#endif // MEDDLE_KEYWORD_H
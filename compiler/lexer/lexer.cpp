@@ -1,41 +1,85 @@
+#include "keyword.h"
 #include "lexer.h"
+#include "scan.h"
 #include "token.h"
+#include "../core/logger.h"
+
+#include <array>
 #include <cctype>
 #include <iostream>
 
 using namespace meddle;
 
+/// Storage for the spelling of every character literal, so that they can be
+/// viewed without an allocation.
+static constexpr std::array<char, 256> g_Chars = [] {
+    std::array<char, 256> chars = {};
+    for (unsigned i = 0; i != 256; ++i)
+        chars[i] = static_cast<char>(i);
+    return chars;
+}();
+
+/// \returns The character denoted by the escape sequence '\' \p c, or -1 if
+/// the sequence is unknown.
+static int unescape(char c) {
+    switch (c) {
+        case '0': return '\0';
+        case 'n': return '\n';
+        case 't': return '\t';
+        case 'r': return '\r';
+        case 'b': return '\b';
+        case 'f': return '\f';
+        case 'v': return '\v';
+        case '\\': return '\\';
+        case '\'': return '\'';
+        case '"': return '"';
+        default: return -1;
+    }
+}
+
 Lexer::Lexer(const File &file) 
-  : m_Stream(), m_Buffer(file.contents), m_Loc(Metadata(file)) {
+  : m_Stream(), m_Buffer(file.contents), 
+    m_Start(SourceManager::get().addFile(file)) {}
+
+TokenStream Lexer::unwrap(Options *opts) {
+    while (!m_Unwrapped) {
+        Token T = lex();
+        m_Stream.add(T);
+        m_Unwrapped = T.kind == TokenKind::Eof;
+    }
+
+    if (opts)
+        opts->lexedLines += m_Line;
+
+    return m_Stream;
+}
+
+void Lexer::skip() {
+    const char *B = m_Buffer.data();
+    const char *E = B + m_Buffer.size();
+    const char *P = B + m_Iter;
+
     for (;;) {
-        if (m_Iter >= m_Buffer.size())
+        P = scanWhitespace(P, E, m_Line);
+        if (E - P < 2 || P[0] != '/' || P[1] != '/')
             break;
 
-        m_Stream.add(lex());
+        P = scanLineEnd(P + 2, E);
     }
 
-    m_Stream.add(Token(m_Loc));
+    m_Iter = P - B;
 }
 
 Token Lexer::lex() {
-    if (curr() == '\0') {
-        return Token(m_Loc);
-    } else if (curr() == '\n') {
-        move();
-        m_Loc.line++;
-        m_Loc.col = 1;
-        return lex();
-    } else if (curr() == ' ' || curr() == '\t') {
-        while (curr() == ' ' || curr() == '\t')
-            move();
-
-        return lex();
-    }
+    skip();
+    if (curr() == '\0')
+        return Token(loc());
 
     TokenKind kind;
     LiteralKind literal = LiteralKind::None;
-    String value = "";
-    Metadata start = m_Loc;
+    KeywordKind keyword = KeywordKind::None;
+    std::string_view value;
+    Metadata start = loc();
 
     switch (curr()) {
         case '+':
@@ -83,14 +127,7 @@ Token Lexer::lex() {
             break;
 
         case '/':
-            if (next() == '/') {
-                kind = TokenKind::SlashSlash;
-                move(2);
-                while (curr() != '\n' && curr() != '\0')
-                    move();
-                
-                return lex();
-            } else if (next() == '=') {
+            if (next() == '=') {
                 kind = TokenKind::SlashEquals;
                 move(2);
             } else {
@@ -300,79 +337,93 @@ Token Lexer::lex() {
             move();
             break;
 
-        case '\'':
+        case '\'': {
             move();
             kind = TokenKind::Literal;
             literal = LiteralKind::Character;
 
+            int c = curr();
             if (curr() == '\\') {
                 move();
-                switch (curr()) {
-                    case '0': value = "\0"; break;
-                    case 'n': value = "\n"; break;
-                    case 't': value = "\t"; break;
-                    case 'r': value = "\r"; break;
-                    case 'b': value = "\b"; break;
-                    case 'f': value = "\f"; break;
-                    case 'v': value = "\v"; break;
-                    case '\\': value = "\\"; break;
-                    case '\'': value = "\'"; break;
-                    default: 
-                        std::cout << "unknown escape sequence: " << curr() << "\n";
-                        exit(1);
+                c = unescape(curr());
+                if (c < 0) {
+                    std::cout << "unknown escape sequence: " << curr() << "\n";
+                    exit(1);
                 }
-            } else
-                value = curr();
+            }
 
             if (next() != '\'') {
                 kind = TokenKind::Quote;
                 literal = LiteralKind::None;
-                value = "";
-            } else
+            } else {
+                value = std::string_view(&g_Chars[(unsigned char) c], 1);
                 move(2);
+            }
                 
             break;
+        }
 
-        case '"':
+        case '"': {
             move();
             kind = TokenKind::Literal;
             literal = LiteralKind::String;
 
-            while (curr() != '"') {
-                if (curr() == '\\') {
-                    move();
-                    switch (curr()) {
-                        case '0': value += '\0'; break;
-                        case 'n': value += '\n'; break;
-                        case 't': value += '\t'; break;
-                        case 'r': value += '\r'; break;
-                        case 'b': value += '\b'; break;
-                        case 'f': value += '\f'; break;
-                        case 'v': value += '\v'; break;
-                        case '\\': value += '\\'; break;
-                        case '\"': value += '\"'; break;
-                        default: 
-                            exit(1);
+            // Most string literals have no escapes, so the spelling can be a
+            // view of the source. Only decode into a new buffer when needed.
+            const char *B = m_Buffer.data();
+            const char *E = B + m_Buffer.size();
+            const char *P = B + m_Iter;
+            bool escaped = false;
+            for (;;) {
+                P = scanStringEnd(P, E);
+                if (P == E || *P == '\0')
+                    fatal("unterminated string literal", &start);
+                else if (*P == '"')
+                    break;
+
+                // Skip over the escaped character, it may be a '"'.
+                escaped = true;
+                P += 2;
+                if (P > E)
+                    fatal("unterminated string literal", &start);
+            }
+
+            unsigned long begin = m_Iter;
+            m_Iter = P - B;
+
+            value = m_Buffer.substr(begin, m_Iter - begin);
+            if (escaped) {
+                String decoded;
+                decoded.reserve(value.size());
+                for (unsigned long i = 0, e = value.size(); i != e; ++i) {
+                    if (value[i] != '\\') {
+                        decoded += value[i];
+                        continue;
                     }
-                } else
-                    value += curr();
 
-                move();
+                    int c = unescape(value[++i]);
+                    if (c < 0 || c == '\'')
+                        exit(1);
+
+                    decoded += c;
+                }
+
+                value = SourceManager::get().copyBuffer(decoded);
             }
 
             move();
             break;
+        }
         
         DEFAULT:
         default: {
+            unsigned long begin = m_Iter;
             if (isdigit(curr()) || curr() == '-') {
                 kind = TokenKind::Literal;
                 literal = LiteralKind::Integer;
 
-                if (curr() == '-') {
-                    value += curr();
+                if (curr() == '-')
                     move();
-                }
 
                 while (isdigit(curr()) || curr() == '.') {
                     if (curr() == '.') {
@@ -382,16 +433,17 @@ Token Lexer::lex() {
                         literal = LiteralKind::Float;
                     }
                        
-                    value += curr();
                     move();
                 }
+
+                value = m_Buffer.substr(begin, m_Iter - begin);
             } else if (isalpha(curr()) || curr() == '_') {
                 kind = TokenKind::Identifier;
-                
-                while (isalnum(curr()) || curr() == '_') {
-                    value += curr();
-                    move();
-                }
+                const char *B = m_Buffer.data();
+                m_Iter = scanIdentifier(B + m_Iter + 1, B + m_Buffer.size()) - B;
+
+                value = m_Buffer.substr(begin, m_Iter - begin);
+                keyword = classifyKeyword(value);
             } else {
                 // Handle unknown character
                 std::cout << "unknown token: " << curr() << std::endl;
@@ -400,5 +452,5 @@ Token Lexer::lex() {
         }
     };
 
-    return Token(kind, literal, value, start);
+    return Token(kind, literal, value, start, keyword);
 }
@@ -4,15 +4,20 @@
 #include "tokenstream.h"
 #include "../core/options.h"
 
+#include <algorithm>
+
 using String = std::string;
 
 namespace meddle {
 
-/// A lexer which produces a token stream from a source file.
+/// A lexer which produces tokens from a source file, either all at once with
+/// unwrap() or one at a time with lex().
 class Lexer final {
     TokenStream m_Stream;
-    String m_Buffer;
-    Metadata m_Loc;
+    bool m_Unwrapped = false;
+    std::string_view m_Buffer;
+    Metadata m_Start;
+    unsigned m_Line = 1;
     unsigned long m_Iter = 0;
 
     bool isEof() const { return m_Iter >= m_Buffer.size(); }
@@ -26,22 +31,32 @@ class Lexer final {
 
     char curr() const { return next(0); }
 
-    void move(unsigned long n = 1) {
-        m_Iter += n;
-        m_Loc.col++;
-    }
+    void move(unsigned long n = 1) { m_Iter += n; }
 
-    Token lex();
+    /// \returns The location of the current character.
+    Metadata loc() const 
+    { return Metadata(m_Start.loc + std::min(m_Iter, m_Buffer.size())); }
+
+    /// Skip over any whitespace and line comments before the next token.
+    void skip();
 
 public:
     Lexer(const File &file);
 
-    TokenStream unwrap(Options *opts = nullptr) const {
-        if (opts)
-            opts->lexedLines += m_Loc.line;
+    /// Lex \p buffer, a range of a file which has already been added to the
+    /// SourceManager and which begins at \p start.
+    Lexer(std::string_view buffer, Metadata start)
+      : m_Stream(), m_Buffer(buffer), m_Start(start) {}
 
-        return m_Stream; 
-    }
+    /// Lex the next token. Once the end of the file is reached, every call
+    /// returns an Eof token.
+    Token lex();
+
+    /// \returns The number of lines lexed so far.
+    unsigned getLineCount() const { return m_Line; }
+
+    /// Lex every remaining token of the file into a stream.
+    TokenStream unwrap(Options *opts = nullptr);
 };
 
 } // namespace meddle
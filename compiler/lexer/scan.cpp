@@ -0,0 +1,304 @@
+#include "scan.h"
+
+#include <array>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MEDDLE_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace meddle;
+
+namespace {
+
+/// Character classes used by the scalar kernels.
+enum CharClass : uint8_t {
+    CC_Whitespace = 1 << 0,
+    CC_Newline = 1 << 1,
+    CC_Identifier = 1 << 2,
+    CC_LineEnd = 1 << 3,
+    CC_StringEnd = 1 << 4,
+};
+
+constexpr std::array<uint8_t, 256> g_Classes = [] {
+    std::array<uint8_t, 256> classes = {};
+    classes[' '] |= CC_Whitespace;
+    classes['\t'] |= CC_Whitespace;
+    classes['\n'] |= CC_Whitespace | CC_Newline | CC_LineEnd;
+    classes['\0'] |= CC_LineEnd | CC_StringEnd;
+    classes['"'] |= CC_StringEnd;
+    classes['\\'] |= CC_StringEnd;
+    classes['_'] |= CC_Identifier;
+    for (unsigned c = '0'; c <= '9'; ++c)
+        classes[c] |= CC_Identifier;
+    for (unsigned c = 'a'; c <= 'z'; ++c)
+        classes[c] |= CC_Identifier;
+    for (unsigned c = 'A'; c <= 'Z'; ++c)
+        classes[c] |= CC_Identifier;
+    return classes;
+}();
+
+inline bool is(char c, uint8_t cls) {
+    return g_Classes[static_cast<unsigned char>(c)] & cls;
+}
+
+/// A set of scanning kernels for one instruction set level.
+struct Kernels final {
+    const char *(*whitespace)(const char *, const char *, unsigned &);
+    const char *(*identifier)(const char *, const char *);
+    const char *(*lineEnd)(const char *, const char *);
+    const char *(*stringEnd)(const char *, const char *);
+};
+
+const char *whitespaceScalar(const char *B, const char *E, unsigned &lines) {
+    for (; B != E && is(*B, CC_Whitespace); ++B) {
+        if (*B == '\n')
+            ++lines;
+    }
+
+    return B;
+}
+
+const char *identifierScalar(const char *B, const char *E) {
+    while (B != E && is(*B, CC_Identifier))
+        ++B;
+
+    return B;
+}
+
+const char *lineEndScalar(const char *B, const char *E) {
+    while (B != E && !is(*B, CC_LineEnd))
+        ++B;
+
+    return B;
+}
+
+const char *stringEndScalar(const char *B, const char *E) {
+    while (B != E && !is(*B, CC_StringEnd))
+        ++B;
+
+    return B;
+}
+
+constexpr Kernels g_Scalar = {
+    whitespaceScalar, identifierScalar, lineEndScalar, stringEndScalar
+};
+
+#ifdef MEDDLE_SCAN_X86
+
+// Each vector kernel classifies a block of bytes into a bitmask of the bytes
+// that stop the scan, and falls back to the scalar kernel for the tail.
+
+inline __m128i inRange128(__m128i x, char lo, char hi) {
+    return _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8(lo - 1)),
+                         _mm_cmplt_epi8(x, _mm_set1_epi8(hi + 1)));
+}
+
+inline __m128i isIdentifier128(__m128i x) {
+    __m128i lower = _mm_or_si128(x, _mm_set1_epi8(0x20));
+    return _mm_or_si128(
+        _mm_or_si128(inRange128(lower, 'a', 'z'), inRange128(x, '0', '9')),
+        _mm_cmpeq_epi8(x, _mm_set1_epi8('_')));
+}
+
+const char *whitespaceSSE2(const char *B, const char *E, unsigned &lines) {
+    for (; E - B >= 16; B += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(B));
+        __m128i nl = _mm_cmpeq_epi8(x, _mm_set1_epi8('\n'));
+        __m128i ws = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')),
+                         _mm_cmpeq_epi8(x, _mm_set1_epi8('\t'))), nl);
+
+        uint32_t stop = ~_mm_movemask_epi8(ws) & 0xFFFF;
+        uint32_t newlines = _mm_movemask_epi8(nl);
+        if (stop) {
+            unsigned i = __builtin_ctz(stop);
+            lines += __builtin_popcount(newlines & ((1u << i) - 1));
+            return B + i;
+        }
+
+        lines += __builtin_popcount(newlines);
+    }
+
+    return whitespaceScalar(B, E, lines);
+}
+
+const char *identifierSSE2(const char *B, const char *E) {
+    for (; E - B >= 16; B += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(B));
+        uint32_t stop = ~_mm_movemask_epi8(isIdentifier128(x)) & 0xFFFF;
+        if (stop)
+            return B + __builtin_ctz(stop);
+    }
+
+    return identifierScalar(B, E);
+}
+
+const char *lineEndSSE2(const char *B, const char *E) {
+    for (; E - B >= 16; B += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(B));
+        uint32_t stop = _mm_movemask_epi8(_mm_or_si128(
+            _mm_cmpeq_epi8(x, _mm_set1_epi8('\n')),
+            _mm_cmpeq_epi8(x, _mm_setzero_si128())));
+        if (stop)
+            return B + __builtin_ctz(stop);
+    }
+
+    return lineEndScalar(B, E);
+}
+
+const char *stringEndSSE2(const char *B, const char *E) {
+    for (; E - B >= 16; B += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(B));
+        uint32_t stop = _mm_movemask_epi8(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('"')),
+                         _mm_cmpeq_epi8(x, _mm_set1_epi8('\\'))),
+            _mm_cmpeq_epi8(x, _mm_setzero_si128())));
+        if (stop)
+            return B + __builtin_ctz(stop);
+    }
+
+    return stringEndScalar(B, E);
+}
+
+constexpr Kernels g_SSE2 = {
+    whitespaceSSE2, identifierSSE2, lineEndSSE2, stringEndSSE2
+};
+
+#define AVX2 __attribute__((target("avx2")))
+
+AVX2 inline __m256i inRange256(__m256i x, char lo, char hi) {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8(lo - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), x));
+}
+
+AVX2 inline __m256i isIdentifier256(__m256i x) {
+    __m256i lower = _mm256_or_si256(x, _mm256_set1_epi8(0x20));
+    return _mm256_or_si256(
+        _mm256_or_si256(inRange256(lower, 'a', 'z'), inRange256(x, '0', '9')),
+        _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_')));
+}
+
+AVX2 const char *whitespaceAVX2(const char *B, const char *E, unsigned &lines) {
+    for (; E - B >= 32; B += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(B));
+        __m256i nl = _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\n'));
+        __m256i ws = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')),
+                            _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\t'))), nl);
+
+        uint32_t stop = ~static_cast<uint32_t>(_mm256_movemask_epi8(ws));
+        uint32_t newlines = _mm256_movemask_epi8(nl);
+        if (stop) {
+            unsigned i = __builtin_ctz(stop);
+            lines += __builtin_popcount(newlines & ((1u << i) - 1));
+            return B + i;
+        }
+
+        lines += __builtin_popcount(newlines);
+    }
+
+    return whitespaceSSE2(B, E, lines);
+}
+
+AVX2 const char *identifierAVX2(const char *B, const char *E) {
+    for (; E - B >= 32; B += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(B));
+        uint32_t stop = ~static_cast<uint32_t>(
+            _mm256_movemask_epi8(isIdentifier256(x)));
+        if (stop)
+            return B + __builtin_ctz(stop);
+    }
+
+    return identifierSSE2(B, E);
+}
+
+AVX2 const char *lineEndAVX2(const char *B, const char *E) {
+    for (; E - B >= 32; B += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(B));
+        uint32_t stop = _mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\n')),
+            _mm256_cmpeq_epi8(x, _mm256_setzero_si256())));
+        if (stop)
+            return B + __builtin_ctz(stop);
+    }
+
+    return lineEndSSE2(B, E);
+}
+
+AVX2 const char *stringEndAVX2(const char *B, const char *E) {
+    for (; E - B >= 32; B += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(B));
+        uint32_t stop = _mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('"')),
+                            _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\\'))),
+            _mm256_cmpeq_epi8(x, _mm256_setzero_si256())));
+        if (stop)
+            return B + __builtin_ctz(stop);
+    }
+
+    return stringEndSSE2(B, E);
+}
+
+#undef AVX2
+
+constexpr Kernels g_AVX2 = {
+    whitespaceAVX2, identifierAVX2, lineEndAVX2, stringEndAVX2
+};
+
+#endif // MEDDLE_SCAN_X86
+
+const Kernels *getKernels(ScanLevel L) {
+    switch (L) {
+#ifdef MEDDLE_SCAN_X86
+    case ScanLevel::AVX2:
+        return &g_AVX2;
+    case ScanLevel::SSE2:
+        return &g_SSE2;
+#endif
+    default:
+        return &g_Scalar;
+    }
+}
+
+ScanLevel g_Level = getBestScanLevel();
+const Kernels *g_Kernels = getKernels(g_Level);
+
+} // namespace
+
+ScanLevel meddle::getBestScanLevel() {
+#ifdef MEDDLE_SCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return ScanLevel::AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return ScanLevel::SSE2;
+#endif
+    return ScanLevel::Scalar;
+}
+
+ScanLevel meddle::getScanLevel() { return g_Level; }
+
+void meddle::setScanLevel(ScanLevel L) {
+    ScanLevel best = getBestScanLevel();
+    g_Level = L > best ? best : L;
+    g_Kernels = getKernels(g_Level);
+}
+
+const char *meddle::scanWhitespace(const char *B, const char *E,
+                                   unsigned &lines) {
+    return g_Kernels->whitespace(B, E, lines);
+}
+
+const char *meddle::scanIdentifier(const char *B, const char *E) {
+    return g_Kernels->identifier(B, E);
+}
+
+const char *meddle::scanLineEnd(const char *B, const char *E) {
+    return g_Kernels->lineEnd(B, E);
+}
+
+const char *meddle::scanStringEnd(const char *B, const char *E) {
+    return g_Kernels->stringEnd(B, E);
+}
@@ -0,0 +1,44 @@
+#ifndef MEDDLE_SCAN_H
+#define MEDDLE_SCAN_H
+
+namespace meddle {
+
+/// The instruction set levels available to the byte scanning kernels.
+enum class ScanLevel {
+    Scalar = 0,
+    SSE2,
+    AVX2,
+};
+
+/// \returns The best scan level supported by the host processor.
+ScanLevel getBestScanLevel();
+
+/// \returns The scan level currently used by the lexer.
+ScanLevel getScanLevel();
+
+/// Set the scan level used by the lexer. Levels above what the host supports
+/// are clamped to the best supported level. This is not thread-safe and is
+/// intended for tests and benchmarks.
+void setScanLevel(ScanLevel L);
+
+/// Skip spaces, tabs and newlines in [B, E) and add the number of skipped
+/// newlines to \p lines.
+///
+/// \returns A pointer to the first non-whitespace character, or \p E.
+const char *scanWhitespace(const char *B, const char *E, unsigned &lines);
+
+/// \returns A pointer to the first character in [B, E) which cannot continue
+/// an identifier, or \p E.
+const char *scanIdentifier(const char *B, const char *E);
+
+/// \returns A pointer to the first newline or null character in [B, E), or
+/// \p E.
+const char *scanLineEnd(const char *B, const char *E);
+
+/// \returns A pointer to the first '"', '\\' or null character in [B, E), or
+/// \p E.
+const char *scanStringEnd(const char *B, const char *E);
+
+} // namespace meddle
+
+#endif // MEDDLE_SCAN_H
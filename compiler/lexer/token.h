@@ -3,7 +3,9 @@
 
 #include "../core/metadata.h"
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 using String = std::string;
 
@@ -147,23 +149,54 @@ enum class LiteralKind {
     Float,
 };
 
+/// The different keywords and rune names. These are lexed as identifiers, but
+/// classified once by the lexer so the parser can match them by kind.
+enum class KeywordKind : uint8_t {
+    None = 0,
+    Use,
+    Fix,
+    Mut,
+    Break,
+    Continue,
+    If,
+    Else,
+    Match,
+    Ret,
+    Until,
+    Cast,
+    Nil,
+    True,
+    False,
+    Sizeof,
+    /// _
+    Underscore,
+    Associated,
+    NoMangle,
+    Public,
+    Syscall,
+};
+
 struct Token final {
     TokenKind kind;
     LiteralKind literal = LiteralKind::None;
-    String value;
+    KeywordKind keyword = KeywordKind::None;
+    /// The spelling of this token. For most tokens this is a view into the
+    /// source buffer, and for literals with escapes a view of the decoded value.
+    std::string_view value;
     Metadata md;
 
     Token(const Metadata &md) : kind(TokenKind::Eof), md(md) {}
 
-    Token(TokenKind kind, const String &value, const Metadata &md)
+    Token(TokenKind kind, std::string_view value, const Metadata &md)
       : kind(kind), value(value), md(md) {}
 
     Token(
       TokenKind kind, 
       LiteralKind literal, 
-      const String &value,
-      const Metadata &md
-    ) : kind(kind), literal(literal), value(value), md(md) {}
+      std::string_view value,
+      const Metadata &md,
+      KeywordKind keyword = KeywordKind::None
+    ) : kind(kind), literal(literal), keyword(keyword), value(value), md(md) {}
 };
 
 inline String kindToString(TokenKind K) {
@@ -0,0 +1,33 @@
+#include "lexer.h"
+#include "tokenstream.h"
+
+#include <algorithm>
+
+using namespace meddle;
+
+TokenStream::TokenStream(Lexer &L, unsigned window) : m_Lexer(&L) {
+    unsigned capacity = 2;
+    while (capacity < window)
+        capacity <<= 1;
+
+    m_Buffer.assign(capacity, Token(Metadata()));
+}
+
+void TokenStream::produce() {
+    if (m_Hi - m_Lo == m_Buffer.size()) {
+        // The current token must survive, as the parser holds onto it, and so
+        // must everything after a pinned backtracking position.
+        unsigned keep = std::min(m_Pin, m_Iter ? m_Iter - 1 : 0);
+        if (m_Lo < keep) {
+            ++m_Lo;
+        } else {
+            std::vector<Token> ring(m_Buffer.size() * 2, Token(Metadata()));
+            for (unsigned pos = m_Lo; pos != m_Hi; ++pos)
+                ring[pos & (ring.size() - 1)] = slot(pos);
+
+            m_Buffer = std::move(ring);
+        }
+    }
+
+    slot(m_Hi++) = m_Lexer->lex();
+}
@@ -9,37 +9,107 @@
 
 namespace meddle {
 
-class TokenStream final { 
+class Lexer;
+
+/// A stream of tokens with a cursor.
+///
+/// The stream either owns every token of a file, or pulls tokens on demand
+/// from a Lexer into a small lookahead ring. In the streaming mode, only the
+/// current token and anything after a pinned position are kept alive, so the
+/// parser can backtrack to a saved position without the whole file being
+/// materialized.
+class TokenStream final {
     friend class Parser;
-    
+
+    /// The lexer to pull tokens from, or null if every token is in m_Buffer.
+    Lexer *m_Lexer = nullptr;
+
+    /// Every token of the file, or the ring of retained tokens when streaming.
+    /// The ring capacity is always a power of two.
     std::vector<Token> m_Buffer;
     unsigned m_Iter = 0;
 
+    /// The oldest retained and one past the newest lexed token position.
+    unsigned m_Lo = 0;
+    unsigned m_Hi = 0;
+
+    /// The oldest position that must stay retained, if any.
+    unsigned m_Pin = NoPin;
+
+    Token &slot(unsigned pos) { return m_Buffer[pos & (m_Buffer.size() - 1)]; }
+
+    const Token &slot(unsigned pos) const
+    { return m_Buffer[pos & (m_Buffer.size() - 1)]; }
+
+    /// Lex the next token into the ring, dropping the oldest token or growing
+    /// the ring if it is full.
+    void produce();
+
 public:
+    static constexpr unsigned NoPin = ~0u;
+
     TokenStream() : m_Buffer({}) {}
     TokenStream(std::vector<Token> buf) : m_Buffer(std::move(buf)) {}
 
-    const std::vector<Token> &getTokens() const { return m_Buffer; }
+    /// Create a stream which pulls tokens from \p L on demand, with an initial
+    /// lookahead ring of \p window tokens.
+    explicit TokenStream(Lexer &L, unsigned window = 16);
+
+    bool isStreaming() const { return m_Lexer != nullptr; }
+
+    const std::vector<Token> &getTokens() const {
+        assert(!m_Lexer && "Streaming token stream has no token vector.");
+        return m_Buffer;
+    }
 
     /// Get the current token and move the cursor.
     const Token *get() {
-        assert(m_Iter < m_Buffer.size());
-        return &m_Buffer.at(m_Iter++);
+        if (!m_Lexer) {
+            assert(m_Iter < m_Buffer.size());
+            return &m_Buffer[m_Iter++];
+        }
+
+        if (m_Iter == m_Hi)
+            produce();
+
+        assert(m_Iter >= m_Lo && "Token has left the lookahead window.");
+        return &slot(m_Iter++);
     }
 
     /// Get the token at \p pos without moving the cursor.
     const Token *get(unsigned pos) const {
-        assert(pos < m_Buffer.size());
-        return &m_Buffer.at(pos);
+        if (!m_Lexer) {
+            assert(pos < m_Buffer.size());
+            return &m_Buffer.at(pos);
+        }
+
+        assert(pos >= m_Lo && pos < m_Hi && "Token is not retained.");
+        return &slot(pos);
     }
 
-    bool isEnd() const { return m_Iter >= m_Buffer.size(); }
+    /// \returns If every token has been consumed. A streaming token stream
+    /// never ends, and instead repeats its Eof token.
+    bool isEnd() const { return !m_Lexer && m_Iter >= m_Buffer.size(); }
 
     unsigned getPos() const { return m_Iter; }
 
-    void setPos(unsigned pos) { m_Iter = pos; }
+    void setPos(unsigned pos) {
+        assert((!m_Lexer || pos >= m_Lo) && "Token has left the lookahead window.");
+        m_Iter = pos;
+    }
+
+    /// Keep every token from \p pos onwards alive until unpin() is called.
+    void pin(unsigned pos) { m_Pin = pos; }
+
+    void unpin() { m_Pin = NoPin; }
 
-    void add(Token token) { m_Buffer.push_back(token); }
+    /// \returns The number of tokens the ring can currently hold.
+    unsigned getCapacity() const { return m_Buffer.size(); }
+
+    void add(Token token) {
+        assert(!m_Lexer && "Cannot add tokens to a streaming token stream.");
+        m_Buffer.push_back(token);
+    }
 };
 
 } // namespace meddle
@@ -1,12 +1,14 @@
 #include "cgn/codegen.h"
 #include "core/logger.h"
 #include "core/metadata.h"
+#include "core/threadpool.h"
 #include "lexer/lexer.h"
 #include "mir/segment.h"
 #include "parser/parser.h"
 #include "tree/unit.h"
 #include "tree/unitman.h"
 
+#include <charconv>
 #include <chrono>
 #include <cstdlib>
 #include <fstream>
@@ -15,6 +17,15 @@
 using namespace meddle;
 using mir::Target;
 
+static unsigned parse_jobs(const String &arg) {
+    unsigned jobs = 0;
+    auto [ ptr, ec ] = std::from_chars(arg.data(), arg.data() + arg.size(), jobs);
+    if (ec != std::errc() || ptr != arg.data() + arg.size())
+        fatal("invalid job count: '" + arg + "'");
+
+    return jobs;
+}
+
 int main(int argc, char **argv) {
     //if (argc < 2)
     //    fatal("no input files");
@@ -25,22 +36,57 @@ int main(int argc, char **argv) {
         .KeepCC = 1,
         .NamedMIR = 0,
         .Time = 1,
+        .LazySpecs = 1,
     };
 
     std::vector<File> files;
     UnitManager units;
     std::vector<mir::Segment *> segments;
 
-    files.push_back(parseInputFile("samples/one.mdl"));
-    //files.push_back(parseInputFile("samples/two.mdl"));
+    std::vector<String> inputs;
+    for (int i = 1; i < argc; ++i) {
+        String arg = argv[i];
+        if (arg == "-j") {
+            if (++i == argc)
+                fatal("expected job count after '-j'");
+
+            opts.Jobs = parse_jobs(argv[i]);
+        } else if (arg.rfind("-j", 0) == 0) {
+            opts.Jobs = parse_jobs(arg.substr(2));
+        } else if (arg == "--emit-interface") {
+            opts.EmitInterfaces = 1;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
 
-    for (auto &file : files) {
-        Lexer lexer = Lexer(file);
-        Parser parser = Parser(file, lexer.unwrap(&opts));
-        units.addUnit(parser.get());
+    if (inputs.empty())
+        inputs.push_back("samples/one.mdl");
+
+    for (auto &input : inputs)
+        files.push_back(parseInputFile(input));
+
+    // Files are lexed and parsed independently, so each is its own task. The
+    // units are registered afterwards in input order to stay deterministic.
+    std::vector<TranslationUnit *> parsed(files.size(), nullptr);
+    {
+        ThreadPool pool(opts.Jobs);
+        for (unsigned i = 0, e = files.size(); i != e; ++i) {
+            pool.submit([&files, &parsed, &opts, i] {
+                Lexer lexer = Lexer(files[i]);
+                Parser parser = Parser(files[i], lexer, &opts);
+                opts.lexedLines += lexer.getLineCount();
+                parsed[i] = parser.get();
+            });
+        }
+
+        pool.wait();
     }
 
-    log("Lexed " + std::to_string(opts.lexedLines) + " lines across " + 
+    for (auto &unit : parsed)
+        units.addUnit(unit);
+
+    log("Lexed " + std::to_string(opts.lexedLines.get()) + " lines across " + 
         std::to_string(files.size()) + " file(s).");
 
     units.drive(opts);
@@ -53,6 +99,10 @@ int main(int argc, char **argv) {
     );
 
     for (auto &unit : units.getUnits()) {
+        // Interfaces stand in for units lowered by an earlier compilation.
+        if (unit->isInterface())
+            continue;
+
         mir::Segment *seg = new mir::Segment(target);
         assert(seg && "Unable to create segment.");
         CGN *cgn = new CGN(opts, unit, seg);
@@ -3,41 +3,14 @@
 #include "inst.h"
 #include "segment.h"
 
-#include <map>
-
 using namespace mir;
 
-static std::map<String, unsigned> g_Dict = {};
-
-void mir::clear_bb_dict() { g_Dict.clear(); }
-
-BasicBlock::BasicBlock(String N, Function *P) : Value(N, nullptr), m_Parent(P) {
-    if (!N.empty()) {
-        if (g_Dict[N] == 0) {
-            m_Name = N;
-            g_Dict[N] = 1;
-        } else {
-            m_Name = N + std::to_string(g_Dict[N]);
-            g_Dict[N]++;
-        }
-    }
-
+BasicBlock::BasicBlock(const String &N, Function *P) 
+  : Value(N, nullptr), m_Parent(P) {
     if (P)
         P->append(this);
 }
 
-BasicBlock::~BasicBlock() {
-    for (Inst *curr = m_Tail; curr != nullptr; ) {
-        Inst *prev = curr->get_prev();
-        delete curr;
-        curr = prev;
-    }
-}
-
-void BasicBlock::give_ssa(Segment *S) {
-    m_Name = S->get_ssa();
-}
-
 void BasicBlock::append(Inst *I) {
     assert(I && "Instruction cannot be null.");
 
@@ -68,6 +41,24 @@ void BasicBlock::prepend(Inst *I) {
     }
 }
 
+void BasicBlock::remove(Inst *I) {
+    assert(I && I->get_parent() == this && "Instruction is not in this block.");
+
+    if (I->get_prev())
+        I->get_prev()->set_next(I->get_next());
+    else
+        m_Head = I->get_next();
+
+    if (I->get_next())
+        I->get_next()->set_prev(I->get_prev());
+    else
+        m_Tail = I->get_prev();
+
+    I->set_prev(nullptr);
+    I->set_next(nullptr);
+    I->set_parent(nullptr);
+}
+
 void BasicBlock::add_succ(BasicBlock *BB) {
     assert(BB && "Basic block cannot be null.");
     assert(BB != this && "Cannot add itself as a successor.");
@@ -122,5 +113,20 @@ void BasicBlock::detach() {
         m_Parent->set_tail(m_Prev);
     }
 
-    delete this;
+    // Instructions may refer to others later in the block, so every operand
+    // is dropped before anything is destroyed.
+    for (Inst *curr = m_Head; curr != nullptr; curr = curr->get_next())
+        curr->drop_operands();
+
+    assert(!is_used() && "Basic block is still branched to.");
+
+    Segment *S = m_Parent->get_parent();
+    for (Inst *curr = m_Tail; curr != nullptr; ) {
+        Inst *prev = curr->get_prev();
+        assert(!curr->is_used() && "Instruction is used outside its block.");
+        S->destroy(curr);
+        curr = prev;
+    }
+
+    S->destroy(this);
 }
@@ -24,12 +24,8 @@ class BasicBlock final : public Value {
     std::vector<BasicBlock *> m_Succs = {};
 
 public:
-    BasicBlock(String N, Function *P = nullptr);
+    BasicBlock(const String &N, Function *P = nullptr);
 
-    ~BasicBlock() override;
-
-    void give_ssa(Segment *S);
-    
     Function *get_parent() const { return m_Parent; }
 
     void set_parent(Function *F) { m_Parent = F; }
@@ -64,6 +60,9 @@ public:
 
     void prepend(Inst *I);
 
+    /// Unlink \p I from this block, without destroying it.
+    void remove(Inst *I);
+
     /// Add a new successor to this block.
     void add_succ(BasicBlock *BB);
 
@@ -76,14 +75,13 @@ public:
     /// \returns The number of terminators in this block.
     unsigned terminators() const;
 
-    /// Detach this block from its parent function and delete it.
+    /// Detach this block from its parent function and destroy it, along with
+    /// its instructions.
     void detach();
 
     void print(std::ostream &OS) const override;
 };
 
-void clear_bb_dict();
-
 } // namespace mir
 
 #endif // MEDDLE_BASICBLOCK_H
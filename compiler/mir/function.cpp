@@ -6,7 +6,7 @@
 
 using namespace mir;
 
-Function::Function(String N, FunctionType *FT, Linkage L, Segment *P, 
+Function::Function(const String &N, FunctionType *FT, Linkage L, Segment *P, 
                    std::vector<Argument *> Args) 
     : Value(N, FT), m_Linkage(L), m_Parent(P), m_Args(Args) 
 {
@@ -14,42 +14,25 @@ Function::Function(String N, FunctionType *FT, Linkage L, Segment *P,
         m_Parent->add_function(this);
 };
 
-Function::~Function() {
-    for (auto &[ String, slot ] : m_Slots)
-        delete slot;
-
-    for (BasicBlock *curr = m_Tail; curr != nullptr; ) {
-        BasicBlock *prev = curr->get_prev();
-        delete curr;
-        curr = prev;
-    }
-}
-
 void Function::add_slot(Slot *S) {
+    m_Slots.push_back(S);
+    if (!S->is_named())
+        return;
+
     assert(get_slot(S->get_name()) == nullptr && 
            "Slot with name already exists.");
 
-    m_Slots[S->get_name()] = S;
+    m_NamedSlots[S->get_name()] = S;
 }
 
-Slot *Function::get_slot(String N) const {
-    auto it = m_Slots.find(N);
-    if (it != m_Slots.end())
+Slot *Function::get_slot(const String &N) const {
+    auto it = m_NamedSlots.find(N);
+    if (it != m_NamedSlots.end())
         return it->second;
 
     return nullptr;
 }
 
-std::vector<Slot *> Function::get_slots() const {
-    std::vector<Slot *> slots;
-    slots.reserve(m_Slots.size());
-
-    for (auto &[String, slot] : m_Slots)
-        slots.push_back(slot);
-
-    return slots;
-}
-
 void Function::append(BasicBlock *BB) {
     assert(BB && "BasicBlock cannot be null.");
 
@@ -65,8 +48,8 @@ void Function::append(BasicBlock *BB) {
 
     BB->set_parent(this);
 
-    if (BB->get_name().empty())
-        BB->give_ssa(m_Parent);
+    if (!BB->is_named() && !BB->is_numbered())
+        BB->set_number(m_Parent->get_ssa());
 }
 
 void Function::prepend(BasicBlock *BB) {
@@ -84,8 +67,8 @@ void Function::prepend(BasicBlock *BB) {
 
     BB->set_parent(this);
 
-    if (BB->get_name().empty())
-        BB->give_ssa(m_Parent);
+    if (!BB->is_named() && !BB->is_numbered())
+        BB->set_number(m_Parent->get_ssa());
 }
 
 void Function::detach() {
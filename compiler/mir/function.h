@@ -55,7 +55,8 @@ class Argument final : public Value {
     Slot *m_Slot;
 
 public:
-    Argument(String N, Type *T, Function *P, unsigned I, Slot *S = nullptr)
+    Argument(const String &N, Type *T, Function *P, unsigned I, 
+             Slot *S = nullptr)
         : Value(N, T), m_Parent(P), m_Index(I), m_Slot(S) {}
 
     const Attributes &get_attrs() const { return m_Attrs; }
@@ -95,19 +96,20 @@ private:
     /// The arguments to this function.
     std::vector<Argument *> m_Args;
 
-    /// The slot nodes of this function.
-    std::unordered_map<String, Slot *> m_Slots = {};
+    /// The slot nodes of this function, in the order they were added.
+    std::vector<Slot *> m_Slots = {};
+
+    /// The named slot nodes of this function, by name.
+    std::unordered_map<String, Slot *> m_NamedSlots = {};
 
     /// The head and tail blocks of this function.
     BasicBlock *m_Head = nullptr;
     BasicBlock *m_Tail = nullptr;
 
 public:
-    Function(String N, FunctionType *FT, Linkage L, Segment *P, 
+    Function(const String &N, FunctionType *FT, Linkage L, Segment *P, 
              std::vector<Argument *> Args);
 
-    ~Function() override;
-
     const Attributes &get_attrs() const { return m_Attrs; }
 
     Segment *get_parent() const { return m_Parent; }
@@ -122,9 +124,9 @@ public:
 
     void add_slot(Slot *S);
 
-    Slot *get_slot(String N) const;
+    Slot *get_slot(const String &N) const;
 
-    std::vector<Slot *> get_slots() const;
+    const std::vector<Slot *> &get_slots() const { return m_Slots; }
 
     Type *get_return_ty() const 
     { return static_cast<FunctionType *>(m_Type)->get_return_type(); }
@@ -142,7 +144,8 @@ public:
 
     void prepend(BasicBlock *BB);
     
-    /// Detach this function from its parent segment and delete it.
+    /// Detach this function from its parent segment and destroy it, along 
+    /// with its arguments, slots and blocks.
     void detach();
 
     void print(std::ostream &OS) const override;
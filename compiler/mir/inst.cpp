@@ -1,31 +1,86 @@
 #include "basicblock.h"
+#include "function.h"
 #include "inst.h"
+#include "segment.h"
 #include "type.h"
 
 #include <cassert>
-#include <map>
 
 using namespace mir;
 
-static std::map<String, unsigned> g_Dict = {};
-
-void mir::clear_inst_dict() { g_Dict.clear(); }
-
-Inst::Inst(BasicBlock *P) : Value("", nullptr), m_Parent(P) {
+Inst::Inst(InstKind K, BasicBlock *P) 
+  : Value("", nullptr), m_InstKind(K), m_Parent(P) {
     m_Parent->append(this);
 }
 
-Inst::Inst(String N, Type *T, BasicBlock *P) : Value(N, T), m_Parent(P) {
+Inst::Inst(InstKind K, const String &N, Type *T, BasicBlock *P) 
+  : Value(N, T), m_InstKind(K), m_Parent(P) {
     m_Parent->append(this);
+}
+
+bool Inst::produces_value() const {
+    return m_Type && !m_Type->is_void_ty();
+}
+
+void Inst::drop_operands() {
+    for (Use *U = op_begin(); U != op_end(); ++U)
+        U->set(nullptr);
+}
+
+void Inst::erase_from_parent() {
+    assert(m_Parent && "Instruction has no parent.");
+    assert(!is_used() && "Instruction still has uses.");
+
+    Segment *S = m_Parent->get_parent()->get_parent();
+    m_Parent->remove(this);
+    drop_operands();
+    S->destroy(this);
+}
+
+void PHINode::add_incoming(Value *V, BasicBlock *BB) {
+    assert(V->get_type() == m_Type && "PHI node type mismatch.");
 
-    if (N.empty())
-        return;
+    if (m_NumOperands == m_Capacity) {
+        // Linked uses cannot be moved, so relink each of them in a larger
+        // array instead.
+        unsigned capacity = m_Capacity ? m_Capacity * 2 : 2;
+        std::unique_ptr<Use[]> values(new Use[capacity]);
+        for (unsigned i = 0; i != m_NumOperands; ++i) {
+            values[i].set(m_Values[i].get());
+            m_Values[i].set(nullptr);
+        }
 
-    if (g_Dict[N] == 0) {
-        m_Name = N;
-        g_Dict[N] = 1;
-    } else {
-        m_Name = N + std::to_string(g_Dict[N]);
-        g_Dict[N]++;
+        m_Values = std::move(values);
+        m_Capacity = capacity;
+        set_operand_list(m_Values.get(), m_NumOperands);
     }
+
+    m_Values[m_NumOperands].set_user(this);
+    m_Values[m_NumOperands++].set(V);
+    m_Blocks.push_back(BB);
+}
+
+BrifInst::BrifInst(BasicBlock *P, Value *C, BasicBlock *T, BasicBlock *F)
+  : Inst(InstKind::Brif, P) {
+    set_operand_list(m_Ops, 3);
+    m_Ops[0].set(C);
+    m_Ops[1].set(T);
+    m_Ops[2].set(F);
+}
+
+BasicBlock *BrifInst::get_true_dest() const {
+    return static_cast<BasicBlock *>(m_Ops[1].get());
+}
+
+BasicBlock *BrifInst::get_false_dest() const {
+    return static_cast<BasicBlock *>(m_Ops[2].get());
+}
+
+JMPInst::JMPInst(BasicBlock *P, BasicBlock *D) : Inst(InstKind::JMP, P) {
+    set_operand_list(m_Ops, 1);
+    m_Ops[0].set(D);
+}
+
+BasicBlock *JMPInst::get_dest() const {
+    return static_cast<BasicBlock *>(m_Ops[0].get());
 }
@@ -3,7 +3,9 @@
 
 #include "value.h"
 
+#include <cstdint>
 #include <fstream>
+#include <memory>
 #include <ostream>
 #include <utility>
 
@@ -11,10 +13,29 @@ namespace mir {
 
 class BasicBlock;
 
+/// The kind of an instruction.
+enum class InstKind : uint8_t {
+    PHI,
+    AP,
+    Store,
+    Load,
+    Cpy,
+    Syscall,
+    Brif,
+    JMP,
+    Ret,
+    Call,
+    Binop,
+    Unop,
+    CMP,
+};
+
 class Inst : public Value {
     friend class Builder;
 
 protected:
+    InstKind m_InstKind;
+
     /// The parent basic block of this instruction.
     BasicBlock *m_Parent;
 
@@ -22,18 +43,33 @@ protected:
     Inst *m_Prev = nullptr;
     Inst *m_Next = nullptr;
 
-    Inst(BasicBlock *P);
+    /// The operands of this instruction. Instructions with a fixed number of
+    /// operands keep them inline, and the rest in an array of their own.
+    Use *m_Operands = nullptr;
+    unsigned m_NumOperands = 0;
+
+    Inst(InstKind K, BasicBlock *P);
+
+    Inst(InstKind K, const String &N, Type *T, BasicBlock *P);
 
-    Inst(String N, Type *T, BasicBlock *P);
+    /// Adopt the \p N uses at \p Ops as the operands of this instruction.
+    void set_operand_list(Use *Ops, unsigned N) {
+        m_Operands = Ops;
+        m_NumOperands = N;
+        for (unsigned i = 0; i != N; ++i)
+            Ops[i].set_user(this);
+    }
 
 public:
     virtual ~Inst() = default;
 
+    InstKind get_inst_kind() const { return m_InstKind; }
+
     virtual bool is_terminator() const { return false; }
 
     virtual bool is_ret() const { return false; }
 
-    virtual bool produces_value() const { return is_named(); }
+    virtual bool produces_value() const;
 
     BasicBlock *get_parent() const { return m_Parent; }
 
@@ -46,59 +82,94 @@ public:
     void set_prev(Inst *I) { m_Prev = I; }
 
     void set_next(Inst *I) { m_Next = I; }
+
+    unsigned get_num_operands() const { return m_NumOperands; }
+
+    Value *get_operand(unsigned i) const {
+        assert(i < m_NumOperands && "Operand index out of bounds.");
+        return m_Operands[i].get();
+    }
+
+    void set_operand(unsigned i, Value *V) {
+        assert(i < m_NumOperands && "Operand index out of bounds.");
+        m_Operands[i].set(V);
+    }
+
+    Use *op_begin() const { return m_Operands; }
+
+    Use *op_end() const { return m_Operands + m_NumOperands; }
+
+    /// Remove this instruction from the use lists of all of its operands.
+    void drop_operands();
+
+    /// Unlink this instruction from its parent block, drop its operands and
+    /// recycle it. The instruction must not have any uses left.
+    void erase_from_parent();
 };
 
 class PHINode final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    std::vector<std::pair<Value *, BasicBlock *>> m_Incoming;
+    /// The incoming values, which are the operands of this node, and the
+    /// blocks they come from.
+    std::unique_ptr<Use[]> m_Values;
+    std::vector<BasicBlock *> m_Blocks = {};
+    unsigned m_Capacity = 0;
 
     PHINode(
-        String N,
+        const String &N,
         Type *T,
         BasicBlock *P
-    ) : Inst(N, T, P), m_Incoming() {}
+    ) : Inst(InstKind::PHI, N, T, P) {}
 
 public:
-    void add_incoming(Value *V, BasicBlock *BB) {
-        assert(V->get_type() == this->m_Type && "PHI node type mismatch.");
-        m_Incoming.emplace_back(V, BB);
-    }
+    void add_incoming(Value *V, BasicBlock *BB);
 
-    const std::vector<std::pair<Value *, BasicBlock *>> &get_incoming() const 
-    { return m_Incoming; }
+    unsigned get_num_incoming() const { return m_NumOperands; }
+
+    Value *get_incoming_value(unsigned i) const { return get_operand(i); }
+
+    BasicBlock *get_incoming_block(unsigned i) const {
+        assert(i < m_Blocks.size() && "Incoming index out of bounds.");
+        return m_Blocks[i];
+    }
 
     void print(std::ostream &OS) const override;
 };
 
 class APInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    Value *m_Source;
-    Value *m_Idx;
+    Use m_Ops[2];
 
     APInst(
-        String N,
+        const String &N,
         Type *T,
         BasicBlock *P,
         Value *S,
         Value *Idx
-    ) : Inst(N, T, P), m_Source(S), m_Idx(Idx) {}
+    ) : Inst(InstKind::AP, N, T, P) {
+        set_operand_list(m_Ops, 2);
+        m_Ops[0].set(S);
+        m_Ops[1].set(Idx);
+    }
 
 public:
-    Value *get_source() const { return m_Source; }
+    Value *get_source() const { return m_Ops[0]; }
 
-    Value *get_index() const { return m_Idx; }
+    Value *get_index() const { return m_Ops[1]; }
 
     void print(std::ostream &OS) const override;
 };
 
 class StoreInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    Value *m_Value;
-    Value *m_Dest;
-    ConstantInt *m_Offset;
+    /// The stored value, the destination, and the offset if there is one.
+    Use m_Ops[3];
     unsigned m_Align;
 
     StoreInst(
@@ -107,42 +178,64 @@ class StoreInst final : public Inst {
         Value *D,
         ConstantInt *O = nullptr,
         unsigned Align = 0
-    ) : Inst(P), m_Value(V), m_Dest(D), m_Offset(O), m_Align(Align) {}
+    ) : Inst(InstKind::Store, P), m_Align(Align) {
+        set_operand_list(m_Ops, O ? 3 : 2);
+        m_Ops[0].set(V);
+        m_Ops[1].set(D);
+        if (O)
+            m_Ops[2].set(O);
+    }
 
 public:
-    Value *get_value() const { return m_Value; }
+    Value *get_value() const { return m_Ops[0]; }
 
-    Value *get_dest() const { return m_Dest; }
+    Value *get_dest() const { return m_Ops[1]; }
 
-    bool has_offset() const { return m_Offset != nullptr; }
+    bool has_offset() const { return m_NumOperands == 3; }
 
-    ConstantInt *get_offset() const { return m_Offset; }
+    ConstantInt *get_offset() const {
+        if (!has_offset())
+            return nullptr;
+
+        return static_cast<ConstantInt *>(m_Ops[2].get());
+    }
 
     unsigned get_align() const { return m_Align; }
 };
 
 class LoadInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    Value *m_Source;
-    ConstantInt *m_Offset;
+    /// The source, and the offset if there is one.
+    Use m_Ops[2];
     unsigned m_Align;
 
     LoadInst(
-        String N,
+        const String &N,
         Type *T,
         BasicBlock *P,
         Value *S,
         ConstantInt *O = nullptr,
         unsigned Align = 0
-    ) : Inst(N, T, P), m_Source(S), m_Offset(O), m_Align(Align) {}
+    ) : Inst(InstKind::Load, N, T, P), m_Align(Align) {
+        set_operand_list(m_Ops, O ? 2 : 1);
+        m_Ops[0].set(S);
+        if (O)
+            m_Ops[1].set(O);
+    }
 
 public:
-    Value *get_source() const { return m_Source; }
+    Value *get_source() const { return m_Ops[0]; }
+
+    bool has_offset() const { return m_NumOperands == 2; }
 
-    bool has_offset() const { return m_Offset != nullptr; }
+    ConstantInt *get_offset() const {
+        if (!has_offset())
+            return nullptr;
 
-    ConstantInt *get_offset() const { return m_Offset; }
+        return static_cast<ConstantInt *>(m_Ops[1].get());
+    }
 
     unsigned get_align() const { return m_Align; }
 
@@ -151,12 +244,12 @@ public:
 
 class CpyInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    Value *m_Source;
+    /// The source, the destination and the size.
+    Use m_Ops[3];
     unsigned m_SrcAlign;
-    Value *m_Dest;
     unsigned m_DestAlign;
-    Value *m_Size;
 
     CpyInst(
         BasicBlock *P,
@@ -165,117 +258,143 @@ class CpyInst final : public Inst {
         Value *D,
         unsigned DAL,
         Value *Sz
-    ) : Inst(P), m_Source(S), m_SrcAlign(SAL), m_Dest(D), m_DestAlign(DAL), 
-        m_Size(Sz) {}
+    ) : Inst(InstKind::Cpy, P), m_SrcAlign(SAL), m_DestAlign(DAL) {
+        set_operand_list(m_Ops, 3);
+        m_Ops[0].set(S);
+        m_Ops[1].set(D);
+        m_Ops[2].set(Sz);
+    }
 
 public:
-    Value *get_source() const { return m_Source; }
+    Value *get_source() const { return m_Ops[0]; }
 
     unsigned get_source_align() const { return m_SrcAlign; }
 
-    Value *get_dest() const { return m_Dest; }
+    Value *get_dest() const { return m_Ops[1]; }
 
     unsigned get_dest_align() const { return m_DestAlign; }
 
-    Value *get_size() const { return m_Size; }
+    Value *get_size() const { return m_Ops[2]; }
 };
 
 class SyscallInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    Value *m_Num;
-    std::vector<Value *> m_Args;
+    /// The syscall number followed by the arguments.
+    std::unique_ptr<Use[]> m_Ops;
 
     SyscallInst(
-        String N,
+        const String &N,
         Type *T,
         BasicBlock *P,
         Value *Num,
-        std::vector<Value *> Args
-    ) : Inst(N, T, P), m_Num(Num), m_Args(std::move(Args)) {}
+        const std::vector<Value *> &Args
+    ) : Inst(InstKind::Syscall, N, T, P), m_Ops(new Use[Args.size() + 1]) {
+        set_operand_list(m_Ops.get(), Args.size() + 1);
+        m_Ops[0].set(Num);
+        for (unsigned i = 0, n = Args.size(); i != n; ++i)
+            m_Ops[i + 1].set(Args[i]);
+    }
 
 public:
-    Value *get_num() const { return m_Num; }
+    Value *get_num() const { return m_Ops[0]; }
+
+    unsigned get_num_args() const { return m_NumOperands - 1; }
 
-    const std::vector<Value *> &get_args() const { return m_Args; }
+    Value *get_arg(unsigned i) const { return get_operand(i + 1); }
 
     void print(std::ostream &OS) const override;
 };
 
 class BrifInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    Value *m_Cond;
-    BasicBlock *m_True;
-    BasicBlock *m_False;
+    /// The condition, and the true and false destinations.
+    Use m_Ops[3];
 
-    BrifInst(BasicBlock *P, Value *C, BasicBlock *T, BasicBlock *F)
-      : Inst(P), m_Cond(C), m_True(T), m_False(F) {}
+    BrifInst(BasicBlock *P, Value *C, BasicBlock *T, BasicBlock *F);
 
 public:
     bool is_terminator() const override { return true; }
 
-    Value *get_cond() const { return m_Cond; }
+    Value *get_cond() const { return m_Ops[0]; }
 
-    BasicBlock *get_true_dest() const { return m_True; }
+    BasicBlock *get_true_dest() const;
 
-    BasicBlock *get_false_dest() const { return m_False; }
+    BasicBlock *get_false_dest() const;
 };
 
 class JMPInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    BasicBlock *m_Dest;
+    Use m_Ops[1];
 
-    JMPInst(BasicBlock *P, BasicBlock *D) : Inst(P), m_Dest(D) {}
+    JMPInst(BasicBlock *P, BasicBlock *D);
 
 public:
     bool is_terminator() const override { return true; }
 
-    BasicBlock *get_dest() const { return m_Dest; }
+    BasicBlock *get_dest() const;
 };
 
 class RetInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    Value *m_Value;
+    Use m_Ops[1];
 
-    RetInst(BasicBlock *P, Value *V = nullptr) : Inst(P), m_Value(V) {} 
+    RetInst(BasicBlock *P, Value *V = nullptr) : Inst(InstKind::Ret, P) {
+        set_operand_list(m_Ops, V ? 1 : 0);
+        if (V)
+            m_Ops[0].set(V);
+    }
 
 public:
     bool is_terminator() const override { return true; }
 
     bool is_ret() const override { return true; }
 
-    bool is_void() const { return m_Value == nullptr; }
+    bool is_void() const { return m_NumOperands == 0; }
 
-    Value *get_value() const { return m_Value; }
+    Value *get_value() const { return is_void() ? nullptr : m_Ops[0].get(); }
 };
 
 class CallInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
-    Value *m_Callee;
-    std::vector<Value *> m_Args;
+    /// The callee followed by the arguments.
+    std::unique_ptr<Use[]> m_Ops;
 
     CallInst(
-        String N,
+        const String &N,
         Type *T,
         BasicBlock *P,
         Value *C,
-        std::vector<Value *> A
-    ) : Inst(N, T, P), m_Callee(C), m_Args(std::move(A)) {}
+        const std::vector<Value *> &A
+    ) : Inst(InstKind::Call, N, T, P), m_Ops(new Use[A.size() + 1]) {
+        set_operand_list(m_Ops.get(), A.size() + 1);
+        m_Ops[0].set(C);
+        for (unsigned i = 0, n = A.size(); i != n; ++i)
+            m_Ops[i + 1].set(A[i]);
+    }
 
 public:
-    Value *get_callee() const { return m_Callee; }
+    Value *get_callee() const { return m_Ops[0]; }
+
+    unsigned get_num_args() const { return m_NumOperands - 1; }
 
-    const std::vector<Value *> &get_args() const { return m_Args; }
+    Value *get_arg(unsigned i) const { return get_operand(i + 1); }
 
     void print(std::ostream &OS) const override;
 };
 
 class BinopInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
 public:
     enum class Kind {
@@ -303,24 +422,28 @@ public:
 
 private:
     Kind m_Kind;
-    Value *m_LVal;
-    Value *m_RVal;
+    Use m_Ops[2];
 
-    BinopInst(String N, Type *T, BasicBlock *P, Kind K, Value *L, Value *R)
-      : Inst(N, T, P), m_Kind(K), m_LVal(L), m_RVal(R) {}
+    BinopInst(const String &N, Type *T, BasicBlock *P, Kind K, Value *L, Value *R)
+      : Inst(InstKind::Binop, N, T, P), m_Kind(K) {
+        set_operand_list(m_Ops, 2);
+        m_Ops[0].set(L);
+        m_Ops[1].set(R);
+    }
 
 public:
     Kind get_kind() const { return m_Kind; }
 
-    Value *get_lval() const { return m_LVal; }
+    Value *get_lval() const { return m_Ops[0]; }
 
-    Value *get_rval() const { return m_RVal; }
+    Value *get_rval() const { return m_Ops[1]; }
 
     void print(std::ostream &OS) const override;
 };
 
 class UnopInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
 public:
     enum class Kind {
@@ -344,21 +467,25 @@ public:
 
 private:
     Kind m_Kind;
-    Value *m_Value;
+    Use m_Ops[1];
 
-    UnopInst(String N, Type *T, BasicBlock *P, Kind K, Value *V)
-      : Inst(N, T, P), m_Kind(K), m_Value(V) {}
+    UnopInst(const String &N, Type *T, BasicBlock *P, Kind K, Value *V)
+      : Inst(InstKind::Unop, N, T, P), m_Kind(K) {
+        set_operand_list(m_Ops, 1);
+        m_Ops[0].set(V);
+    }
 
 public:
     Kind get_kind() const { return m_Kind; }
 
-    Value *get_value() const { return m_Value; }
+    Value *get_value() const { return m_Ops[0]; }
 
     void print(std::ostream &OS) const override;
 };
 
 class CMPInst final : public Inst {
     friend class Builder;
+    friend class Pool;
 
 public:
     enum class Kind {
@@ -390,24 +517,25 @@ public:
 
 private:
     Kind m_Kind;
-    Value *m_LVal;
-    Value *m_RVal;
+    Use m_Ops[2];
 
-    CMPInst(String N, Type *T, BasicBlock *P, Kind K, Value *LV, Value *RV)
-      : Inst(N, T, P), m_Kind(K), m_LVal(LV), m_RVal(RV) {}
+    CMPInst(const String &N, Type *T, BasicBlock *P, Kind K, Value *LV, Value *RV)
+      : Inst(InstKind::CMP, N, T, P), m_Kind(K) {
+        set_operand_list(m_Ops, 2);
+        m_Ops[0].set(LV);
+        m_Ops[1].set(RV);
+    }
 
 public:
     Kind get_kind() const { return m_Kind; }
 
-    Value *get_lval() const { return m_LVal; }
+    Value *get_lval() const { return m_Ops[0]; }
 
-    Value *get_rval() const { return m_RVal; }
+    Value *get_rval() const { return m_Ops[1]; }
 
     void print(std::ostream &OS) const override;
 };
 
-void clear_inst_dict();
-
 } // namespace mir
 
 #endif // MEDDLE_INST_H
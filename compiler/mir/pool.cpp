@@ -0,0 +1,63 @@
+#include "pool.h"
+
+#include <cstdlib>
+
+using namespace mir;
+
+void *Pool::allocate_slow(size_t size) {
+    // Oversized objects get a slab of their own, so that the rest of the
+    // current slab is not wasted. Memory from malloc is aligned for any
+    // object, so the start of a slab is always suitably aligned.
+    bool oversized = size > SlabSize / 4;
+    size_t slab_size = oversized ? size : SlabSize;
+    char *slab = static_cast<char *>(std::malloc(slab_size));
+    if (!slab)
+        throw std::bad_alloc();
+
+    m_Reserved += slab_size;
+
+    // The current slab is always the last one, and is only closed off once
+    // the pool moves on from it.
+    if (oversized) {
+        Slab S = { slab, slab + size };
+        m_Slabs.insert(m_Ptr ? m_Slabs.end() - 1 : m_Slabs.end(), S);
+        return slab + sizeof(Destroy);
+    }
+
+    if (m_Ptr)
+        m_Slabs.back().end = m_Ptr;
+
+    m_Slabs.push_back({ slab, nullptr });
+    m_Ptr = slab + size;
+    m_End = slab + slab_size;
+    return slab + sizeof(Destroy);
+}
+
+void Pool::reset() {
+    if (m_Ptr)
+        m_Slabs.back().end = m_Ptr;
+
+    // Values refer to each other, so nothing is released until every
+    // destructor has run.
+    for (Slab &S : m_Slabs) {
+        for (char *ptr = S.begin; ptr != S.end; ) {
+            char *obj = ptr + sizeof(Destroy);
+            if (Destroy destroy = header(obj))
+                ptr = obj + destroy(obj);
+            else
+                ptr = obj + reinterpret_cast<FreeSlot *>(obj)->size;
+        }
+    }
+
+    for (Slab &S : m_Slabs)
+        std::free(S.begin);
+
+    m_Slabs.clear();
+    m_Ptr = m_End = nullptr;
+    for (FreeSlot *&head : m_Free)
+        head = nullptr;
+
+    m_Live = 0;
+    m_Recycled = 0;
+    m_Reserved = 0;
+}
@@ -0,0 +1,159 @@
+#ifndef MEDDLE_POOL_H
+#define MEDDLE_POOL_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace mir {
+
+/// A slab allocator for the values of a segment.
+///
+/// Objects are bump-allocated out of large slabs, and each one is preceded by
+/// a word that knows how to destroy it and how large it is. An object that is
+/// destroyed early leaves its storage on a free list for its size class, to
+/// be reused by the next object of the same size, so passes that delete and
+/// rebuild instructions do not grow the pool. reset() walks the slabs once to
+/// run the destructors of live objects, and then hands every slab back.
+///
+/// A pool is not thread-safe.
+class Pool final {
+    static constexpr size_t SlabSize = 64 * 1024;
+
+    /// Destroys the object at the given address, and returns its size.
+    using Destroy = size_t (*)(void *);
+
+    static constexpr size_t Align = alignof(Destroy);
+
+    /// Objects up to this size are recycled when they are destroyed.
+    static constexpr size_t MaxRecycled = 512;
+
+    /// The storage of a destroyed object. It keeps a null header, so that
+    /// reset() knows to skip over it.
+    struct FreeSlot final {
+        size_t size;
+        FreeSlot *next;
+    };
+
+    /// A slab, and one past the last object carved out of it.
+    struct Slab final {
+        char *begin;
+        char *end;
+    };
+
+    std::vector<Slab> m_Slabs = {};
+    char *m_Ptr = nullptr;
+    char *m_End = nullptr;
+
+    /// Free lists of destroyed objects, indexed by size class.
+    FreeSlot *m_Free[MaxRecycled / Align + 1] = {};
+
+    size_t m_Live = 0;
+    size_t m_Recycled = 0;
+    size_t m_Reserved = 0;
+
+    static constexpr size_t round_up(size_t size)
+    { return (size + Align - 1) & ~(Align - 1); }
+
+    /// \returns Uninitialized storage for an object of \p size bytes, which
+    /// must be a multiple of the pool alignment, along with its header.
+    void *allocate(size_t size) {
+        if (size <= MaxRecycled) {
+            if (FreeSlot *slot = m_Free[size / Align]) {
+                m_Free[size / Align] = slot->next;
+                ++m_Recycled;
+                return slot;
+            }
+        }
+
+        size += sizeof(Destroy);
+        if (size > size_t(m_End - m_Ptr))
+            return allocate_slow(size);
+
+        char *mem = m_Ptr;
+        m_Ptr += size;
+        return mem + sizeof(Destroy);
+    }
+
+    /// Allocate \p size bytes, header included, from a new slab.
+    void *allocate_slow(size_t size);
+
+    static Destroy &header(void *obj)
+    { return *(reinterpret_cast<Destroy *>(obj) - 1); }
+
+    template <typename T>
+    static size_t destroy_as(void *P) {
+        static_cast<T *>(P)->~T();
+        return round_up(sizeof(T));
+    }
+
+public:
+    Pool() = default;
+
+    Pool(const Pool &) = delete;
+    Pool &operator=(const Pool &) = delete;
+
+    ~Pool() { reset(); }
+
+    /// Construct a new \p T in this pool from \p args.
+    template <typename T, typename... Args>
+    T *create(Args &&...args) {
+        static_assert(alignof(T) <= Align, "Over-aligned pool object.");
+        static_assert(sizeof(T) >= sizeof(FreeSlot), "Undersized object.");
+
+        constexpr size_t size = round_up(sizeof(T));
+        void *mem = allocate(size);
+
+        // Until the object is constructed, its storage reads as free.
+        header(mem) = nullptr;
+        T *obj;
+        try {
+            obj = new (mem) T(std::forward<Args>(args)...);
+        } catch (...) {
+            static_cast<FreeSlot *>(mem)->size = size;
+            throw;
+        }
+
+        header(obj) = &destroy_as<T>;
+        ++m_Live;
+        return obj;
+    }
+
+    /// Destroy \p obj, which must have been returned by create(), and recycle
+    /// its storage.
+    void destroy(void *obj) {
+        assert(header(obj) && "Object was already destroyed.");
+
+        size_t size = header(obj)(obj);
+        header(obj) = nullptr;
+
+        FreeSlot *slot = static_cast<FreeSlot *>(obj);
+        slot->size = size;
+        slot->next = nullptr;
+        if (size <= MaxRecycled) {
+            slot->next = m_Free[size / Align];
+            m_Free[size / Align] = slot;
+        }
+
+        --m_Live;
+    }
+
+    /// Destroy every live object in this pool and release all of its memory.
+    void reset();
+
+    /// \returns The number of objects alive in this pool.
+    size_t get_num_live() const { return m_Live; }
+
+    /// \returns The number of objects created in recycled storage.
+    size_t get_num_recycled() const { return m_Recycled; }
+
+    /// \returns The number of bytes held by the slabs of this pool.
+    size_t get_bytes_reserved() const { return m_Reserved; }
+};
+
+} // namespace mir
+
+#endif // MEDDLE_POOL_H
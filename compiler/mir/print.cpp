@@ -11,27 +11,75 @@
 
 using namespace mir;
 
+namespace {
+
+/// The printable names of the local values of a function. 
+///
+/// Unnamed values print as their number. Named blocks and instructions are
+/// not unique, so any which share a name with an earlier one in the function
+/// are given a numeric suffix.
+class NameTable final {
+    std::unordered_map<const Value *, String> m_Names = {};
+
+    void add(const Value *V, std::unordered_map<String, unsigned> &Seen) {
+        unsigned &count = Seen[V->get_name()];
+        if (count != 0)
+            m_Names[V] = V->get_name() + std::to_string(count);
+
+        ++count;
+    }
+
+public:
+    NameTable(const Function *FN) {
+        std::unordered_map<String, unsigned> blocks = {};
+        std::unordered_map<String, unsigned> insts = {};
+
+        for (BasicBlock *BB = FN->head(); BB; BB = BB->get_next()) {
+            if (BB->is_named())
+                add(BB, blocks);
+
+            for (Inst *I = BB->head(); I; I = I->get_next())
+                if (I->is_named())
+                    add(I, insts);
+        }
+    }
+
+    const String *get(const Value *V) const {
+        auto it = m_Names.find(V);
+        return it != m_Names.end() ? &it->second : nullptr;
+    }
+};
+
+} // namespace
+
+/// The names of the function being printed, if there is one.
+static thread_local const NameTable *g_Names = nullptr;
+
 static String get_printed_name(Value const *V) {
-    return V->get_name();
+    if (g_Names) {
+        if (const String *N = g_Names->get(V))
+            return *N;
+    }
+
+    if (V->is_named())
+        return V->get_name();
+
+    return std::to_string(V->get_number());
 }
 
 static void print_phi(std::ostream &OS, PHINode *I) {
     OS << "$" << get_printed_name(I) << " := phi " << I->get_type()->get_name();
-    if (I->get_incoming().empty())
+    if (I->get_num_incoming() == 0)
         return;
     
     OS << " ";
 
-    for (auto &[ Value, Block ] : I->get_incoming()) {
+    for (unsigned i = 0, n = I->get_num_incoming(); i != n; ++i) {
         OS << "[ ";
-        Block->print(OS);
+        I->get_incoming_block(i)->print(OS);
         OS << ", ";
-        Value->print(OS);
-        
-        if (Value != I->get_incoming().back().first)
-            OS << " ], ";
-        else
-            OS << " ]";
+        I->get_incoming_value(i)->print(OS);
+        OS << (i + 1 != n ? " ], " : " ]");
     }
 }
 
@@ -77,13 +125,9 @@ static void print_cpy(std::ostream &OS, CpyInst *I) {
 static void print_syscall(std::ostream &OS, SyscallInst *I) {
     OS << "$" << get_printed_name(I) << " := syscall ";
     I->get_num()->print(OS);
-    if (!I->get_args().empty())
+    for (unsigned i = 0, n = I->get_num_args(); i != n; ++i) {
         OS << ", ";
-    
-    for (auto &Arg : I->get_args()) {
-        Arg->print(OS);
-        if (Arg != I->get_args().back())
-            OS << ", ";
+        I->get_arg(i)->print(OS);
     }
 }
 
@@ -117,9 +161,9 @@ static void print_call(std::ostream &OS, CallInst *I) {
     OS << "call ";
     I->get_callee()->print(OS);
     OS << "(";
-    for (auto &Arg : I->get_args()) {
-        Arg->print(OS);
-        if (Arg != I->get_args().back())
+    for (unsigned i = 0, n = I->get_num_args(); i != n; ++i) {
+        I->get_arg(i)->print(OS);
+        if (i + 1 != n)
             OS << ", ";
     }
     OS << ")";
@@ -337,32 +381,47 @@ static void print_block(std::ostream &OS, BasicBlock *BB) {
     
     for (Inst *curr = BB->head(); curr != nullptr; curr = curr->get_next()) {
         OS << "    ";
-        if (auto *I = dynamic_cast<PHINode *>(curr))
-            print_phi(OS, I);
-        else if (auto *I = dynamic_cast<APInst *>(curr))
-            print_ap(OS, I);
-        else if (auto *I = dynamic_cast<StoreInst *>(curr))
-            print_store(OS, I);
-        else if (auto *I = dynamic_cast<LoadInst *>(curr))
-            print_load(OS, I);
-        else if (auto *I = dynamic_cast<SyscallInst *>(curr))
-            print_syscall(OS, I);
-        else if (auto *I = dynamic_cast<CpyInst *>(curr))
-            print_cpy(OS, I);
-        else if (auto *I = dynamic_cast<BrifInst *>(curr))
-            print_brif(OS, I);
-        else if (auto *I = dynamic_cast<JMPInst *>(curr))
-            print_jmp(OS, I);
-        else if (auto *I = dynamic_cast<RetInst *>(curr))
-            print_ret(OS, I);
-        else if (auto *I = dynamic_cast<CallInst *>(curr))
-            print_call(OS, I);
-        else if (auto *I = dynamic_cast<BinopInst *>(curr))
-            print_binop(OS, I);
-        else if (auto *I = dynamic_cast<UnopInst *>(curr))
-            print_unop(OS, I);
-        else if (auto *I = dynamic_cast<CMPInst *>(curr))
-            print_cmp(OS, I);
+        switch (curr->get_inst_kind()) {
+        case InstKind::PHI:
+            print_phi(OS, static_cast<PHINode *>(curr));
+            break;
+        case InstKind::AP:
+            print_ap(OS, static_cast<APInst *>(curr));
+            break;
+        case InstKind::Store:
+            print_store(OS, static_cast<StoreInst *>(curr));
+            break;
+        case InstKind::Load:
+            print_load(OS, static_cast<LoadInst *>(curr));
+            break;
+        case InstKind::Syscall:
+            print_syscall(OS, static_cast<SyscallInst *>(curr));
+            break;
+        case InstKind::Cpy:
+            print_cpy(OS, static_cast<CpyInst *>(curr));
+            break;
+        case InstKind::Brif:
+            print_brif(OS, static_cast<BrifInst *>(curr));
+            break;
+        case InstKind::JMP:
+            print_jmp(OS, static_cast<JMPInst *>(curr));
+            break;
+        case InstKind::Ret:
+            print_ret(OS, static_cast<RetInst *>(curr));
+            break;
+        case InstKind::Call:
+            print_call(OS, static_cast<CallInst *>(curr));
+            break;
+        case InstKind::Binop:
+            print_binop(OS, static_cast<BinopInst *>(curr));
+            break;
+        case InstKind::Unop:
+            print_unop(OS, static_cast<UnopInst *>(curr));
+            break;
+        case InstKind::CMP:
+            print_cmp(OS, static_cast<CMPInst *>(curr));
+            break;
+        }
 
         OS << "\n";
     }
@@ -381,7 +440,7 @@ static void print_arg(std::ostream &OS, Argument *A) {
     if (A->hasARetAttribute())
         OS << "aret ";
 
-    OS << A->get_type()->get_name() << " %" << A->get_name();
+    OS << A->get_type()->get_name() << " %" << get_printed_name(A);
 }
 
 static void print_slot(std::ostream &OS, Slot *S) {
@@ -406,6 +465,9 @@ static void print_function(std::ostream &OS, Function *FN) {
 
     OS << " {\n";
 
+    NameTable names(FN);
+    g_Names = &names;
+
     for (auto &S : FN->get_slots()) {
         OS << "    ";
         print_slot(OS, S);
@@ -422,6 +484,7 @@ static void print_function(std::ostream &OS, Function *FN) {
     }
 
     OS << "}\n";
+    g_Names = nullptr;
 }
 
 void Segment::print(std::ostream &OS) const {
@@ -442,11 +505,7 @@ void Segment::print(std::ostream &OS) const {
     OS << "\n\n";
 
     bool addTypeNL = false;
-    for (auto &[ String, Type ] : m_Types) {
-        if (!Type->is_struct_ty())
-            continue;
-
-        StructType *ST = static_cast<StructType *>(Type);
+    for (StructType *ST : m_Structs) {
         OS << ST->get_name() << " :: type { ";
         for (auto &M: ST->get_members())
             OS << M->get_name() << (M != ST->get_members().back() ? ", " : "");
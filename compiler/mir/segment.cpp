@@ -1,5 +1,6 @@
 #include "basicblock.h"
 #include "function.h"
+#include "inst.h"
 #include "segment.h"
 #include "type.h"
 
@@ -19,13 +20,13 @@ DataLayout::DataLayout(enum Arch arch, bool littleEndian, unsigned pointerSZ,
     : m_Arch(arch), m_LittleEndian(littleEndian), m_PointerSize(pointerSZ),
       m_PointerAlign(pointerAL) 
 {
-    m_Rules[TypeKind::I1] = { 1, 1 };
-    m_Rules[TypeKind::I8] = { 1, 1 };
-    m_Rules[TypeKind::I16] = { 2, 2 };
-    m_Rules[TypeKind::I32] = { 4, 4 };
-    m_Rules[TypeKind::I64] = { 8, 8 };
-    m_Rules[TypeKind::F32] = { 4, 4 };
-    m_Rules[TypeKind::F64] = { 8, 8 };
+    m_Rules[unsigned(TypeKind::I1)] = { 1, 1 };
+    m_Rules[unsigned(TypeKind::I8)] = { 1, 1 };
+    m_Rules[unsigned(TypeKind::I16)] = { 2, 2 };
+    m_Rules[unsigned(TypeKind::I32)] = { 4, 4 };
+    m_Rules[unsigned(TypeKind::I64)] = { 8, 8 };
+    m_Rules[unsigned(TypeKind::F32)] = { 4, 4 };
+    m_Rules[unsigned(TypeKind::F64)] = { 8, 8 };
 }
 
 unsigned DataLayout::get_type_size(Type *T) const {
@@ -38,18 +39,12 @@ unsigned DataLayout::get_type_size(Type *T) const {
             return get_type_size(AT->get_element()) * AT->get_size();
         }
         case TypeKind::Struct: 
-        {
-            StructType *ST = static_cast<StructType *>(T);
-            unsigned offset = 0;
-            for (const auto& M : ST->get_members()) {
-                unsigned align = get_type_align(M);
-                offset = align_to(offset, align);
-                offset += get_type_size(M);
-            }
-            return align_to(offset, get_type_align(T));
-        }
+            return get_struct_layout(static_cast<StructType *>(T)).size;
+        case TypeKind::Function:
+            assert(false && "Function types have no size.");
+            return 0;
         default:
-            return m_Rules.at(T->get_ty_kind()).size;
+            return m_Rules[unsigned(T->get_ty_kind())].size;
     }
 }
 
@@ -63,16 +58,39 @@ unsigned DataLayout::get_type_align(Type *T) const {
             return get_type_align(AT->get_element());
         }
         case TypeKind::Struct: 
-        {
-            StructType *ST = static_cast<StructType *>(T);
-            unsigned maxAlign = 1;
-            for (const auto& M : ST->get_members())
-                maxAlign = std::max(maxAlign, get_type_align(M));
-            return maxAlign;
-        }
+            return get_struct_layout(static_cast<StructType *>(T)).align;
+        case TypeKind::Function:
+            assert(false && "Function types have no alignment.");
+            return 0;
         default:
-            return m_Rules.at(T->get_ty_kind()).abiAlign;
+            return m_Rules[unsigned(T->get_ty_kind())].abiAlign;
+    }
+}
+
+const StructLayout &DataLayout::get_struct_layout(const StructType *T) const {
+    if (T->m_HasLayout)
+        return T->m_Layout;
+
+    return compute_struct_layout(T);
+}
+
+const StructLayout &
+DataLayout::compute_struct_layout(const StructType *T) const {
+    StructLayout &SL = T->m_Layout;
+    SL.offsets.reserve(T->get_members().size());
+
+    unsigned offset = 0;
+    for (Type *M : T->get_members()) {
+        unsigned align = get_type_align(M);
+        offset = align_to(offset, align);
+        SL.offsets.push_back(offset);
+        offset += get_type_size(M);
+        SL.align = std::max(SL.align, align);
     }
+
+    SL.size = align_to(offset, SL.align);
+    T->m_HasLayout = true;
+    return SL;
 }
 
 unsigned DataLayout::align_to(unsigned offset, unsigned align) {
@@ -111,73 +129,24 @@ bool DataLayout::is_scalar_ty(Type *T) const {
     }
 }
 
-unsigned DataLayout::get_struct_member_offset(StructType *T, unsigned Idx) {
-    unsigned offset = 0;
-    for (unsigned i = 0; i < Idx; ++i) {
-        Type *M = T->get_member(i);
-        unsigned align = get_type_align(M);
-        offset = align_to(offset, align) + get_type_size(M);
-    }
-
-    return align_to(offset, get_type_align(T->get_member(Idx)));
+unsigned DataLayout::get_struct_member_offset(StructType *T, 
+                                              unsigned Idx) const {
+    const StructLayout &SL = get_struct_layout(T);
+    assert(Idx < SL.offsets.size() && "Index out of range.");
+    return SL.offsets[Idx];
 }
 
 Segment::Segment(const Target &T) : m_Target(T), m_Layout(T.get_data_layout()) {
-    m_Types["i1"] = new IntegerType(IntegerType::Kind::Int1);
-    m_Types["i8"] = new IntegerType(IntegerType::Kind::Int8);
-    m_Types["i16"] = new IntegerType(IntegerType::Kind::Int16);
-    m_Types["i32"] = new IntegerType(IntegerType::Kind::Int32);
-    m_Types["i64"] = new IntegerType(IntegerType::Kind::Int64);
-    m_Types["f32"] = new FloatType(FloatType::Kind::Float32);
-    m_Types["f64"] = new FloatType(FloatType::Kind::Float64);
-    m_Types["void"] = new VoidType();
-    m_I1Zero = new ConstantInt(m_Types.at("i1"), 0);
-    m_I1One = new ConstantInt(m_Types.at("i1"), 1);
-}
-
-Segment::~Segment() {
-    for (auto &T : m_Types)
-        delete T.second;
-    m_Types.clear();
-
-    for (auto &FN : m_Functions)
-        delete FN.second;
-    m_Functions.clear();
-
-    for (auto &D : m_Data)
-        delete D.second;
-    m_Data.clear();
-
-    for (auto &[ Type, Nil ] : m_NilPool)
-        delete Nil;
-    m_NilPool.clear();
-
-    for (auto &[ Value, Int ] : m_I8Pool)
-        delete Int;
-    m_I8Pool.clear();
-
-    for (auto &[ Value, Int ] : m_I16Pool)
-        delete Int;
-    m_I16Pool.clear();
-
-    for (auto &[ Value, Int ] : m_I32Pool)
-        delete Int;
-    m_I32Pool.clear();
-
-    for (auto &[ Value, Int ] : m_I64Pool)
-        delete Int;
-    m_I64Pool.clear();
-
-    for (auto &[ Value, FP ] : m_F32Pool)
-        delete FP;
-    m_F32Pool.clear();
-
-    for (auto &[ Value, FP ] : m_F64Pool)
-        delete FP;
-    m_F64Pool.clear();
-
-    delete m_I1Zero;
-    delete m_I1One;
+    m_Types["i1"] = create<IntegerType>(IntegerType::Kind::Int1);
+    m_Types["i8"] = create<IntegerType>(IntegerType::Kind::Int8);
+    m_Types["i16"] = create<IntegerType>(IntegerType::Kind::Int16);
+    m_Types["i32"] = create<IntegerType>(IntegerType::Kind::Int32);
+    m_Types["i64"] = create<IntegerType>(IntegerType::Kind::Int64);
+    m_Types["f32"] = create<FloatType>(FloatType::Kind::Float32);
+    m_Types["f64"] = create<FloatType>(FloatType::Kind::Float64);
+    m_Types["void"] = create<VoidType>();
+    m_I1Zero = create<ConstantInt>(m_Types.at("i1"), 0);
+    m_I1One = create<ConstantInt>(m_Types.at("i1"), 1);
 }
 
 void Segment::add_data(Data *D) {
@@ -185,7 +154,7 @@ void Segment::add_data(Data *D) {
     m_Data[D->get_name()] = D;
 }
 
-Data *Segment::get_data(String N) const {
+Data *Segment::get_data(const String &N) const {
     auto it = m_Data.find(N);
     if (it != m_Data.end())
         return it->second;
@@ -196,8 +165,9 @@ Data *Segment::get_data(String N) const {
 void Segment::remove_data(Data *D) {
     auto it = m_Data.find(D->get_name());
     if (it != m_Data.end()) {
+        assert(!D->is_used() && "Data is still used.");
         m_Data.erase(it);
-        delete D;
+        destroy(D);
     } else
         assert(false && "Data with name does not exist in this segment.");
 }
@@ -207,7 +177,7 @@ void Segment::add_function(Function *F) {
     m_Functions[F->get_name()] = F;
 }
 
-Function *Segment::get_function(String N) const {
+Function *Segment::get_function(const String &N) const {
     auto it = m_Functions.find(N);
     if (it != m_Functions.end())
         return it->second;
@@ -226,7 +196,24 @@ void Segment::remove_function(Function *F) {
     auto it = m_Functions.find(F->get_name());
     if (it != m_Functions.end()) {
         m_Functions.erase(it);
-        delete F;
+
+        // The arguments, slots and blocks of the function go with it. Blocks
+        // branch to each other, so all of their operands are dropped first.
+        for (BasicBlock *BB = F->head(); BB; BB = BB->get_next())
+            for (Inst *I = BB->head(); I; I = I->get_next())
+                I->drop_operands();
+
+        assert(!F->is_used() && "Function is still called.");
+        while (F->head())
+            F->head()->detach();
+
+        for (Slot *S : F->get_slots())
+            destroy(S);
+
+        for (Argument *A : F->get_args())
+            destroy(A);
+
+        destroy(F);
     } else
         assert(false && "Function with name does not exist in this segment.");
 }
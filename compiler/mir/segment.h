@@ -1,6 +1,8 @@
 #ifndef SEGMENT_H
 #define SEGMENT_H
 
+#include "pool.h"
+#include "type.h"
 #include "value.h"
 
 #include <cstdint>
@@ -19,9 +21,6 @@ class ConstantNil;
 class Data;
 class DataLayout;
 class Function;
-class Type;
-class StructType;
-enum class TypeKind;
 
 enum class Arch {
     X86_64,
@@ -57,10 +56,14 @@ class DataLayout final {
         unsigned abiAlign;
     };
 
-    std::unordered_map<TypeKind, LayoutRule> m_Rules = {};
+    /// Layout rules for the scalar types, indexed by type kind.
+    LayoutRule m_Rules[unsigned(TypeKind::F64) + 1] = {};
 
     static unsigned align_to(unsigned offset, unsigned align);
 
+    /// Compute the layout of \p T and cache it on the type.
+    const StructLayout &compute_struct_layout(const StructType *T) const;
+
 public:
     DataLayout(enum Arch arch, bool littleEndian, unsigned pointerSZ, 
                unsigned pointerAL);
@@ -76,7 +79,11 @@ public:
 
     bool is_scalar_ty(Type *T) const;
 
-    unsigned get_struct_member_offset(StructType *T, unsigned Idx);
+    /// \returns The layout of struct type \p T. The layout is computed once
+    /// per struct, and every later query is a lookup.
+    const StructLayout &get_struct_layout(const StructType *T) const;
+
+    unsigned get_struct_member_offset(StructType *T, unsigned Idx) const;
 };
 
 class Segment final {
@@ -90,11 +97,38 @@ class Segment final {
     friend class ConstantFP;
     friend class ConstantNil;
 
-    unsigned long m_SSA = 1;
+    /// The storage of every type and value in this segment. It is declared
+    /// first so that it is torn down after the tables which refer into it.
+    Pool m_Pool;
+
+    unsigned m_SSA = 1;
     Target m_Target;
     DataLayout m_Layout;
 
+    /// Integer, float and void types by name, and named struct types.
     std::unordered_map<String, Type *> m_Types = {};
+
+    /// Struct types in the order they were created, for printing.
+    std::vector<StructType *> m_Structs = {};
+
+    /// Structural types, uniqued by their components rather than by name.
+    struct ArrayKey final {
+        Type *element;
+        unsigned size;
+
+        bool operator==(const ArrayKey &other) const
+        { return element == other.element && size == other.size; }
+    };
+
+    struct ArrayKeyHash final {
+        size_t operator()(const ArrayKey &K) const 
+        { return std::hash<Type *>()(K.element) * 31 + K.size; }
+    };
+
+    std::unordered_map<Type *, PointerType *> m_Pointers = {};
+    std::unordered_map<ArrayKey, ArrayType *, ArrayKeyHash> m_Arrays = {};
+    std::unordered_multimap<size_t, FunctionType *> m_FunctionTypes = {};
+
     std::unordered_map<String, Data *> m_Data = {};
     std::unordered_map<String, Function *> m_Functions = {};
 
@@ -111,21 +145,33 @@ class Segment final {
 public:
     Segment(const Target &T);
 
-    ~Segment();
+    /// Construct a new \p T in the storage of this segment from \p args. The
+    /// result lives until it is destroyed, or until the segment is.
+    template <typename T, typename... Args>
+    T *create(Args &&...args) 
+    { return m_Pool.create<T>(std::forward<Args>(args)...); }
+
+    /// Destroy \p V, which must have been created in this segment, and 
+    /// recycle its storage for the next value of the same size.
+    void destroy(Value *V) { m_Pool.destroy(V); }
+
+    /// \returns The storage of this segment.
+    const Pool &get_pool() const { return m_Pool; }
 
-    String get_ssa() { return std::to_string(m_SSA++); }
+    /// \returns The next number for an unnamed value in this segment.
+    unsigned get_ssa() { return m_SSA++; }
 
     const DataLayout &get_data_layout() const { return m_Layout; }
 
     void add_data(Data *D);
 
-    Data *get_data(String N) const;
+    Data *get_data(const String &N) const;
 
     void remove_data(Data *D);
 
     void add_function(Function *F);
 
-    Function *get_function(String N) const;
+    Function *get_function(const String &N) const;
 
     std::vector<Function *> get_functions() const;
 
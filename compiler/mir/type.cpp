@@ -28,14 +28,22 @@ static String get_function_ty_name(const std::vector<Type *> P, Type *R) {
     return N + ")" + (R ? " -> " + R->get_name() : "");
 }
 
+/// \returns A hash of the identity of \p head followed by each of \p types.
+static size_t hash_components(const Type *head, 
+                              const std::vector<Type *> &types) {
+    size_t H = std::hash<const Type *>()(head);
+    for (auto &T : types)
+        H = H * 31 + std::hash<Type *>()(T);
+
+    return H;
+}
+
 ArrayType *ArrayType::get(Segment *S, Type *E, unsigned Sz) {
-    Type *T = S->m_Types[E->get_name() + "[" + std::to_string(Sz) + "]"];
-    if (T)
-        return static_cast<ArrayType *>(T);
+    auto [it, inserted] = S->m_Arrays.try_emplace({ E, Sz }, nullptr);
+    if (inserted)
+        it->second = S->create<ArrayType>(E, Sz);
 
-    ArrayType *AT = new ArrayType(E, Sz);
-    S->m_Types[AT->get_name()] = AT;
-    return AT;
+    return it->second;
 }
 
 IntegerType::IntegerType(Kind K) 
@@ -45,36 +53,38 @@ FloatType::FloatType(Kind K)
     : Type(get_kind_name(K), get_fp_ty_kind(K)), m_Kind(K) {}
 
 FunctionType::FunctionType(Type *R, std::vector<Type *> P) 
-    : Type(get_function_ty_name(P, R), TypeKind::Function), m_Params(P), 
-      m_Ret(R) {}
+    : Type(get_function_ty_name(P, R), TypeKind::Function), 
+      m_Params(std::move(P)), m_Ret(R) {}
 
 FunctionType *FunctionType::get(Segment *S, std::vector<Type *> Ps, Type *R) {
-    Type *T = S->m_Types[get_function_ty_name(Ps, R)];
-    if (T)
-        return static_cast<FunctionType *>(T);
+    size_t hash = hash_components(R, Ps);
+    auto [begin, end] = S->m_FunctionTypes.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+        FunctionType *FT = it->second;
+        if (FT->m_Ret == R && FT->m_Params == Ps)
+            return FT;
+    }
 
-    FunctionType *FT = new FunctionType(R, Ps);
-    S->m_Types[FT->get_name()] = FT;
+    FunctionType *FT = S->create<FunctionType>(R, std::move(Ps));
+    S->m_FunctionTypes.emplace(hash, FT);
     return FT;
 }
 
 PointerType *PointerType::get(Segment *S, Type *P) {
-    Type *T = S->m_Types[P->get_name() + "*"];
-    if (T)
-        return static_cast<PointerType *>(T);
-    
-    PointerType *PT = new PointerType(P);
-    S->m_Types[PT->get_name()] = PT;
-    return PT;
+    auto [it, inserted] = S->m_Pointers.try_emplace(P, nullptr);
+    if (inserted)
+        it->second = S->create<PointerType>(P);
+
+    return it->second;
 }
 
 StructType *StructType::get(Segment *S, String N) {
-    Type *T = S->m_Types[N];
-    if (T) {
-        if (!T->is_struct_ty())
+    auto it = S->m_Types.find(N);
+    if (it != S->m_Types.end()) {
+        if (!it->second->is_struct_ty())
             assert(false && "Type is not a struct type.");
         
-        return static_cast<StructType *>(T);
+        return static_cast<StructType *>(it->second);
     }
     
     return nullptr;
@@ -83,7 +93,8 @@ StructType *StructType::get(Segment *S, String N) {
 StructType *StructType::create(Segment *S, String N, std::vector<Type *> Ms) {
     assert(!get(S, N) && "Struct type already exists.");
 
-    StructType *ST = new StructType(N, Ms);
+    StructType *ST = S->create<StructType>(N, std::move(Ms));
     S->m_Types[N] = ST;
+    S->m_Structs.push_back(ST);
     return ST;
 }
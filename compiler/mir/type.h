@@ -3,6 +3,7 @@
 
 #include <cassert>
 #include <string>
+#include <utility>
 #include <vector>
 
 using String = std::string;
@@ -54,6 +55,7 @@ public:
 
 class ArrayType final : public Type {
     friend class Builder;
+    friend class Pool;
     friend class Segment;
 
     Type *m_Element;
@@ -75,6 +77,7 @@ public:
 
 class IntegerType final : public Type {
     friend class Builder;
+    friend class Pool;
     friend class Segment;
 
 public:
@@ -123,6 +126,7 @@ public:
 
 class FloatType final : public Type {
     friend class Builder;
+    friend class Pool;
     friend class Segment;
 
 public:
@@ -162,6 +166,7 @@ public:
 
 class FunctionType final : public Type {
     friend class Builder;
+    friend class Pool;
     friend class Segment;
 
     std::vector<Type *> m_Params;
@@ -186,6 +191,7 @@ public:
 
 class PointerType final : public Type {
     friend class Builder;
+    friend class Pool;
     friend class Segment;
 
     Type *m_Pointee;
@@ -201,14 +207,28 @@ public:
     Type *get_pointee() const { return m_Pointee; }
 };
 
+/// The size, alignment and member offsets of a struct type.
+struct StructLayout final {
+    unsigned size = 0;
+    unsigned align = 1;
+    std::vector<unsigned> offsets = {};
+};
+
 class StructType final : public Type {
     friend class Builder;
+    friend class DataLayout;
+    friend class Pool;
     friend class Segment;
 
     std::vector<Type *> m_Members;
 
+    /// The layout of this struct, computed by the data layout of its segment
+    /// on the first query.
+    mutable StructLayout m_Layout = {};
+    mutable bool m_HasLayout = false;
+
     StructType(String N, std::vector<Type *> M) 
-        : Type(N, TypeKind::Struct), m_Members(M) {}
+        : Type(N, TypeKind::Struct), m_Members(std::move(M)) {}
 
 public:
     static StructType *get(Segment *S, String N);
@@ -226,6 +246,7 @@ public:
 
 class VoidType final : public Type {
     friend class Builder;
+    friend class Pool;
     friend class Segment;
 
     VoidType() : Type("void", TypeKind::I32) {}
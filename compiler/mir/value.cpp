@@ -9,6 +9,31 @@ using namespace mir;
 
 static std::map<String, unsigned> g_Dict = {};
 
+unsigned Value::get_num_uses() const {
+    unsigned uses = 0;
+    for (Use *U = m_UseList; U; U = U->get_next())
+        ++uses;
+
+    return uses;
+}
+
+bool Value::is_used_by(const Inst *user) const {
+    for (Use *U = m_UseList; U; U = U->get_next())
+        if (U->get_user() == user)
+            return true;
+
+    return false;
+}
+
+void Value::replace_all_uses_with(Value *V) {
+    assert(V && "Replacement value cannot be null.");
+    assert(V != this && "Cannot replace a value with itself.");
+    assert(V->get_type() == m_Type && "Replacement type mismatch.");
+
+    while (m_UseList)
+        m_UseList->set(V);
+}
+
 Data::Data(String N, Type *T, Linkage L, Segment *P, Value *V, unsigned A, 
            bool R)
     : Value(N, T), m_Linkage(L), m_Parent(P), m_Value(V), m_Align(A), 
@@ -31,7 +56,7 @@ void Data::detach() {
     m_Parent->remove_data(this);
 }
 
-Slot::Slot(String N, Type *T, Function *P, Type *A, unsigned AL) 
+Slot::Slot(const String &N, Type *T, Function *P, Type *A, unsigned AL) 
   : Value(N, T), m_Parent(P), m_Alloc(A), m_Align(AL) {
     m_Parent->add_slot(this);
 }
@@ -39,7 +64,7 @@ Slot::Slot(String N, Type *T, Function *P, Type *A, unsigned AL)
 ConstantInt *ConstantInt::get(Segment *S, Type *T, long V) {
     assert(T->is_integer_ty() && "Type must be integer.");
 
-    auto *IT = dynamic_cast<IntegerType *>(T);
+    auto *IT = static_cast<IntegerType *>(T);
     switch (IT->get_kind()) {
         case IntegerType::Kind::Int1:
             if (V == 0)
@@ -54,7 +79,7 @@ ConstantInt *ConstantInt::get(Segment *S, Type *T, long V) {
             if (it != S->m_I8Pool.end())
                 return it->second;
             else
-                return S->m_I8Pool[V] = new ConstantInt(T, V);
+                return S->m_I8Pool[V] = S->create<ConstantInt>(T, V);
         }
         case IntegerType::Kind::Int16:
         {
@@ -62,7 +87,7 @@ ConstantInt *ConstantInt::get(Segment *S, Type *T, long V) {
             if (it != S->m_I16Pool.end())
                 return it->second;
             else
-                return S->m_I16Pool[V] = new ConstantInt(T, V);
+                return S->m_I16Pool[V] = S->create<ConstantInt>(T, V);
         }
         case IntegerType::Kind::Int32:
         {
@@ -70,7 +95,7 @@ ConstantInt *ConstantInt::get(Segment *S, Type *T, long V) {
             if (it != S->m_I32Pool.end())
                 return it->second;
             else
-                return S->m_I32Pool[V] = new ConstantInt(T, V);
+                return S->m_I32Pool[V] = S->create<ConstantInt>(T, V);
         }
         case IntegerType::Kind::Int64:
         {
@@ -78,7 +103,7 @@ ConstantInt *ConstantInt::get(Segment *S, Type *T, long V) {
             if (it != S->m_I64Pool.end())
                 return it->second;
             else
-                return S->m_I64Pool[V] = new ConstantInt(T, V);
+                return S->m_I64Pool[V] = S->create<ConstantInt>(T, V);
         }
     }
 }
@@ -86,7 +111,7 @@ ConstantInt *ConstantInt::get(Segment *S, Type *T, long V) {
 ConstantFP *ConstantFP::get(Segment *S, Type *T, double V) {
     assert(T->is_float_ty() && "Type must be float.");
 
-    auto *FT = dynamic_cast<FloatType *>(T);
+    auto *FT = static_cast<FloatType *>(T);
     switch (FT->get_kind()) {
         case FloatType::Kind::Float32:
         {
@@ -94,7 +119,7 @@ ConstantFP *ConstantFP::get(Segment *S, Type *T, double V) {
             if (it != S->m_F32Pool.end())
                 return it->second;
             else
-                return S->m_F32Pool[V] = new ConstantFP(T, V);
+                return S->m_F32Pool[V] = S->create<ConstantFP>(T, V);
         }
         case FloatType::Kind::Float64:
         {
@@ -102,7 +127,7 @@ ConstantFP *ConstantFP::get(Segment *S, Type *T, double V) {
             if (it != S->m_F64Pool.end())
                 return it->second;
             else
-                return S->m_F64Pool[V] = new ConstantFP(T, V);
+                return S->m_F64Pool[V] = S->create<ConstantFP>(T, V);
         }
     }
 }
@@ -114,5 +139,5 @@ ConstantNil *ConstantNil::get(Segment *S, Type *T) {
     if (it != S->m_NilPool.end())
         return it->second;
     else
-        return S->m_NilPool[T] = new ConstantNil(T);
+        return S->m_NilPool[T] = S->create<ConstantNil>(T);
 }
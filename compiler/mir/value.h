@@ -15,43 +15,122 @@ class Function;
 class Inst;
 class Segment;
 class Type;
+class Value;
+
+/// A reference from an instruction to one of its operands.
+///
+/// Each use is threaded onto an intrusive list in the value it refers to, so
+/// it can be moved to another value or dropped in constant time. Uses live in
+/// the operand array of their user, and never move once they are linked.
+class Use final {
+    friend class Value;
+
+    Value *m_Value = nullptr;
+    Inst *m_User = nullptr;
+
+    /// The next use of the same value, and the link which points to this use.
+    Use *m_Next = nullptr;
+    Use **m_Prev = nullptr;
+
+public:
+    Use() = default;
+
+    Use(const Use &) = delete;
+    Use &operator=(const Use &) = delete;
+
+    Value *get() const { return m_Value; }
+
+    operator Value *() const { return m_Value; }
+
+    Inst *get_user() const { return m_User; }
+
+    void set_user(Inst *I) { m_User = I; }
+
+    /// \returns The next use of the same value, if there is one.
+    Use *get_next() const { return m_Next; }
+
+    /// Point this use at \p V, moving it from the use list of its current 
+    /// value onto the use list of \p V. \p V may be null.
+    void set(Value *V);
+};
 
 class Value {
+    friend class Use;
+
 protected:
     String m_Name;
     Type *m_Type;
-    std::vector<Inst *> m_Uses = {};
+
+    /// The head of the list of uses of this value.
+    Use *m_UseList = nullptr;
+
+    /// The number of this value in its segment, if it is unnamed. Unnamed 
+    /// values are only given a printable name when they are printed.
+    unsigned m_Number = 0;
 
 public:
-    Value(String N, Type *T) : m_Name(N), m_Type(T) {}
+    Value(const String &N, Type *T) : m_Name(N), m_Type(T) {}
     virtual ~Value() = default;
 
     virtual bool is_constant() const { return false; }
 
     bool is_named() const { return !m_Name.empty(); }
 
-    String get_name() const { return m_Name; }
+    const String &get_name() const { return m_Name; }
+
+    bool is_numbered() const { return m_Number != 0; }
+
+    unsigned get_number() const { return m_Number; }
+
+    void set_number(unsigned N) { m_Number = N; }
 
     Type *get_type() const { return m_Type; }
 
-    bool is_used() const { return m_Uses.size() != 0; }
+    bool is_used() const { return m_UseList != nullptr; }
 
-    bool is_used_by(Inst *user) const 
-    { return std::find(m_Uses.begin(), m_Uses.end(), user) != m_Uses.end(); }
+    bool has_one_use() const 
+    { return m_UseList && !m_UseList->get_next(); }
 
-    void add_use(Inst *user) { m_Uses.push_back(user); }
+    /// \returns The first use of this value, if it has any.
+    Use *use_head() const { return m_UseList; }
 
-    void del_use(Inst *user) { 
-        m_Uses.erase(
-            std::remove(m_Uses.begin(), m_Uses.end(), user), 
-            m_Uses.end()
-        ); 
-    }
+    /// \returns The number of uses of this value. This walks the use list.
+    unsigned get_num_uses() const;
+
+    /// \returns `true` if \p user refers to this value. This walks the use 
+    /// list.
+    bool is_used_by(const Inst *user) const;
+
+    /// Make every use of this value refer to \p V instead. Each use is moved
+    /// in constant time.
+    void replace_all_uses_with(Value *V);
 
     virtual void print(std::ostream &OS) const
     { assert(false && "Value cannot be printed."); }
 };
 
+inline void Use::set(Value *V) {
+    if (m_Value) {
+        *m_Prev = m_Next;
+        if (m_Next)
+            m_Next->m_Prev = m_Prev;
+    }
+
+    m_Value = V;
+    if (!V) {
+        m_Next = nullptr;
+        m_Prev = nullptr;
+        return;
+    }
+
+    m_Next = V->m_UseList;
+    m_Prev = &V->m_UseList;
+    if (m_Next)
+        m_Next->m_Prev = &m_Next;
+
+    V->m_UseList = this;
+}
+
 class Data final : public Value {
     friend class Builder;
 
@@ -78,7 +157,7 @@ public:
 
     bool is_read_only() const { return m_ReadOnly; }
 
-    /// Detach this data from its parent segment and delete it.
+    /// Detach this data from its parent segment and destroy it.
     void detach();
 
     void print(std::ostream &OS) const override;
@@ -86,12 +165,13 @@ public:
 
 class Slot final : public Value {
     friend class Builder;
+    friend class Pool;
 
     Function *m_Parent;
     Type *m_Alloc;
     unsigned m_Align;
 
-    Slot(String N, Type *T, Function *P, Type *A, unsigned AL);
+    Slot(const String &N, Type *T, Function *P, Type *A, unsigned AL);
 
 public:
     ~Slot() override = default;
@@ -113,6 +193,7 @@ public:
 
 class ConstantInt final : public Constant {
     friend class Segment;
+    friend class Pool;
 
     long m_Value;
 
@@ -128,6 +209,7 @@ public:
 
 class ConstantFP final : public Constant {
     friend class Segment;
+    friend class Pool;
 
     double m_Value;
 
@@ -143,6 +225,7 @@ public:
 
 class ConstantNil final : public Constant {
     friend class Segment;
+    friend class Pool;
     
     ConstantNil(Type *T) : Constant(T) {}
 
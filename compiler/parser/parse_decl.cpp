@@ -1,5 +1,6 @@
 #include "parser.h"
 #include "../core/logger.h"
+#include "../lexer/lexer.h"
 
 using namespace meddle;
 
@@ -9,7 +10,7 @@ Decl *Parser::parse_decl() {
     if (!match(TokenKind::Identifier))
         fatal("expected declaration identifier", &m_Current->md);
 
-    if (match_keyword("use"))
+    if (match_keyword(KeywordKind::Use))
         return parse_use();
 
     Token name = *m_Current;
@@ -23,10 +24,11 @@ Decl *Parser::parse_decl() {
             expect(TokenKind::Identifier, "expected parameter name");
 
             Metadata paramMd = m_Current->md;
-            String paramName = m_Current->value;
+            String paramName = String(m_Current->value);
             next(); // identifier
 
-            params.push_back(new TemplateParamDecl(
+            params.push_back(m_Context->create<TemplateParamDecl>(
+                m_Context,
                 Runes(),
                 paramMd,
                 paramName,
@@ -54,7 +56,7 @@ Decl *Parser::parse_decl() {
         D = parse_function(name, params);
     } else if (match(TokenKind::SetBrace)) {
         D = parse_struct(name, params);
-    } else if (match_keyword("fix") || match_keyword("mut")) {
+    } else if (match_keyword(KeywordKind::Fix) || match_keyword(KeywordKind::Mut)) {
         if (!params.empty())
             fatal("global variable cannot be made a template", &name.md);
 
@@ -95,7 +97,7 @@ FunctionDecl *Parser::parse_function(const Token &name, std::vector<TemplatePara
         if (paramTy->isVoid())
             fatal("parameter type cannot be 'void'", &m_Current->md);
 
-        ParamDecl *param = new ParamDecl(
+        ParamDecl *param = m_Context->create<ParamDecl>(
             Runes(),
             paramMd,
             paramName,
@@ -127,7 +129,10 @@ FunctionDecl *Parser::parse_function(const Token &name, std::vector<TemplatePara
     for (auto &param : params)
         paramTys.push_back(param->getType());
 
-    if (match(TokenKind::SetBrace)) {
+    std::function<Stmt *()> deferred = nullptr;
+    if (match(TokenKind::SetBrace) && m_LazyBodies) {
+        deferred = skip_body(scope);
+    } else if (match(TokenKind::SetBrace)) {
         body = parse_stmt();
         if (!body)
             fatal("expected function body", &m_Current->md);
@@ -137,24 +142,57 @@ FunctionDecl *Parser::parse_function(const Token &name, std::vector<TemplatePara
     
     exit_scope();
 
-    FunctionDecl *fn = new FunctionDecl(
+    FunctionDecl *fn = m_Context->create<FunctionDecl>(
         m_Runes, 
         name.md, 
-        name.value, 
-        FunctionType::create(m_Context, paramTys, retTy), 
+        String(name.value), 
+        FunctionType::get(m_Context, paramTys, retTy), 
         scope, 
         params,
         body,
         tps
     );
     m_Scope->addDecl(fn);
+
+    if (deferred)
+        fn->setBodyParser(std::move(deferred));
+
     return fn;
 }
 
+std::function<Stmt *()> Parser::skip_body(Scope *scope) {
+    Metadata begin = m_Current->md;
+    Metadata end = begin;
+
+    // Only the braces are needed to find the end of the body. Everything else
+    // is checked once the body is parsed.
+    unsigned depth = 0;
+    do {
+        if (match(TokenKind::SetBrace))
+            ++depth;
+        else if (match(TokenKind::EndBrace))
+            --depth;
+        else if (match(TokenKind::Eof))
+            fatal("expected '}' after function body", &begin);
+
+        end = m_Current->md;
+        next();
+    } while (depth != 0);
+
+    TranslationUnit *unit = m_Unit;
+    uint32_t size = end.loc + 1 - begin.loc;
+    return [unit, scope, begin, size]() -> Stmt * {
+        const File &file = begin.getFile();
+        uint32_t offset = SourceManager::get().getOffset(begin);
+        return parseBody(unit, scope, file.contents.substr(offset, size), 
+            begin);
+    };
+}
+
 VarDecl *Parser::parse_global_var(const Token &name) {
     Type *T = nullptr;
     Expr *init = nullptr;
-    bool mut = m_Current->value == "mut";
+    bool mut = match_keyword(KeywordKind::Mut);
     next(); // 'fix' or 'mut'
 
     T = parse_type();
@@ -175,10 +213,10 @@ VarDecl *Parser::parse_global_var(const Token &name) {
         fatal("expected ';' after variable", &m_Current->md);
     next(); // ';'
 
-    VarDecl *var = new VarDecl(
+    VarDecl *var = m_Context->create<VarDecl>(
         m_Runes,
         name.md,
-        name.value,
+        String(name.value),
         T,
         init,
         mut,
@@ -223,7 +261,7 @@ VarDecl *Parser::parse_var(bool mut) {
     else
         fatal("expected ';' after variable declaration", &m_Current->md);
 
-    VarDecl *var = new VarDecl(
+    VarDecl *var = m_Context->create<VarDecl>(
         Runes(),
         md,
         name,
@@ -238,7 +276,7 @@ VarDecl *Parser::parse_var(bool mut) {
 
 EnumDecl *Parser::parse_enum(const Token &name) {
     std::vector<EnumVariantDecl *> Variants;
-    EnumType *ty = EnumType::create(m_Context, name.value, parse_type());
+    EnumType *ty = EnumType::create(m_Context, String(name.value), parse_type());
 
     if (!match(TokenKind::SetBrace))
         fatal("expected '{' after enum type", &m_Current->md);
@@ -262,7 +300,7 @@ EnumDecl *Parser::parse_enum(const Token &name) {
             if (!match(LiteralKind::Integer))
                 fatal("expected integer literal after '='", &m_Current->md);
             
-            var_val = std::stol(m_Current->value);
+            var_val = get_int_value();
             curr_val = var_val + 1;
             next(); // integer literal
         }
@@ -271,7 +309,7 @@ EnumDecl *Parser::parse_enum(const Token &name) {
         if (m_Runes.has(Rune::Public))
             VariantRunes.set(Rune::Public);
 
-        EnumVariantDecl *Variant = new EnumVariantDecl(
+        EnumVariantDecl *Variant = m_Context->create<EnumVariantDecl>(
             VariantRunes,
             var_md,
             var_name,
@@ -295,10 +333,10 @@ EnumDecl *Parser::parse_enum(const Token &name) {
     if (Variants.empty())
         fatal("enum must have at least one variant", &m_Current->md);
 
-    EnumDecl *Enum = new EnumDecl(
+    EnumDecl *Enum = m_Context->create<EnumDecl>(
         m_Runes,
         name.md,
-        name.value,
+        String(name.value),
         ty,
         Variants
     );
@@ -347,8 +385,9 @@ StructDecl *Parser::parse_struct(const Token &name, std::vector<TemplateParamDec
                           &m_Current->md);
             }
 
-            FieldDecl *F = new FieldDecl(m_Runes, member_name.md, 
-                member_name.value, field_ty, Fields.size(), field_init);
+            FieldDecl *F = m_Context->create<FieldDecl>(m_Runes, 
+                member_name.md, String(member_name.value), field_ty, 
+                Fields.size(), field_init);
             m_Scope->addDecl(F);
             Fields.push_back(F);
 
@@ -376,12 +415,12 @@ StructDecl *Parser::parse_struct(const Token &name, std::vector<TemplateParamDec
     for (auto &F : Fields)
         fieldTys.push_back(F->getType());
 
-    ty = StructType::create(m_Context, name.value, fieldTys);
+    ty = StructType::create(m_Context, String(name.value), fieldTys);
 
-    StructDecl *_struct = new StructDecl(
+    StructDecl *_struct = m_Context->create<StructDecl>(
         runes,
         name.md,
-        name.value,
+        String(name.value),
         ty,
         scope,
         Fields,
@@ -414,7 +453,7 @@ UseDecl *Parser::parse_use() {
             if (!match(TokenKind::Identifier))
                 fatal("expected identifier in listed use declaration", &m_Current->md);
 
-            names.push_back(m_Current->value);
+            names.push_back(String(m_Current->value));
             next(); // identifier
 
             if (match(TokenKind::EndBrace))
@@ -444,11 +483,11 @@ UseDecl *Parser::parse_use() {
 
     UseDecl *use = nullptr;
     if (!name.empty()) {
-        use = new UseDecl(m_Runes, md, path, name);
+        use = m_Context->create<UseDecl>(m_Runes, md, path, name);
     } else if (!names.empty()) {
-        use = new UseDecl(m_Runes, md, path, names);
+        use = m_Context->create<UseDecl>(m_Runes, md, path, names);
     } else {
-        use = new UseDecl(m_Runes, md, path);
+        use = m_Context->create<UseDecl>(m_Runes, md, path);
     }
 
     if (use->isNamed())
@@ -35,23 +35,28 @@ Expr *Parser::parse_primary() {
 }
 
 Expr *Parser::parse_ident() {
-    if (match_keyword("cast"))
+    switch (m_Current->keyword) {
+    case KeywordKind::Cast:
         return parse_cast();
-    else if (match_keyword("nil"))
+    case KeywordKind::Nil:
         return parse_nil();
-    else if (match_keyword("true") || match_keyword("false"))
+    case KeywordKind::True:
+    case KeywordKind::False:
         return parse_bool();
-    else if (match_keyword("sizeof"))
+    case KeywordKind::Sizeof:
         return parse_sizeof();
+    default:
+        break;
+    }
 
     NamedDecl *D = m_Scope->lookup(m_Current->value);
-    if (auto *use = dynamic_cast<UseDecl *>(D)) {
+    if (auto *use = dyn_cast_or_null<UseDecl>(D)) {
         // use::ident
         // use::ident(...)
         // use::ident { ... }
         // ...
         return parse_use_spec(use);
-    } else if (auto *var = dynamic_cast<VarDecl *>(D)) {
+    } else if (D && isa<VarDecl>(D)) {
         // ident
         return parse_ref();
     }
@@ -66,12 +71,14 @@ Expr *Parser::parse_ident() {
         // a less-than operator.
         restore_pos(identPos);
 
-        if (D && dynamic_cast<VarDecl *>(D)) {
+        if (D && isa<VarDecl>(D)) {
             // Since variables cannot be forward referenced, we can assume
             // it's part of a comparison.
             return parse_ref();
         }
 
+        identPos = save_pos();
+
         // The reference is either forward or a non-variable. Since the
         // following tokens could be either a:
         //
@@ -83,7 +90,7 @@ Expr *Parser::parse_ident() {
         //   box<i32>(...)
         //
         // We can start by treating the chunk as a type, and see what follows.
-        parse_type_name();
+        parse_type_ref();
 
         switch (m_Current->kind) {
         case TokenKind::Path:
@@ -125,37 +132,37 @@ Expr *Parser::parse_ident() {
 }
 
 BoolLiteral *Parser::parse_bool() {
-    BoolLiteral *B = new BoolLiteral(
+    BoolLiteral *B = m_Context->create<BoolLiteral>(
         m_Current->md,
         m_Context->getBoolType(),
-        m_Current->value == "true"
+        match_keyword(KeywordKind::True)
     );
     next();
     return B;
 }
 
 IntegerLiteral *Parser::parse_int() {
-    IntegerLiteral *I = new IntegerLiteral(
+    IntegerLiteral *I = m_Context->create<IntegerLiteral>(
         m_Current->md, 
         m_Context->getI64Type(), 
-        std::stoll(m_Current->value)
+        get_int_value()
     );
     next();
     return I;
 }
 
 FloatLiteral *Parser::parse_fp() {
-    FloatLiteral *F = new FloatLiteral(
+    FloatLiteral *F = m_Context->create<FloatLiteral>(
         m_Current->md,
         m_Context->getF64Type(),
-        std::stod(m_Current->value)
+        get_fp_value()
     );
     next();
     return F;
 }
 
 CharLiteral *Parser::parse_char() {
-    CharLiteral *C = new CharLiteral(
+    CharLiteral *C = m_Context->create<CharLiteral>(
         m_Current->md,
         m_Context->getCharType(),
         m_Current->value[0]
@@ -165,17 +172,17 @@ CharLiteral *Parser::parse_char() {
 }
 
 StringLiteral *Parser::parse_str() {
-    StringLiteral *S = new StringLiteral(
+    StringLiteral *S = m_Context->create<StringLiteral>(
         m_Current->md,
         ArrayType::get(m_Context, m_Context->getCharType(), m_Current->value.size() + 1),
-        m_Current->value
+        String(m_Current->value)
     );
     next();
     return S;
 }
 
 NilLiteral *Parser::parse_nil() {
-    NilLiteral *N = new NilLiteral(
+    NilLiteral *N = m_Context->create<NilLiteral>(
         m_Current->md,
         PointerType::get(m_Context, m_Context->getVoidType())
     );
@@ -207,7 +214,7 @@ ArrayExpr *Parser::parse_array() {
         fatal("array enclosed by [, ] cannot be empty", &m_Current->md);
 
     next(); // ']'
-    return new ArrayExpr(md, nullptr, Elements);
+    return m_Context->create<ArrayExpr>(md, nullptr, Elements);
 }
 
 Expr *Parser::parse_binary(Expr *B, int precedence) {
@@ -232,7 +239,7 @@ Expr *Parser::parse_binary(Expr *B, int precedence) {
                 fatal("expected binary expression", &m_Current->md);
         }
 
-        B = new BinaryExpr(
+        B = m_Context->create<BinaryExpr>(
             m_Current->md, 
             B->getType(), 
             op, 
@@ -264,7 +271,7 @@ CastExpr *Parser::parse_cast() {
     if (!E)
         fatal("expected cast sub-expression", &m_Current->md);
 
-    return new CastExpr(md, T, E);
+    return m_Context->create<CastExpr>(md, T, E);
 }
 
 ParenExpr *Parser::parse_paren() {
@@ -280,19 +287,19 @@ ParenExpr *Parser::parse_paren() {
         fatal("expected ')' after expression", &m_Current->md);
 
     next(); // ')'
-    return new ParenExpr(md, E);
+    return m_Context->create<ParenExpr>(md, E);
 }
 
 RefExpr *Parser::parse_ref() {
     Metadata md = m_Current->md;
-    String name = m_Current->value;
+    String name = String(m_Current->value);
 
     NamedDecl *D = m_Scope->lookup(name);
     if (!D && !m_AllowUnresolved)
         fatal("unresolved reference: " + name, &md);
 
     next(); // identifier
-    return new RefExpr(md, nullptr, name, D);
+    return m_Context->create<RefExpr>(md, nullptr, name, D);
 }
 
 CallExpr *Parser::parse_call() {
@@ -351,7 +358,8 @@ CallExpr *Parser::parse_call() {
     }
 
     next(); // ')'
-    return new CallExpr(md, nullptr, callee, nullptr, Args, TArgs);
+    return m_Context->create<CallExpr>(md, nullptr, callee, nullptr, Args, 
+        TArgs);
 }
 
 SizeofExpr *Parser::parse_sizeof() {
@@ -368,7 +376,7 @@ SizeofExpr *Parser::parse_sizeof() {
         fatal("expected '>' after 'sizeof' type", &m_Current->md);
     next(); // '>'
 
-    return new SizeofExpr(md, m_Context->getU64Type(), T);
+    return m_Context->create<SizeofExpr>(md, m_Context->getU64Type(), T);
 }
 
 Expr *Parser::parse_use_spec(UseDecl *use) {
@@ -392,7 +400,7 @@ Expr *Parser::parse_use_spec(UseDecl *use) {
     // the defining tokens '(', '{', etc.
 
     unsigned identPos = save_pos();
-    parse_type_name();
+    parse_type_ref();
 
     switch (m_Current->kind) {
     case TokenKind::SetBrace:
@@ -419,23 +427,24 @@ Expr *Parser::parse_use_spec(UseDecl *use) {
         fatal("expected expression after '::' operator", &m_Current->md);
 
     m_AllowUnresolved = false;
-    RefExpr *R = dynamic_cast<RefExpr *>(E);
+    RefExpr *R = dyn_cast<RefExpr>(E);
     if (!R)
         fatal("expected reference expression after '::' operator", &m_Current->md);
 
-    return new UnitSpecExpr(md, use, R);
+    return m_Context->create<UnitSpecExpr>(md, use, R);
 }
 
 Expr *Parser::parse_spec() {
     Metadata md = m_Current->md;
-    Type *T = nullptr;
-    String name;
     Expr *E = nullptr;
 
     if (!match(TokenKind::Identifier))
         fatal("expected identifier", &md);
 
-    T = parse_type();
+    // The type is created here, like any other, so that it is sanitized with
+    // the rest of the unit, but is then looked up through its reference.
+    TypeRef *ref = parse_type_ref();
+    Type::get(m_Context, ref, m_Scope, m_Current->md);
 
     if (!match(TokenKind::Path))
         fatal("expected '::'", &m_Current->md);
@@ -450,11 +459,11 @@ Expr *Parser::parse_spec() {
         fatal("expected expression after '::' operator", &m_Current->md);
 
     m_AllowUnresolved = false;
-    RefExpr *RE = dynamic_cast<RefExpr *>(E);
+    RefExpr *RE = dyn_cast<RefExpr>(E);
     if (!RE)
         fatal("expected reference expression after '::' operator", &m_Current->md);
 
-    return new TypeSpecExpr(md, T->getName(), RE);
+    return m_Context->create<TypeSpecExpr>(md, ref, RE);
 }
 
 InitExpr *Parser::parse_init() {
@@ -472,7 +481,7 @@ InitExpr *Parser::parse_init() {
         if (!match(TokenKind::Identifier))
             fatal("expected field name", &m_Current->md);
 
-        String name = m_Current->value;
+        String name = String(m_Current->value);
         next(); // identifier
 
         if (!match(TokenKind::Colon))
@@ -484,7 +493,7 @@ InitExpr *Parser::parse_init() {
             fatal("expected field initializer expression", &m_Current->md);
 
         Fields.push_back(
-            new FieldInitExpr(field_md, nullptr, name, E)
+            m_Context->create<FieldInitExpr>(field_md, nullptr, name, E)
         );
 
         if (match(TokenKind::EndBrace))
@@ -500,7 +509,7 @@ InitExpr *Parser::parse_init() {
     if (Fields.empty())
         fatal("initializer enclosed by {, } cannot be empty", &m_Current->md);
 
-    return new InitExpr(md, T, Fields);
+    return m_Context->create<InitExpr>(md, T, Fields);
 }
 
 Expr *Parser::parse_unary_prefix() {
@@ -513,7 +522,7 @@ Expr *Parser::parse_unary_prefix() {
         if (!E)
             fatal("expected unary prefix expression", &m_Current->md);
 
-        return new UnaryExpr(md, nullptr, op, E, false);
+        return m_Context->create<UnaryExpr>(md, nullptr, op, E, false);
     } else
         return parse_unary_postfix();
 }
@@ -531,7 +540,7 @@ Expr *Parser::parse_unary_postfix() {
             // Operator is a recognized postfix unary operator.
             next();
 
-            E = new UnaryExpr(md, nullptr, op, E, true);
+            E = m_Context->create<UnaryExpr>(md, nullptr, op, E, true);
         } else if (match(TokenKind::SetBrack)) {
             // Token is not an operator, but a subscript beginning '['
             next(); // '['
@@ -544,7 +553,7 @@ Expr *Parser::parse_unary_postfix() {
                 fatal("expected ']' after subscript index", &m_Current->md);
             next(); // ']'
 
-            E = new SubscriptExpr(md, nullptr, E, Idx);
+            E = m_Context->create<SubscriptExpr>(md, nullptr, E, Idx);
         } else if (match(TokenKind::Dot)) {
             // Token is not an operator, but an access with '.'
             next(); // '.'
@@ -554,7 +563,7 @@ Expr *Parser::parse_unary_postfix() {
                     &m_Current->md);
             }
 
-            String member = m_Current->value;
+            String member = String(m_Current->value);
             next(); // identifier
 
             std::vector<Type *> TArgs;
@@ -604,9 +613,10 @@ Expr *Parser::parse_unary_postfix() {
 
                 next(); // ')'
 
-                E = new MethodCallExpr(md, nullptr, member, E, nullptr, Args, TArgs);
+                E = m_Context->create<MethodCallExpr>(md, nullptr, member, E, 
+                    nullptr, Args, TArgs);
             } else {
-                E = new AccessExpr(md, nullptr, member, E);
+                E = m_Context->create<AccessExpr>(md, nullptr, member, E);
             }
         } else
             break;
@@ -621,12 +631,10 @@ Expr *Parser::parse_rune_expr() {
     if (!match(TokenKind::Identifier))
         fatal("expected identifier after rune symbol '$'", &m_Current->md);
 
-    String ident = m_Current->value;
-
-    if (ident == "syscall")
+    if (match_keyword(KeywordKind::Syscall))
         return parse_rune_syscall();
     else
-        fatal("unknown rune: " + ident, &m_Current->md);
+        fatal("unknown rune: " + String(m_Current->value), &m_Current->md);
 }
 
 RuneSyscallExpr *Parser::parse_rune_syscall() {
@@ -642,7 +650,7 @@ RuneSyscallExpr *Parser::parse_rune_syscall() {
     if (!match(LiteralKind::Integer))
         fatal("expected syscall number", &m_Current->md);
 
-    num = std::stoul(m_Current->value);
+    num = get_int_value();
     next(); // syscall number
 
     if (!match(TokenKind::Right))
@@ -669,5 +677,6 @@ RuneSyscallExpr *Parser::parse_rune_syscall() {
     }
 
     next(); // ')'
-    return new RuneSyscallExpr(md, m_Context->getI64Type(), num, Args);
+    return m_Context->create<RuneSyscallExpr>(md, m_Context->getI64Type(), 
+        num, Args);
 }
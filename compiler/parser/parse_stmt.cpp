@@ -6,22 +6,27 @@ using namespace meddle;
 Stmt *Parser::parse_stmt() {
     if (match(TokenKind::SetBrace))
         return parse_compound();
-    else if (match_keyword("break"))
+
+    // Only identifiers are ever classified as keywords.
+    switch (m_Current->keyword) {
+    case KeywordKind::Break:
         return parse_break();
-    else if (match_keyword("continue"))
+    case KeywordKind::Continue:
         return parse_continue();
-    else if (match_keyword("fix") || match_keyword("mut"))
+    case KeywordKind::Fix:
+    case KeywordKind::Mut:
         return parse_decl_stmt();
-    else if (match_keyword("if"))
+    case KeywordKind::If:
         return parse_if();
-    else if (match_keyword("match"))
+    case KeywordKind::Match:
         return parse_match();
-    else if (match_keyword("ret"))
+    case KeywordKind::Ret:
         return parse_ret();
-    else if (match_keyword("until"))
+    case KeywordKind::Until:
         return parse_until();
-
-    return parse_expr_stmt();
+    default:
+        return parse_expr_stmt();
+    }
 }
 
 BreakStmt *Parser::parse_break() {
@@ -32,7 +37,7 @@ BreakStmt *Parser::parse_break() {
         fatal("expected ';' after break statement", &md);
 
     next(); // ';'
-    return new BreakStmt(md);
+    return m_Context->create<BreakStmt>(md);
 }
 
 ContinueStmt *Parser::parse_continue() {
@@ -43,11 +48,12 @@ ContinueStmt *Parser::parse_continue() {
         fatal("expected ';' after continue statement", &md);
 
     next(); // ';'
-    return new ContinueStmt(md);
+    return m_Context->create<ContinueStmt>(md);
 }
 
 CompoundStmt *Parser::parse_compound() {
-    CompoundStmt *C = new CompoundStmt(m_Current->md, enter_scope());
+    CompoundStmt *C = m_Context->create<CompoundStmt>(m_Current->md, 
+        enter_scope());
     next(); // '{'
 
     while (!match(TokenKind::EndBrace)) {
@@ -69,9 +75,9 @@ CompoundStmt *Parser::parse_compound() {
 DeclStmt *Parser::parse_decl_stmt() {
     Decl *D = nullptr;
 
-    if (match_keyword("fix"))
+    if (match_keyword(KeywordKind::Fix))
         D = parse_var(false);
-    else if (match_keyword("mut"))
+    else if (match_keyword(KeywordKind::Mut))
         D = parse_var(true);
 
     if (!D)
@@ -80,7 +86,7 @@ DeclStmt *Parser::parse_decl_stmt() {
     if (match(TokenKind::Semi))
         next();
 
-    return new DeclStmt(D->getMetadata(), D);
+    return m_Context->create<DeclStmt>(D->getMetadata(), D);
 }
 
 ExprStmt *Parser::parse_expr_stmt() {
@@ -88,7 +94,7 @@ ExprStmt *Parser::parse_expr_stmt() {
     if (!E)
         return nullptr;
 
-    return new ExprStmt(E->getMetadata(), E);
+    return m_Context->create<ExprStmt>(E->getMetadata(), E);
 }
 
 IfStmt *Parser::parse_if() {
@@ -106,14 +112,14 @@ IfStmt *Parser::parse_if() {
     if (!T)
         fatal("expected statement after 'if' condition", &m_Current->md);
 
-    if (match_keyword("else")) {
+    if (match_keyword(KeywordKind::Else)) {
         next(); // 'else'
         E = parse_stmt();
         if (!E)
             fatal("expected statement after 'else'", &m_Current->md);
     }
 
-    return new IfStmt(md, C, T, E);
+    return m_Context->create<IfStmt>(md, C, T, E);
 }
 
 MatchStmt *Parser::parse_match() {
@@ -132,7 +138,7 @@ MatchStmt *Parser::parse_match() {
     next(); // '{'
 
     while (!match(TokenKind::EndBrace)) {
-        if (match_keyword("_")) {
+        if (match_keyword(KeywordKind::Underscore)) {
             if (D)
                 fatal("duplicate default case", &m_Current->md);
             next(); // '_'
@@ -157,7 +163,7 @@ MatchStmt *Parser::parse_match() {
             if (!B)
                 fatal("expected statement after case expression", &m_Current->md);
 
-            cases.push_back(new CaseStmt(md, CP, B));
+            cases.push_back(m_Context->create<CaseStmt>(md, CP, B));
         }
 
         if (match(TokenKind::EndBrace))
@@ -172,7 +178,7 @@ MatchStmt *Parser::parse_match() {
     if (cases.empty())
         fatal("match statement must have at least one case", &m_Current->md);
 
-    return new MatchStmt(md, P, cases, D);
+    return m_Context->create<MatchStmt>(md, P, cases, D);
 }
 
 RetStmt *Parser::parse_ret() {
@@ -192,7 +198,7 @@ RetStmt *Parser::parse_ret() {
     }
 
     next(); // ';'
-    return new RetStmt(md, E);    
+    return m_Context->create<RetStmt>(md, E);    
 }
 
 UntilStmt *Parser::parse_until() {
@@ -209,5 +215,5 @@ UntilStmt *Parser::parse_until() {
     if (!B)
         fatal("expected statement after 'until' condition", &m_Current->md);
 
-    return new UntilStmt(md, C, B);
+    return m_Context->create<UntilStmt>(md, C, B);
 }
@@ -1,16 +1,39 @@
 #include "parser.h"
 #include "../core/logger.h"
+#include "../lexer/lexer.h"
+
+#include <charconv>
 
 using namespace meddle;
 
 void Parser::backtrack(unsigned n) {
-    m_Stream.setPos(m_Stream.getPos() - n);
-    m_Current = &m_Stream.m_Buffer[m_Stream.m_Iter - 1];
+    m_Stream.setPos(m_Stream.getPos() - n - 1);
+    m_Current = m_Stream.get();
 }
 
 void Parser::skip(unsigned n) {
-    m_Stream.setPos(m_Stream.getPos() + n);
-    m_Current = &m_Stream.m_Buffer[m_Stream.m_Iter - 1];
+    for (unsigned i = 0; i != n; ++i)
+        next();
+}
+
+long long Parser::get_int_value() const {
+    long long value = 0;
+    std::string_view S = m_Current->value;
+    auto [ ptr, ec ] = std::from_chars(S.data(), S.data() + S.size(), value);
+    if (ec != std::errc() || ptr != S.data() + S.size())
+        fatal("invalid integer literal: " + String(S), &m_Current->md);
+
+    return value;
+}
+
+double Parser::get_fp_value() const {
+    double value = 0;
+    std::string_view S = m_Current->value;
+    auto [ ptr, ec ] = std::from_chars(S.data(), S.data() + S.size(), value);
+    if (ec != std::errc() || ptr != S.data() + S.size())
+        fatal("invalid floating point literal: " + String(S), &m_Current->md);
+
+    return value;
 }
 
 int Parser::get_bin_precedence() const {
@@ -130,104 +153,37 @@ UnaryExpr::Kind Parser::get_un_operator() const {
     }
 }
 
-String Parser::parse_type_name() {
+TypeRef *Parser::parse_type_ref() {
     if (!match(TokenKind::Identifier))
         fatal("expected type identifier", &m_Current->md);
     
-    Metadata md = m_Current->md;
-    String name = m_Current->value;
+    std::string_view base = m_Current->value;
+    Ident name = Ident();
     next();
 
     if (match(TokenKind::Path)) {
-        NamedDecl *named = m_Scope->lookup(name);
-        if (!dynamic_cast<UseDecl *>(named))
-            fatal("expected use declaration before namespaced type", &md);
-
-        name += "::";
-        next();
-
-        if (!match(TokenKind::Identifier))
-            fatal("expected type identifier", &m_Current->md);
-        
-        name += m_Current->value;
-        next();
-    }
-
-    if (match(TokenKind::Left)) {
-        name += "<";
-        next();
-
-        while (!match(TokenKind::Right)) {
-            name += parse_type_name();
-
-            if (match(TokenKind::Right))
-                break;
-
-            if (!match(TokenKind::Comma))
-                fatal("expected ',' or '>' in type argument list", &m_Current->md);
-            next();
-            name += ", ";
-        }
-
-        next(); // Consume '>'
-        name += ">";
-    }
-
-    while (1) {
-        if (match(TokenKind::Star))
-            name += '*';
-        else if (match(TokenKind::SetBrack)) {
-            name += '[';
-            next();
-
-            if (!match(LiteralKind::Integer))
-                fatal("expected integer literal", &m_Current->md);
-
-            name += m_Current->value;
-            next();
-
-            if (!match(TokenKind::EndBrack))
-                fatal("expected ']' after array size", &m_Current->md);
-
-            name += ']';
-        } else
-            break;
-
-        next();
-    }
-
-    return name;
-}
-
-Type *Parser::parse_type() {
-    if (!match(TokenKind::Identifier))
-        fatal("expected type identifier", &m_Current->md);
-    
-    Metadata md = m_Current->md;
-    String name = m_Current->value;
-    next();
-
-    if (match(TokenKind::Path)) {
-        NamedDecl *named = m_Scope->lookup(name);
-        if (dynamic_cast<UseDecl *>(named)) {
-            name += "::";
+        NamedDecl *named = m_Scope->lookup(base);
+        if (named && isa<UseDecl>(named)) {
             next();
 
             if (!match(TokenKind::Identifier))
                 fatal("expected type identifier", &m_Current->md);
             
-            name += m_Current->value;
+            name = Ident::get(String(base) + "::" + String(m_Current->value));
             next();
         }
     }
 
+    if (name.empty())
+        name = Ident::get(base);
+
+    TypeRef *ref = nullptr;
     if (match(TokenKind::Left)) {
-        name += "<";
         next();
 
+        std::vector<TypeRef *> args;
         while (!match(TokenKind::Right)) {
-            Type *argTy = parse_type();
-            name += argTy->getName();
+            args.push_back(parse_type_ref());
 
             if (match(TokenKind::Right))
                 break;
@@ -235,37 +191,40 @@ Type *Parser::parse_type() {
             if (!match(TokenKind::Comma))
                 fatal("expected ',' or '>' in type argument list", &m_Current->md);
             next();
-            name += ", ";
         }
 
         next(); // Consume '>'
-        name += ">";
+        ref = TypeRef::createTemplate(m_Context, name, args);
+    } else {
+        ref = TypeRef::createNamed(m_Context, name);
     }
 
     while (1) {
         if (match(TokenKind::Star))
-            name += '*';
+            ref = TypeRef::createPointer(m_Context, ref);
         else if (match(TokenKind::SetBrack)) {
-            name += '[';
             next();
 
             if (!match(LiteralKind::Integer))
                 fatal("expected integer literal", &m_Current->md);
 
-            name += m_Current->value;
+            ref = TypeRef::createArray(m_Context, ref, get_int_value());
             next();
 
             if (!match(TokenKind::EndBrack))
                 fatal("expected ']' after array size", &m_Current->md);
-
-            name += ']';
         } else
             break;
 
         next();
     }
 
-    return Type::get(m_Context, name, m_Scope, m_Current->md);
+    return ref;
+}
+
+Type *Parser::parse_type() {
+    TypeRef *ref = parse_type_ref();
+    return Type::get(m_Context, ref, m_Scope, m_Current->md);
 }
 
 void Parser::parse_runes() {
@@ -284,15 +243,20 @@ void Parser::parse_runes() {
         if (!match(TokenKind::Identifier))
             fatal("expected rune identifier", &m_Current->md);
 
-        String name = m_Current->value;
-        if (name == "associated")
+        switch (m_Current->keyword) {
+        case KeywordKind::Associated:
             m_Runes.set(Rune::Associated);
-        else if (name == "no_mangle")
+            break;
+        case KeywordKind::NoMangle:
             m_Runes.set(Rune::NoMangle);
-        else if (name == "public")
+            break;
+        case KeywordKind::Public:
             m_Runes.set(Rune::Public);
-        else
-            warn("unknown rune: " + name, &m_Current->md);
+            break;
+        default:
+            warn("unknown rune: " + String(m_Current->value), &m_Current->md);
+            break;
+        }
 
         next();
 
@@ -311,26 +275,71 @@ void Parser::parse_runes() {
     }
 }
 
-Parser::Parser(const File &F, const TokenStream &S) : m_Stream(S) {
+Parser::Parser(const File &F, TokenStream S, const Options *opts) 
+  : m_Stream(std::move(S)), m_LazyBodies(opts && opts->LazyBodies) {
     // Get the filename with no extension.
     String id = F.filename;
     size_t pos = id.find_last_of('.');
     if (pos != String::npos)
         id = id.substr(0, pos);
 
-    m_Unit = new TranslationUnit(id, F);
+    m_Current = m_Stream.get();
+    m_Unit = new TranslationUnit(id, m_Current->md.getFile());
     m_Context = m_Unit->getContext();
     m_Scope = m_Unit->getScope();
-    m_Current = m_Stream.get();
 
     while (!m_Stream.isEnd() && !match(TokenKind::Eof)) {
         Decl *D = parse_decl();
         if (!D)
             fatal("expected declaration", &m_Current->md);
 
-        if (auto *use = dynamic_cast<UseDecl *>(D))
+        if (auto *use = dyn_cast<UseDecl>(D))
             m_Unit->addUse(use);
         else
             m_Unit->addDecl(D);
     }
 }
+
+Parser::Parser(Context *C, Scope *S, TokenStream stream) 
+  : m_Stream(std::move(stream)), m_Unit(nullptr), m_Context(C), m_Scope(S) {
+    m_Current = m_Stream.get();
+}
+
+Stmt *Parser::parseBody(TranslationUnit *U, Scope *S, std::string_view src, 
+                        Metadata loc) {
+    // Parsing creates nodes and types in the context of the unit, which
+    // importing units may also be specializing templates in.
+    std::lock_guard<std::recursive_mutex> lock(U->getSpecializationLock());
+
+    Context *ctx = U->getContext();
+    Lexer lexer = Lexer(src, loc);
+    Parser parser = Parser(ctx, S, TokenStream(lexer));
+    if (!parser.match(TokenKind::SetBrace))
+        fatal("expected function body", &loc);
+
+    Stmt *body = parser.parse_stmt();
+
+    // Types named in the body are usually resolved along with the rest of
+    // the unit, unless that has already happened.
+    if (ctx->isSanitized())
+        ctx->sanitate();
+
+    return body;
+}
+
+Expr *Parser::parseExpr(TranslationUnit *U, Scope *S, std::string_view src, 
+                        Metadata loc) {
+    std::lock_guard<std::recursive_mutex> lock(U->getSpecializationLock());
+
+    Context *ctx = U->getContext();
+    Lexer lexer = Lexer(src, loc);
+    Parser parser = Parser(ctx, S, TokenStream(lexer));
+    Expr *E = parser.parse_expr();
+    if (!E || !parser.match(TokenKind::Eof))
+        fatal("expected expression", &loc);
+
+    if (ctx->isSanitized())
+        ctx->sanitate();
+
+    return E;
+}
@@ -5,6 +5,8 @@
 #include "../tree/stmt.h"
 #include "../tree/unit.h"
 #include "../core/logger.h"
+#include "../core/options.h"
+#include <functional>
 #include <vector>
 
 namespace meddle {
@@ -19,17 +21,33 @@ class Parser final {
     Runes m_Runes;
     bool m_AllowUnresolved = false;
 
+    /// If function bodies are skipped over, to be parsed once needed.
+    bool m_LazyBodies = false;
+
+    /// Create a parser for a function body in \p C and \p S that starts at
+    /// the first token of \p S.
+    Parser(Context *C, Scope *S, TokenStream stream);
+
     void next() { m_Current = m_Stream.get(); }
 
     void backtrack(unsigned n = 1);
 
     void skip(unsigned n = 1);
 
-    unsigned save_pos() { return m_Saved = m_Stream.getPos(); }
+    /// Save the current position to return to with restore_pos(). Tokens from
+    /// the saved position onwards are kept alive until then.
+    unsigned save_pos() { 
+        m_Saved = m_Stream.getPos();
+        m_Stream.pin(m_Saved - 1);
+        return m_Saved;
+    }
 
+    /// Return to a position saved with save_pos(). This releases the saved
+    /// position, so it must be saved again to be restored to more than once.
     void restore_pos(unsigned pos) {
         m_Stream.setPos(pos - 1);
         m_Current = m_Stream.get();
+        m_Stream.unpin();
     }
 
     bool match(TokenKind K) const { return m_Current->kind == K; }
@@ -39,11 +57,17 @@ class Parser final {
             && m_Current->literal == K;
     }
 
-    bool match_keyword(const char *KW) const {
+    bool match_keyword(KeywordKind K) const {
         return m_Current->kind == TokenKind::Identifier 
-            && m_Current->value == KW;
+            && m_Current->keyword == K;
     }
 
+    /// \returns The value of the current integer literal token.
+    long long get_int_value() const;
+
+    /// \returns The value of the current floating point literal token.
+    double get_fp_value() const;
+
     void expect(TokenKind K, const String &msg) const {
         if (m_Current->kind != K)
             fatal(msg, &m_Current->md);
@@ -55,7 +79,7 @@ class Parser final {
         next();
     }
 
-    Scope *enter_scope() { return m_Scope = new Scope(m_Scope); }
+    Scope *enter_scope() { return m_Scope = m_Context->create<Scope>(m_Scope); }
 
     void exit_scope() { m_Scope = m_Scope->getParent(); }
 
@@ -68,12 +92,18 @@ class Parser final {
     /// Returns the equivelant unary operator kind for the current token.
     UnaryExpr::Kind get_un_operator() const;
 
-    String parse_type_name();
+    TypeRef *parse_type_ref();
     Type *parse_type();
     void parse_runes();
 
     Decl *parse_decl();
     FunctionDecl *parse_function(const Token &name, std::vector<TemplateParamDecl *> tps);
+
+    /// Skip over the function body at the current token, which has the scope
+    /// \p scope.
+    ///
+    /// \returns A parser for the body.
+    std::function<Stmt *()> skip_body(Scope *scope);
     VarDecl *parse_global_var(const Token &name);
     VarDecl *parse_var(bool mut);
     EnumDecl *parse_enum(const Token &name);
@@ -119,9 +149,25 @@ class Parser final {
     RuneSyscallExpr *parse_rune_syscall();
 
 public:
-    Parser(const File &F, const TokenStream &S);
+    /// Parse \p F from the tokens of \p S. If \p opts asks for lazy bodies,
+    /// function bodies are only parsed once they are first needed.
+    Parser(const File &F, TokenStream S, const Options *opts = nullptr);
+
+    /// Parse \p F while pulling tokens from \p L on demand.
+    Parser(const File &F, Lexer &L, const Options *opts = nullptr) 
+      : Parser(F, TokenStream(L), opts) {}
 
     TranslationUnit *get() const { return m_Unit; }
+
+    /// Parse the function body \p src, which is found at \p loc, in the scope
+    /// \p S of its function in \p U.
+    static Stmt *parseBody(TranslationUnit *U, Scope *S, std::string_view src, 
+                           Metadata loc);
+
+    /// Parse the expression \p src, which is found at \p loc, in the scope
+    /// \p S of \p U.
+    static Expr *parseExpr(TranslationUnit *U, Scope *S, std::string_view src, 
+                           Metadata loc);
 };
 
 } // namespace meddle
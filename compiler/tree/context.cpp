@@ -7,170 +7,119 @@
 using namespace meddle;
 
 Context::Context(TranslationUnit *U) : m_Unit(U) {
-    m_Primitives.reserve(12);
+    m_Primitives.reserve(13);
     for (unsigned K = 0; K <= 12; ++K) {
-        auto *T = new PrimitiveType(static_cast<PrimitiveType::Kind>(K));
-        m_Primitives[T->getName()] = T;
+        auto *T = create<PrimitiveType>(static_cast<PrimitiveType::Kind>(K));
+        m_Primitives[Ident::get(T->getName())] = T;
+        m_PrimitiveTypes[K] = T;
     }
 }
 
-Context::~Context() {
-    for (auto &[N, T] : m_Primitives)
-        delete T;
-
-    for (auto &[N, T] : m_Enums)
-        delete T;
-    
-    for (auto &[N, T] : m_Structs)
-        delete T;
-    
-    for (auto &[N, T] : m_StructSpecs)
-        delete T;
-    
-    for (auto &[N, T] : m_Dependents)
-        delete T;
-    
-    for (auto &[N, D] : m_Deferred)
-        delete D;
-    
-    for (auto &FT : m_FunctionTypes)
-        delete FT;
-
-    m_Primitives.clear();
-    m_Enums.clear();
-    m_Structs.clear();
-    m_StructSpecs.clear();
-    m_Dependents.clear();
-    m_Deferred.clear();
-    m_FunctionTypes.clear();
-    m_Externals.clear();
-}
-
-Type *Context::resolveType(const String &name, const Scope *scope, 
+Type *Context::resolveType(TypeRef *ref, const Scope *scope, 
                            const Metadata &md, bool specialize) {
-    if (NamedDecl *N = scope->lookup(name)) {
-        if (TypeDecl *TD = dynamic_cast<TypeDecl *>(N))
-            return TD->getDefinedType();
+    if (ref->m_Resolved)
+        return ref->m_Resolved;
 
-        return nullptr;
-    }
+    Type *T = nullptr;
+    switch (ref->getKind()) {
+    case TypeRef::Kind::Named: {
+        if (NamedDecl *N = scope->lookup(ref->getName())) {
+            if (TypeDecl *TD = dyn_cast<TypeDecl>(N))
+                T = TD->getDefinedType();
 
-    if (name.back() == '*') {
-        String pointeeName = name.substr(0, name.size() - 1);
-        Type *pointeeType = resolveType(pointeeName, scope, md, specialize);
-        if (!pointeeType)
-            return nullptr;
+            break;
+        }
 
-        return PointerType::get(this, pointeeType);
+        Ident name = ref->getName();
+        if (auto it = m_Primitives.find(name); it != m_Primitives.end())
+            T = it->second;
+        else if (auto it = m_Enums.find(name); it != m_Enums.end())
+            T = it->second;
+        else if (auto it = m_Structs.find(name); it != m_Structs.end())
+            T = it->second;
+        else if (auto it = m_Externals.find(name); it != m_Externals.end())
+            T = it->second;
+
+        break;
     }
 
-    auto LBrack = name.find_last_of('[');
-    auto RBrack = name.find_last_of(']');
-    if (LBrack != std::string::npos && RBrack != std::string::npos) {
-        String elementName = name.substr(0, LBrack);
-        Type *elementType = resolveType(elementName, scope, md, specialize);
-        if (!elementType)
-            return nullptr;
-        
-        unsigned size = std::stoul(name.substr(LBrack + 1, RBrack - LBrack - 1));
-        return ArrayType::get(this, elementType, size);
-    }
+    case TypeRef::Kind::Pointer:
+        if (Type *pointee = resolveType(ref->getBase(), scope, md, specialize))
+            T = PointerType::get(this, pointee);
+
+        break;
+
+    case TypeRef::Kind::Array:
+        if (Type *element = resolveType(ref->getBase(), scope, md, specialize))
+            T = ArrayType::get(this, element, ref->getSize());
 
-    auto LAngle = name.find_last_of('<');
-    auto RAngle = name.find_last_of('>');
-    if (LAngle != std::string::npos && RAngle != std::string::npos) {
-        String tmplName = name.substr(0, LAngle);
+        break;
+
+    case TypeRef::Kind::Template: {
         StructDecl *tmpl = nullptr;
-        if (NamedDecl *N = scope->lookup(tmplName)) {
-            tmpl = dynamic_cast<StructDecl *>(N);
-            if (!tmpl || !tmpl->isTemplate())
-                fatal("specialization base type is not a template: " + tmplName, &md);
+        if (NamedDecl *N = scope->lookup(ref->getName())) {
+            tmpl = dyn_cast<StructDecl>(N);
+            if (!tmpl || !tmpl->isTemplate()) {
+                fatal("specialization base type is not a template: " + 
+                    ref->getName().str(), &md);
+            }
         }
 
-        String args = name.substr(LAngle + 1, RAngle - LAngle - 1);
         std::vector<Type *> typeArgs;
-        unsigned start = 0;
-        unsigned end = 0;
-        unsigned level = 0;
-
-        for (unsigned i = 0; i <= args.length(); ++i) {
-            char c = (i < args.length()) ? args[i] : ',';
-            if (c == '<')
-                level++;
-            else if (c == '>')
-                level--;
-
-            else if (c == ',' && level == 0) {
-                String argName = args.substr(start, i - start);
-                argName.erase(0, argName.find_first_not_of(" \t"));
-                argName.erase(argName.find_last_not_of(" \t") + 1);
-
-                Type *argType = resolveType(argName, scope, md, specialize);
-                if (!argType)
-                    return nullptr;
-
-                typeArgs.push_back(argType);
-                start = i + 1;
-            }
+        typeArgs.reserve(ref->getArgs().size());
+        for (auto &arg : ref->getArgs()) {
+            Type *argType = resolveType(arg, scope, md, specialize);
+            if (!argType)
+                return nullptr;
+
+            typeArgs.push_back(argType);
         }
 
-        if (!specialize)
+        if (!specialize || !tmpl)
             return nullptr;
 
         for (auto &arg : typeArgs)
             if (arg->isParamDependent())
                 return DependentTemplateStructType::get(this, tmpl, typeArgs);
 
-        return tmpl->fetchSpecialization(typeArgs)->getDefinedType();
+        T = tmpl->fetchSpecialization(typeArgs)->getDefinedType();
+        break;
+    }
     }
-    
-    auto prim_it = m_Primitives.find(name);
-    if (prim_it != m_Primitives.end())
-        return prim_it->second;
-
-    auto enum_it = m_Enums.find(name);
-    if (enum_it != m_Enums.end())
-        return enum_it->second;
-
-    auto struct_it = m_Structs.find(name);
-    if (struct_it != m_Structs.end())
-        return struct_it->second;
-
-    auto spec_it = m_StructSpecs.find(name);
-    if (spec_it != m_StructSpecs.end())
-        return spec_it->second;
-
-    auto ext_it = m_Externals.find(name);
-    if (ext_it != m_Externals.end())
-        return ext_it->second;
 
-    return nullptr;
+    return ref->m_Resolved = T;
 }
 
 void Context::importType(Type *T, const String &N) {
     assert(T && "Type cannot be null.");
 
-    auto it = m_Externals.find(N.empty() ? T->getName() : N);
-    if (it != m_Externals.end())
+    Ident name = Ident::get(N.empty() ? T->getName() : N);
+    if (!m_Externals.emplace(name, T).second)
         fatal("multiple types with same name: " + N, nullptr);
-
-    m_Externals[N.empty() ? T->getName() : N] = T;
 }
 
 void Context::sanitate() {
+    // Types that have been resolved by an earlier call are left alone.
+    auto begin = m_DeferredOrder.begin() + m_NumSanitized;
+
     // For each type result, try to resolve its concrete type from the pool.
-    for (auto &[name, defer] : m_Deferred) {
-        Type *concrete = resolveType(name, defer->getScope(), defer->getMetadata(), false);
+    for (auto it = begin; it != m_DeferredOrder.end(); ++it) {
+        DeferredType *defer = *it;
+        Type *concrete = resolveType(defer->getRef(), defer->getScope(), defer->getMetadata(), false);
         if (concrete)
             defer->setUnderlying(concrete);
     }
 
-    for (auto &[name, defer] : m_Deferred) {
-        Type *concrete = resolveType(name, defer->getScope(), defer->getMetadata(), true);
+    for (auto it = begin; it != m_DeferredOrder.end(); ++it) {
+        DeferredType *defer = *it;
+        Type *concrete = resolveType(defer->getRef(), defer->getScope(), defer->getMetadata(), true);
         if (!concrete)
             // If the type is not found, it is unresolved at this point.
-            fatal("unresolved type: " + name, &defer->getMetadata());
+            fatal("unresolved type: " + defer->getName(), &defer->getMetadata());
 
         defer->setUnderlying(concrete);
     }
+
+    m_NumSanitized = m_DeferredOrder.size();
+    m_Sanitized = true;
 }
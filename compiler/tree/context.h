@@ -2,6 +2,9 @@
 #define MEDDLE_TREE_CONTEXT_H
 
 #include "type.h"
+#include "typeref.h"
+#include "../core/arena.h"
+#include "../core/ident.h"
 
 #include <unordered_map>
 #include <string>
@@ -24,58 +27,123 @@ class Context final {
     friend class TemplateStructType;
     friend class DependentTemplateStructType;
     friend class NameResolution;
+    friend class TypeRef;
 
     TranslationUnit *m_Unit;
-    std::unordered_map<String, PrimitiveType *> m_Primitives;
-    std::unordered_map<String, ArrayType *> m_Arrays;
-    std::unordered_map<String, PointerType *> m_Pointers;
-    std::unordered_map<String, EnumType *> m_Enums;
-    std::unordered_map<String, StructType *> m_Structs;
-    std::unordered_map<String, TemplateStructType *> m_StructSpecs;
-    std::unordered_map<String, DependentTemplateStructType *> m_Dependents;
-    std::unordered_map<String, DeferredType *> m_Deferred;
-    std::unordered_map<String, Type *> m_Externals;
-    std::vector<FunctionType *> m_FunctionTypes;
-
-    Type *resolveType(const String &name, const Scope *scope,
-                      const Metadata &md, bool specialize);
+
+    /// Every type, type reference and tree node of the unit lives in this
+    /// arena, and is destroyed along with the context.
+    Arena m_Arena;
+
+    struct ArrayKey final {
+        Type *element;
+        unsigned size;
+
+        bool operator==(const ArrayKey &other) const
+        { return element == other.element && size == other.size; }
+    };
+
+    struct ArrayKeyHash final {
+        size_t operator()(const ArrayKey &key) const {
+            return std::hash<Type *>()(key.element) * 31 + key.size;
+        }
+    };
+
+    /// Named types are keyed by their interned name. Interned names hash by
+    /// address, so deferred types are also kept in creation order to sanitize
+    /// them in the same order on every run.
+    std::unordered_map<Ident, PrimitiveType *> m_Primitives;
+
+    /// The primitive types, indexed by their kind.
+    PrimitiveType *m_PrimitiveTypes[13];
+
+    std::unordered_map<Ident, EnumType *> m_Enums;
+    std::unordered_map<Ident, StructType *> m_Structs;
+    std::unordered_map<Ident, DeferredType *> m_Deferred;
+    std::vector<DeferredType *> m_DeferredOrder;
+
+    /// The number of deferred types that have been sanitized so far, and if
+    /// the context has been sanitized at all.
+    size_t m_NumSanitized = 0;
+    bool m_Sanitized = false;
+    std::unordered_map<Ident, Type *> m_Externals;
+
+    /// Composite types are hash-consed by their components, so that two of
+    /// them are the same type exactly when they are the same pointer. Types
+    /// keyed by a list of components are bucketed by a hash of the list, and
+    /// compared component-wise on a probe.
+    std::unordered_map<Type *, PointerType *> m_Pointers;
+    std::unordered_map<ArrayKey, ArrayType *, ArrayKeyHash> m_Arrays;
+    std::unordered_multimap<size_t, FunctionType *> m_FunctionTypes;
+    std::unordered_multimap<size_t, DependentTemplateStructType *> m_Dependents;
+
+    /// \returns The type that \p ref refers to from \p scope, or null if it
+    /// is not known yet. Templates are only specialized if \p specialize is
+    /// set.
+    Type *resolveType(TypeRef *ref, const Scope *scope, const Metadata &md, 
+                      bool specialize);
 
 public:
     Context(TranslationUnit *U = nullptr);
 
-    ~Context();
+    Arena &getArena() { return m_Arena; }
+
+    /// Construct a new \p T in the arena of this context from \p args. The
+    /// object lives as long as the context does.
+    template <typename T, typename... Args>
+    T *create(Args &&...args) 
+    { return m_Arena.create<T>(std::forward<Args>(args)...); }
 
-    Type *getBoolType() const { return m_Primitives.at("bool"); }
+    Type *getBoolType() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Bool)]; }
 
-    Type *getVoidType() const { return m_Primitives.at("void"); }
+    Type *getVoidType() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Void)]; }
 
-    Type *getCharType() const { return m_Primitives.at("char"); }
+    Type *getCharType() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Char)]; }
 
-    Type *getI8Type() const { return m_Primitives.at("i8"); }
+    Type *getI8Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Int8)]; }
 
-    Type *getI16Type() const { return m_Primitives.at("i16"); }
+    Type *getI16Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Int16)]; }
 
-    Type *getI32Type() const { return m_Primitives.at("i32"); }
+    Type *getI32Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Int32)]; }
 
-    Type *getI64Type() const { return m_Primitives.at("i64"); }
+    Type *getI64Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Int64)]; }
 
-    Type *getU8Type() const { return m_Primitives.at("u8"); }
+    Type *getU8Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::UInt8)]; }
 
-    Type *getU16Type() const { return m_Primitives.at("u16"); }
+    Type *getU16Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::UInt16)]; }
 
-    Type *getU32Type() const { return m_Primitives.at("u32"); }
+    Type *getU32Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::UInt32)]; }
 
-    Type *getU64Type() const { return m_Primitives.at("u64"); }
+    Type *getU64Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::UInt64)]; }
 
-    Type *getF32Type() const { return m_Primitives.at("f32"); }
+    Type *getF32Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Float32)]; }
 
-    Type *getF64Type() const { return m_Primitives.at("f64"); }
+    Type *getF64Type() const 
+    { return m_PrimitiveTypes[unsigned(PrimitiveType::Kind::Float64)]; }
 
     Type *getType(const String &N, const Scope *S);
 
     void importType(Type *T, const String &N = "");
 
+    /// Resolve every deferred type created since the last call.
     void sanitate();
+
+    /// \returns If this context has been sanitized, such that any type
+    /// deferred afterwards, i.e. by a function body that is parsed late, must
+    /// be sanitized on its own.
+    bool isSanitized() const { return m_Sanitized; }
 };
 
 } // namespace meddle
@@ -6,6 +6,7 @@
 #include "unit.h"
 #include "../core/logger.h"
 
+#include <algorithm>
 #include <iostream>
 #include <unordered_map>
 
@@ -15,34 +16,17 @@ FunctionDecl::FunctionDecl(const Runes &runes, const Metadata &md,
                            const String &name, FunctionType *ty, Scope *scope, 
                            std::vector<ParamDecl *> params, Stmt *body, 
                            std::vector<TemplateParamDecl *> tmplParams,
-                           StructDecl *parent)
-  : NamedDecl(runes, md, name), m_Type(ty), m_Scope(scope), m_Params(params),
+                           StructDecl *parent, DeclKind kind)
+  : NamedDecl(kind, runes, md, name), m_Type(ty), m_Scope(scope), m_Params(params),
     m_Body(body), m_TemplateParams(tmplParams), m_Parent(parent) {
     for (auto &param : params)
         param->setParent(this);
 }
 
-FunctionDecl::~FunctionDecl() {
-    for (auto &param : m_Params)
-        delete param;
-
-    for (auto &param : m_TemplateParams)
-        delete param;
-
-    for (auto &spec : m_TemplateSpecs)
-        delete spec;
-
-    m_Params.clear();
-    m_TemplateParams.clear();
-    m_TemplateSpecs.clear();
-    delete m_Scope;
-    if (m_Body)
-        delete m_Body;
-}
-
 ParamDecl *FunctionDecl::getParam(const String &name) const {
+    Ident id = Ident::find(name);
     for (auto &param : m_Params)
-        if (param->getName() == name)
+        if (param->getIdent() == id)
             return param;
 
     return nullptr;
@@ -54,15 +38,27 @@ Type *FunctionDecl::getParamType(unsigned i) const {
 }
 
 TemplateParamDecl *FunctionDecl::getTemplateParam(const String &name) const {
+    Ident id = Ident::find(name);
     for (auto &param : m_TemplateParams)
-        if (param->getName() == name)
+        if (param->getIdent() == id)
             return param;
 
     return nullptr;
 }
 
+/// \returns The name \p name of a template, specialized with the qualified
+/// names of \p args.
+static String getQualifiedSpecName(const String &name, 
+                                   const std::vector<Type *> &args) {
+    String N = name + "<";
+    for (unsigned i = 0; i != args.size(); ++i)
+        N += (i ? ", " : "") + args[i]->getQualifiedName();
+
+    return N + ">";
+}
+
 String FunctionDecl::getConcreteName(const std::vector<Type *> &args) const {
-    String name = m_Name + "<";
+    String name = getName() + "<";
     for (auto &ty : args)
         name += ty->getName() + (ty == args.back() ? "" : ", ");
     
@@ -71,15 +67,23 @@ String FunctionDecl::getConcreteName(const std::vector<Type *> &args) const {
 
 FunctionTemplateSpecializationDecl*
 FunctionDecl::findSpecialization(const std::vector<Type *> &args) const {
-    for (auto &spec : m_TemplateSpecs)
-        if (spec->compareArgs(args))
-            return spec;
-
-    return nullptr;
+    return m_SpecTable.find(args);
 }
 
 FunctionTemplateSpecializationDecl*
 FunctionDecl::fetchSpecialization(const std::vector<Type *> &args) {
+    // Most references are to a specialization that already exists, which
+    // the table finds without taking the lock of the unit.
+    if (auto *spec = findSpecialization(args))
+        return spec;
+
+    // Specializing may recurse into other templates of this unit, or of units
+    // it uses. Those are always further down the use graph, so the locks are
+    // taken in a consistent order.
+    std::lock_guard<std::recursive_mutex> lock(
+        m_PUnit->getSpecializationLock());
+
+    // Another thread may have created it while this one waited on the lock.
     if (auto *spec = findSpecialization(args))
         return spec;
 
@@ -91,16 +95,16 @@ FunctionDecl::createSpecialization(const std::vector<Type *> &args) {
     // Create a mapping between the parameterized types and the concrete type
     // arguments for the new specialization. This is for substituting types.
     SubstEnv *env = new SubstEnv(getMapping(m_TemplateParams, args));
+    Context *ctx = m_PUnit->getContext();
 
     // Specialize the function type with the concrete arguments.
-    Type *concreteRetTy = env->substType(m_PUnit->getContext(), 
-        m_Type->getReturnType());
+    Type *concreteRetTy = env->substType(ctx, m_Type->getReturnType());
     std::vector<Type *> concreteParamTys;
     concreteParamTys.reserve(m_Type->getNumParams());
     for (auto &param : m_Type->getParams())
-        concreteParamTys.push_back(env->substType(m_PUnit->getContext(), param));
+        concreteParamTys.push_back(env->substType(ctx, param));
 
-    FunctionType *concreteFT = FunctionType::create(m_PUnit->getContext(), 
+    FunctionType *concreteFT = FunctionType::get(ctx, 
         concreteParamTys, concreteRetTy);
 
     // Specialize the function parameters with the concrete arguments.
@@ -108,17 +112,17 @@ FunctionDecl::createSpecialization(const std::vector<Type *> &args) {
     concreteParams.reserve(getNumParams());
     for (unsigned i = 0; i != getNumParams(); ++i) {
         ParamDecl *param = m_Params.at(i);
-        concreteParams.push_back(new ParamDecl(param->getRunes(),
+        concreteParams.push_back(ctx->create<ParamDecl>(param->getRunes(),
             param->getMetadata(), param->getName(), concreteParamTys.at(i), i));
     }
 
     // Create a new scope for the empty, specialized function.
-    auto scope = new Scope();
+    auto scope = ctx->create<Scope>();
     for (auto &param : concreteParams)
         scope->addDecl(param);
 
     // Create the empty, specialized function.
-    auto specialization = new FunctionTemplateSpecializationDecl(
+    auto specialization = ctx->create<FunctionTemplateSpecializationDecl>(
         this,
         getConcreteName(args),
         concreteFT,
@@ -132,24 +136,33 @@ FunctionDecl::createSpecialization(const std::vector<Type *> &args) {
 
     delete env;
     m_TemplateSpecs.push_back(specialization);
+    m_SpecTable.insert(specialization);
     return specialization;
 }
 
+void FunctionDecl::sortSpecializations() {
+    std::stable_sort(m_TemplateSpecs.begin(), m_TemplateSpecs.end(),
+        [](auto *A, auto *B) {
+            return A->getQualifiedName() < B->getQualifiedName();
+        });
+}
+
 VarDecl::VarDecl(const Runes &R, const Metadata &M, const String &N, 
-                 Type *T, Expr *I, bool mut, bool global)
-  : NamedDecl(R, M, N), m_Type(T), m_Init(I), m_Mut(mut), m_Global(global) {}
+                 Type *T, Expr *I, bool mut, bool global, DeclKind K)
+  : NamedDecl(K, R, M, N), m_Type(T), m_Init(I), m_Mut(mut), m_Global(global) {}
 
 ParamDecl::ParamDecl(const Runes &R, const Metadata &M, const String &N,
                      Type *T, unsigned I)
-  : VarDecl(R, M, N, T, nullptr, true, false), m_Index(I), 
+  : VarDecl(R, M, N, T, nullptr, true, false, DeclKind::Param), m_Index(I), 
     m_Parent(nullptr) {}
 
 StructDecl::StructDecl(const Runes &runes, const Metadata &md, 
                        const String &name, Type *ty, Scope *scope, 
                        std::vector<FieldDecl *> fields, 
                        std::vector<FunctionDecl *> funcs, 
-                       std::vector<TemplateParamDecl *> tmplParams)
-  : TypeDecl(runes, md, name, ty), m_Scope(scope), m_Fields(fields),
+                       std::vector<TemplateParamDecl *> tmplParams,
+                       DeclKind kind)
+  : TypeDecl(kind, runes, md, name, ty), m_Scope(scope), m_Fields(fields),
     m_Functions(funcs), m_TemplateParams(tmplParams) {
     for (auto &field : m_Fields)
         field->setParent(this);
@@ -157,52 +170,35 @@ StructDecl::StructDecl(const Runes &runes, const Metadata &md,
         fn->setParent(this);
 }
 
-StructDecl::~StructDecl() {
-    for (auto &field : m_Fields)
-        delete field;
-
-    for (auto &fn : m_Functions)
-        delete fn;
-
-    for (auto &param : m_TemplateParams)
-        delete param;
-
-    for (auto &spec : m_TemplateSpecs)
-        delete spec;
-
-    m_Fields.clear();
-    m_Functions.clear();
-    m_TemplateParams.clear();
-    m_TemplateSpecs.clear();
-    delete m_Scope;
-}
-
 FieldDecl *StructDecl::getField(const String &name) const {
+    Ident id = Ident::find(name);
     for (auto &field : m_Fields)
-        if (field->getName() == name)
+        if (field->getIdent() == id)
             return field;
 
     return nullptr;
 }
 
 FunctionDecl *StructDecl::getFunction(const String &name) const {
+    Ident id = Ident::find(name);
     for (auto &fn : m_Functions)
-        if (fn->getName() == name)
+        if (fn->getIdent() == id)
             return fn;
 
     return nullptr;
 }
 
 TemplateParamDecl *StructDecl::getTemplateParam(const String &name) const {
+    Ident id = Ident::find(name);
     for (auto &param : m_TemplateParams)
-        if (param->getName() == name)
+        if (param->getIdent() == id)
             return param;
 
     return nullptr;
 }
 
 String StructDecl::getConcreteName(const std::vector<Type *> &args) const {
-    String name = m_Name + "<";
+    String name = getName() + "<";
     for (auto &ty : args)
         name += ty->getName() + (ty == args.back() ? "" : ", ");
 
@@ -211,11 +207,7 @@ String StructDecl::getConcreteName(const std::vector<Type *> &args) const {
 
 StructTemplateSpecializationDecl*
 StructDecl::findSpecialization(const std::vector<Type *> &args) const {
-    for (auto &spec : m_TemplateSpecs)
-        if (spec->compareArgs(args))
-            return spec;
-
-    return nullptr;
+    return m_SpecTable.find(args);
 }
 
 StructTemplateSpecializationDecl*
@@ -223,6 +215,13 @@ StructDecl::fetchSpecialization(const std::vector<Type *> &args) {
     if (auto *spec = findSpecialization(args))
         return spec;
 
+    // See FunctionDecl::fetchSpecialization for the lock order.
+    std::lock_guard<std::recursive_mutex> lock(
+        m_PUnit->getSpecializationLock());
+
+    if (auto *spec = findSpecialization(args))
+        return spec;
+
     return createSpecialization(args);
 }
 
@@ -231,23 +230,24 @@ StructDecl::createSpecialization(const std::vector<Type *> &args) {
     // Create a mapping between the parameterized types and the concrete type
     // arguments for the new specialization. This is for substituting types.
     SubstEnv *env = new SubstEnv(getMapping(m_TemplateParams, args));
+    Context *ctx = m_PUnit->getContext();
     
     // Specialize the struct type with the concrete arguments.
     StructType *tmplTy = m_Type->asStruct();
     std::vector<Type *> concreteFieldTys;
     concreteFieldTys.reserve(tmplTy->getNumFields());
     for (auto &field : tmplTy->getFields())
-        concreteFieldTys.push_back(env->substType(m_PUnit->getContext(), field));
+        concreteFieldTys.push_back(env->substType(ctx, field));
 
     // Create a new scope for the specialized structure.
-    auto structScope = new Scope();
+    auto structScope = ctx->create<Scope>();
 
     // Specialize the structure fields with the concrete arguments.
     std::vector<FieldDecl *> concreteFields;
     concreteFields.reserve(concreteFieldTys.size());
     for (unsigned i = 0; i != concreteFieldTys.size(); ++i) {
         FieldDecl *tmplField = m_Fields.at(i);
-        FieldDecl *concField = new FieldDecl(
+        FieldDecl *concField = ctx->create<FieldDecl>(
             tmplField->getRunes(),
             tmplField->getMetadata(),
             tmplField->getName(),
@@ -263,24 +263,24 @@ StructDecl::createSpecialization(const std::vector<Type *> &args) {
     for (auto &fn : m_Functions) {
         FunctionType *tmplFnTy = fn->getType();
 
-        Type *concreteRetTy = env->substType(m_PUnit->getContext(), 
+        Type *concreteRetTy = env->substType(ctx, 
             tmplFnTy->getReturnType());
         std::vector<Type *> concreteParamTys;
         concreteParamTys.reserve(tmplFnTy->getNumParams());
         for (auto &param : tmplFnTy->getParams())
-            concreteParamTys.push_back(env->substType(m_PUnit->getContext(), 
+            concreteParamTys.push_back(env->substType(ctx, 
                 param));
 
-        FunctionType *concreteFT = FunctionType::create(m_PUnit->getContext(), 
+        FunctionType *concreteFT = FunctionType::get(ctx, 
             concreteParamTys, concreteRetTy);
 
-        auto fnScope = new Scope(structScope);
+        auto fnScope = ctx->create<Scope>(structScope);
 
         std::vector<ParamDecl *> concreteParams;
         concreteParams.reserve(fn->getNumParams());
         for (unsigned i = 0; i != fn->getNumParams(); ++i) {
             ParamDecl *tmplParam = fn->getParam(i);
-            ParamDecl *concParam = new ParamDecl(
+            ParamDecl *concParam = ctx->create<ParamDecl>(
                 tmplParam->getRunes(),
                 tmplParam->getMetadata(),
                 tmplParam->getName(),
@@ -291,7 +291,7 @@ StructDecl::createSpecialization(const std::vector<Type *> &args) {
             fnScope->addDecl(concParam);
         }
 
-        FunctionDecl *concFunction = new FunctionDecl(
+        FunctionDecl *concFunction = ctx->create<FunctionDecl>(
             fn->getRunes(),
             fn->getMetadata(),
             fn->getName(),
@@ -315,9 +315,9 @@ StructDecl::createSpecialization(const std::vector<Type *> &args) {
     String name = getConcreteName(args);
 
     TemplateStructType *concTy = TemplateStructType::create(
-        m_PUnit->getContext(), name, concreteFieldTys, args);
+        ctx, name, concreteFieldTys, args);
 
-    auto specialization = new StructTemplateSpecializationDecl(
+    auto specialization = ctx->create<StructTemplateSpecializationDecl>(
         this,
         getConcreteName(args),
         concTy,
@@ -332,9 +332,65 @@ StructDecl::createSpecialization(const std::vector<Type *> &args) {
     concTy->setDecl(specialization);
     delete env;
     m_TemplateSpecs.push_back(specialization);
+    m_SpecTable.insert(specialization);
     return specialization;
 }
 
+void StructDecl::sortSpecializations() {
+    std::stable_sort(m_TemplateSpecs.begin(), m_TemplateSpecs.end(),
+        [](auto *A, auto *B) {
+            return A->getQualifiedName() < B->getQualifiedName();
+        });
+}
+
+TemplateParamDecl::TemplateParamDecl(Context *C, const Runes &R, 
+                                     const Metadata &M, const String &N, 
+                                     unsigned I)
+  : TypeDecl(DeclKind::TemplateParam, R, M, N, 
+             C->create<TemplateParamType>(N, this)), m_Index(I) {}
+
+/// \returns A hash of \p T that agrees with Type::compare.
+static size_t hashType(Type *T) {
+    while (auto *defer = dyn_cast<DeferredType>(T)) {
+        assert(defer->getUnderlying() && "Cannot hash unqualified deferred type.");
+        T = defer->getUnderlying();
+    }
+
+    size_t kind = static_cast<size_t>(T->getTypeKind());
+    switch (T->getTypeKind()) {
+    case TypeKind::Array: {
+        auto *AT = cast<ArrayType>(T);
+        return (hashType(AT->getElement()) * 31 + AT->getSize()) * 31 + kind;
+    }
+    case TypeKind::Pointer:
+        return hashType(cast<PointerType>(T)->getPointee()) * 31 + kind;
+    case TypeKind::Function: {
+        auto *FT = cast<FunctionType>(T);
+        size_t H = hashType(FT->getReturnType());
+        for (auto &P : FT->getParams())
+            H = H * 31 + hashType(P);
+
+        return H * 31 + kind;
+    }
+    case TypeKind::Enum:
+    case TypeKind::Struct:
+    case TypeKind::TemplateStruct:
+    case TypeKind::DependentTemplateStruct:
+        return std::hash<Type *>()(T);
+    default:
+        // Primitives and template parameters compare by kind alone.
+        return kind;
+    }
+}
+
+size_t meddle::hashTypeArgs(const std::vector<Type *> &args) {
+    size_t H = args.size();
+    for (auto &arg : args)
+        H = H * 31 + hashType(arg);
+
+    return H;
+}
+
 static bool compareArgs(const std::vector<Type *> &args1, 
                         const std::vector<Type *> &args2) {
     if (args1.size() != args2.size())
@@ -347,6 +403,14 @@ static bool compareArgs(const std::vector<Type *> &args1,
     return true;
 }
 
+String FunctionTemplateSpecializationDecl::getQualifiedName() const {
+    return getQualifiedSpecName(m_Tmpl->getName(), m_Args);
+}
+
+String StructTemplateSpecializationDecl::getQualifiedName() const {
+    return getQualifiedSpecName(m_Tmpl->getName(), m_Args);
+}
+
 bool 
 FunctionTemplateSpecializationDecl::compareArgs(const std::vector<Type *> &args) const {
     return ::compareArgs(m_Args, args);
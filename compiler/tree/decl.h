@@ -2,16 +2,23 @@
 #define MEDDLE_DECL_H
 
 #include "expr.h"
+#include "spectable.h"
 #include "type.h"
 #include "visitor.h"
+#include "../core/casting.h"
 
+#include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <unordered_map>
 
 namespace meddle {
 
+class Context;
 class Scope;
 class Stmt;
 class ParamDecl;
@@ -41,19 +48,39 @@ struct Runes final {
     void clear() { bits = 0; }
 };
 
+/// The kind of a declaration. Kinds are ordered so that the subclasses of
+/// every declaration class form a contiguous range.
+enum class DeclKind : uint8_t {
+    Function,
+    FunctionTemplateSpecialization,
+    Var,
+    Param,
+    Use,
+    EnumVariant,
+    Field,
+    Enum,
+    Struct,
+    StructTemplateSpecialization,
+    TemplateParam,
+};
+
 class Decl {
 protected:
+    DeclKind m_DeclKind;
     Runes m_Runes;
     Metadata m_Metadata;
     TranslationUnit *m_PUnit = nullptr;
 
 public:
-    Decl(const Runes &R, const Metadata &M) : m_Runes(R), m_Metadata(M) {}
+    Decl(DeclKind K, const Runes &R, const Metadata &M) 
+      : m_DeclKind(K), m_Runes(R), m_Metadata(M) {}
 
     virtual ~Decl() = default;
 
     virtual void accept(Visitor *V) = 0;
 
+    DeclKind getDeclKind() const { return m_DeclKind; }
+
     const Runes &getRunes() const { return m_Runes; }
 
     const Metadata &getMetadata() const { return m_Metadata; }
@@ -69,13 +96,17 @@ public:
 
 class NamedDecl : public Decl {
 protected:
-    String m_Name;
+    Ident m_Name;
 
 public:
-    NamedDecl(const Runes &R, const Metadata &M, const String &N) 
-      : Decl(R, M), m_Name(N) {}
+    NamedDecl(DeclKind K, const Runes &R, const Metadata &M, const String &N) 
+      : Decl(K, R, M), m_Name(Ident::get(N)) {}
+
+    static bool classof(const Decl *) { return true; }
+
+    const String &getName() const { return m_Name.str(); }
 
-    String getName() const { return m_Name; }
+    Ident getIdent() const { return m_Name; }
 };
 
 class FunctionDecl : public NamedDecl {
@@ -85,21 +116,40 @@ class FunctionDecl : public NamedDecl {
 
     std::vector<TemplateParamDecl *> m_TemplateParams;
     std::vector<FunctionTemplateSpecializationDecl *> m_TemplateSpecs;
+    SpecializationTable<FunctionTemplateSpecializationDecl> m_SpecTable;
 
 protected:
     FunctionType *m_Type;
     Scope *m_Scope;
     std::vector<ParamDecl *> m_Params;
-    Stmt *m_Body;
+    mutable Stmt *m_Body;
     StructDecl *m_Parent;
+
+    /// A body that was skipped over, to be parsed once it is first needed.
+    struct DeferredBody final {
+        std::function<Stmt *()> parse;
+        std::once_flag parsed;
+
+        /// Set once the body has been parsed, so that it can be checked for
+        /// without racing with the thread that parses it.
+        std::atomic<bool> ready = false;
+    };
+
+    /// The body of this function if it was skipped over, which only the
+    /// functions that have one pay for.
+    std::unique_ptr<DeferredBody> m_Deferred;
     
 public:
     FunctionDecl(const Runes &runes, const Metadata &md, const String &name, 
                  FunctionType *ty, Scope *scope, std::vector<ParamDecl *> params, 
                  Stmt *body, std::vector<TemplateParamDecl *> tmplParams = {},
-                 StructDecl *parent = nullptr);
+                 StructDecl *parent = nullptr, 
+                 DeclKind kind = DeclKind::Function);
 
-    ~FunctionDecl() override;
+    static bool classof(const Decl *D) {
+        return D->getDeclKind() == DeclKind::Function || 
+               D->getDeclKind() == DeclKind::FunctionTemplateSpecialization;
+    }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -124,11 +174,34 @@ public:
 
     Type *getParamType(unsigned i) const;
 
-    Stmt *getBody() const { return m_Body; }
+    /// \returns The body of this function, parsing it first if it was
+    /// skipped over. This is safe to call from several threads at once.
+    Stmt *getBody() const {
+        if (m_Deferred)
+            std::call_once(m_Deferred->parsed, [this] { 
+                m_Body = m_Deferred->parse(); 
+                m_Deferred->ready.store(true, std::memory_order_release);
+            });
+
+        return m_Body;
+    }
 
     void setBody(Stmt *body) { m_Body = body; }
 
-    bool empty() const { return m_Body == nullptr; }
+    /// Set \p parser to parse the body of this function once it is needed.
+    void setBodyParser(std::function<Stmt *()> parser) {
+        m_Deferred = std::make_unique<DeferredBody>();
+        m_Deferred->parse = std::move(parser);
+    }
+
+    /// \returns If the body of this function has yet to be parsed. This is
+    /// safe to call while another thread parses the body.
+    bool isBodyDeferred() const {
+        return m_Deferred && 
+            !m_Deferred->ready.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return !m_Deferred && m_Body == nullptr; }
 
     StructDecl *getParent() const { return m_Parent; }
 
@@ -167,6 +240,10 @@ public:
     FunctionTemplateSpecializationDecl*
     createSpecialization(const std::vector<Type *> &args);
 
+    /// Put the specializations of this template in order of their qualified
+    /// names, as the units that use it may have created them in any order.
+    void sortSpecializations();
+
     void print(std::ostream &OS) const override;
 };
 
@@ -183,11 +260,12 @@ protected:
 
 public:
     VarDecl(const Runes &R, const Metadata &M, const String &N, 
-            Type *T, Expr *I, bool mut, bool global);
+            Type *T, Expr *I, bool mut, bool global, 
+            DeclKind K = DeclKind::Var);
 
-    ~VarDecl() override {
-        if (hasInit())
-            delete m_Init;
+    static bool classof(const Decl *D) {
+        return D->getDeclKind() == DeclKind::Var || 
+               D->getDeclKind() == DeclKind::Param;
     }
 
     void accept(Visitor *V) override { V->visit(this); }
@@ -217,6 +295,9 @@ public:
     ParamDecl(const Runes &A, const Metadata &M, const String &N,
               Type *T, unsigned I = 0);
 
+    static bool classof(const Decl *D) 
+    { return D->getDeclKind() == DeclKind::Param; }
+
     void accept(Visitor *V) override { V->visit(this); }
 
     unsigned getIndex() const { return m_Index; }
@@ -244,16 +325,20 @@ class UseDecl final : public NamedDecl {
 
 public:
     UseDecl(const Runes &R, const Metadata &M, const String &P)
-      : NamedDecl(R, M, ""), m_Path(P), m_Unit(nullptr) {}
+      : NamedDecl(DeclKind::Use, R, M, ""), m_Path(P), m_Unit(nullptr) {}
 
     UseDecl(const Runes &R, const Metadata &M, const String &P, const String &N)
-      : NamedDecl(R, M, N), m_Path(P), m_Unit(nullptr) {}
+      : NamedDecl(DeclKind::Use, R, M, N), m_Path(P), m_Unit(nullptr) {}
 
     UseDecl(const Runes &R, const Metadata &M, const String &P, 
             std::vector<String> S)
-      : NamedDecl(R, M, ""), m_Path(P), m_Symbols(S), m_Unit(nullptr) {}
+      : NamedDecl(DeclKind::Use, R, M, ""), m_Path(P), m_Symbols(S), 
+        m_Unit(nullptr) {}
 
     ~UseDecl() override = default;
+
+    static bool classof(const Decl *D) 
+    { return D->getDeclKind() == DeclKind::Use; }
     
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -275,11 +360,15 @@ protected:
     Type *m_Type;
 
 public:
-    TypeDecl(const Runes &R, const Metadata &M, const String &N, Type *T)
-      : NamedDecl(R, M, N), m_Type(T) {}
+    TypeDecl(DeclKind K, const Runes &R, const Metadata &M, const String &N, 
+             Type *T)
+      : NamedDecl(K, R, M, N), m_Type(T) {}
 
     virtual ~TypeDecl() = default;
 
+    static bool classof(const Decl *D) 
+    { return D->getDeclKind() >= DeclKind::Enum; }
+
     Type *getDefinedType() const { return m_Type; }
 
     void setDefinedType(Type *T) { m_Type = T; }
@@ -296,7 +385,10 @@ class EnumVariantDecl final : public NamedDecl {
 public:
     EnumVariantDecl(const Runes &R, const Metadata &M, const String &N, 
                     Type *T, long V)
-      : NamedDecl(R, M, N), m_Type(T), m_Value(V) {}
+      : NamedDecl(DeclKind::EnumVariant, R, M, N), m_Type(T), m_Value(V) {}
+
+    static bool classof(const Decl *D) 
+    { return D->getDeclKind() == DeclKind::EnumVariant; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -317,13 +409,10 @@ class EnumDecl final : public TypeDecl {
 public:
     EnumDecl(const Runes &R, const Metadata &M, const String &N, 
              EnumType *T, std::vector<EnumVariantDecl *> V)
-      : TypeDecl(R, M, N, T), m_Variants(V) {}
+      : TypeDecl(DeclKind::Enum, R, M, N, T), m_Variants(V) {}
 
-    ~EnumDecl() override {
-        for (auto *V : m_Variants)
-            delete V;
-        m_Variants.clear();
-    }
+    static bool classof(const Decl *D) 
+    { return D->getDeclKind() == DeclKind::Enum; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -338,8 +427,9 @@ public:
     }
 
     EnumVariantDecl *getVariant(const String &N) const {
+        Ident id = Ident::find(N);
         for (auto *V : m_Variants)
-            if (V->getName() == N)
+            if (V->getIdent() == id)
                 return V;
 
         return nullptr;
@@ -361,12 +451,11 @@ class FieldDecl final : public NamedDecl {
 public:
     FieldDecl(const Runes &R, const Metadata &M, const String &N, Type *T, 
               unsigned Idx, Expr *I = nullptr, StructDecl *P = nullptr)
-      : NamedDecl(R, M, N), m_Type(T), m_Init(I), m_Index(Idx), m_Parent(P) {}
+      : NamedDecl(DeclKind::Field, R, M, N), m_Type(T), m_Init(I), 
+        m_Index(Idx), m_Parent(P) {}
 
-    ~FieldDecl() override {
-        if (m_Init)
-            delete m_Init;
-    }
+    static bool classof(const Decl *D) 
+    { return D->getDeclKind() == DeclKind::Field; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -392,6 +481,7 @@ class StructDecl : public TypeDecl {
 
     std::vector<TemplateParamDecl *> m_TemplateParams;
     std::vector<StructTemplateSpecializationDecl *> m_TemplateSpecs;
+    SpecializationTable<StructTemplateSpecializationDecl> m_SpecTable;
 
 protected:
     Scope *m_Scope;
@@ -402,9 +492,13 @@ public:
     StructDecl(const Runes &runes, const Metadata &md, const String &name, 
                Type *ty, Scope *scope, std::vector<FieldDecl *> fields, 
                std::vector<FunctionDecl *> funcs, 
-               std::vector<TemplateParamDecl *> tmplParams = {});
+               std::vector<TemplateParamDecl *> tmplParams = {},
+               DeclKind kind = DeclKind::Struct);
 
-    ~StructDecl() override;
+    static bool classof(const Decl *D) {
+        return D->getDeclKind() == DeclKind::Struct || 
+               D->getDeclKind() == DeclKind::StructTemplateSpecialization;
+    }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -461,6 +555,10 @@ public:
     StructTemplateSpecializationDecl*
     createSpecialization(const std::vector<Type *> &args);
 
+    /// Put the specializations of this template in order of their qualified
+    /// names, as the units that use it may have created them in any order.
+    void sortSpecializations();
+
     void print(std::ostream &OS) const override;
 };
 
@@ -472,13 +570,12 @@ class TemplateParamDecl final : public TypeDecl {
     unsigned m_Index;
 
 public:
-    TemplateParamDecl(const Runes &R, const Metadata &M, const String &N, 
-                      unsigned I)
-      : TypeDecl(R, M, N, new TemplateParamType(N, this)), m_Index(I) {}
+    /// Create a template parameter, whose type is created in \p C.
+    TemplateParamDecl(Context *C, const Runes &R, const Metadata &M, 
+                      const String &N, unsigned I);
 
-    ~TemplateParamDecl() override {
-        delete m_Type;
-    }
+    static bool classof(const Decl *D) 
+    { return D->getDeclKind() == DeclKind::TemplateParam; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -496,13 +593,18 @@ class FunctionTemplateSpecializationDecl final : public FunctionDecl {
     std::vector<Type *> m_Args;
     std::unordered_map<TemplateParamType *, Type *> m_Mapping;
 
+    /// If this specialization is referred to from a unit other than the one
+    /// of its template. Units are resolved concurrently, so this is atomic.
+    std::atomic<bool> m_External = false;
+
 public:
     FunctionTemplateSpecializationDecl(FunctionDecl *Tmpl, const String &N,
                                        FunctionType *T, Scope *S, 
                                        std::vector<ParamDecl *> P, 
                                        Stmt *B, std::vector<Type *> A,
                                        std::unordered_map<TemplateParamType *, Type *> M)
-      : FunctionDecl(Tmpl->getRunes(), Tmpl->getMetadata(), N, T, S, P, B), 
+      : FunctionDecl(Tmpl->getRunes(), Tmpl->getMetadata(), N, T, S, P, B, {},
+                     nullptr, DeclKind::FunctionTemplateSpecialization), 
         m_Tmpl(Tmpl), m_Args(A), m_Mapping(M) {}
 
     ~FunctionTemplateSpecializationDecl() override {
@@ -510,12 +612,26 @@ public:
         m_Mapping.clear();
     }
 
+    static bool classof(const Decl *D) {
+        return D->getDeclKind() == 
+            DeclKind::FunctionTemplateSpecialization;
+    }
+
     void accept(Visitor *V) override { V->visit(this); }
 
     FunctionDecl *getTemplateFunction() const { return m_Tmpl; }
 
+    bool isExternal() const 
+    { return m_External.load(std::memory_order_relaxed); }
+
+    void setExternal() { m_External.store(true, std::memory_order_relaxed); }
+
     const std::vector<Type *> &getArgs() const { return m_Args; }
 
+    /// \returns The name of this specialization, with its arguments spelled
+    /// by their qualified names.
+    String getQualifiedName() const;
+
     bool compareArgs(const std::vector<Type *> &args) const;
 
     void print(std::ostream &OS) const override;
@@ -537,15 +653,24 @@ public:
                                      std::vector<FunctionDecl *> funcs, 
                                      std::vector<Type *> args,
                                      std::unordered_map<TemplateParamType *, Type *> map)
-      : StructDecl(tmpl->getRunes(), tmpl->getMetadata(), name, ty, scope, fields, funcs), 
+      : StructDecl(tmpl->getRunes(), tmpl->getMetadata(), name, ty, scope, fields, funcs, 
+                   {}, DeclKind::StructTemplateSpecialization), 
         m_Tmpl(tmpl), m_Args(args), m_Mapping(map) {}
 
+    static bool classof(const Decl *D) {
+        return D->getDeclKind() == DeclKind::StructTemplateSpecialization;
+    }
+
     void accept(Visitor *V) override { V->visit(this); }
 
     StructDecl *getTemplateStruct() const { return m_Tmpl; }
 
     const std::vector<Type *> &getArgs() const { return m_Args; }
 
+    /// \returns The name of this specialization, with its arguments spelled
+    /// by their qualified names.
+    String getQualifiedName() const;
+
     bool compareArgs(const std::vector<Type *> &args) const;
 
     void print(std::ostream &OS) const override;
@@ -8,7 +8,7 @@ FunctionDecl *CallExpr::getCallee() const {
 }
 
 UnitSpecExpr::UnitSpecExpr(const Metadata &M, UseDecl *U, RefExpr *E)
-  : Expr(M, nullptr), m_Use(U), m_Expr(E), m_Unit(nullptr) {
+  : Expr(ExprKind::UnitSpec, M, nullptr), m_Use(U), m_Expr(E), m_Unit(nullptr) {
     assert(U->isNamed() && "Cannot make specifier for unnamed use");
 }
 
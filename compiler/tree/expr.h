@@ -3,6 +3,8 @@
 
 #include "type.h"
 #include "visitor.h"
+#include "../core/casting.h"
+#include "../core/ident.h"
 
 #include <cassert>
 #include <ostream>
@@ -14,19 +16,49 @@ class UseDecl;
 class TypeDecl;
 class RefExpr;
 
+/// The kind of an expression. Kinds are ordered so that the subclasses of
+/// every expression class form a contiguous range.
+enum class ExprKind : uint8_t {
+    BoolLiteral,
+    IntegerLiteral,
+    FloatLiteral,
+    CharLiteral,
+    StringLiteral,
+    NilLiteral,
+    Array,
+    Binary,
+    Cast,
+    Paren,
+    Ref,
+    Access,
+    Call,
+    MethodCall,
+    FieldInit,
+    TypeSpec,
+    Init,
+    Sizeof,
+    Subscript,
+    UnitSpec,
+    Unary,
+    RuneSyscall,
+};
+
 class Expr {
 protected:
+    ExprKind m_ExprKind;
     Metadata m_Metadata;
     Type *m_Type;
     bool m_IsLValue;
 
 public:
-    Expr(const Metadata &M, Type *T, bool LVal = false) 
-      : m_Metadata(M), m_Type(T), m_IsLValue(LVal) {}
+    Expr(ExprKind K, const Metadata &M, Type *T, bool LVal = false) 
+      : m_ExprKind(K), m_Metadata(M), m_Type(T), m_IsLValue(LVal) {}
     virtual ~Expr() = default;
 
     virtual void accept(Visitor *V) = 0;
 
+    ExprKind getExprKind() const { return m_ExprKind; }
+
     const Metadata &getMetadata() const { return m_Metadata; }
 
     Type *getType() const {
@@ -60,7 +92,11 @@ class BoolLiteral final : public Expr {
 	bool m_Value;
 
 public:
-	BoolLiteral(const Metadata &M, Type *T, bool V) : Expr(M, T), m_Value(V) {}
+	BoolLiteral(const Metadata &M, Type *T, bool V) 
+	  : Expr(ExprKind::BoolLiteral, M, T), m_Value(V) {}
+
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::BoolLiteral; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -80,7 +116,10 @@ class IntegerLiteral final : public Expr {
 
 public:
     IntegerLiteral(const Metadata &M, Type *T, long V) 
-      : Expr(M, T), m_Value(V) {}
+      : Expr(ExprKind::IntegerLiteral, M, T), m_Value(V) {}
+
+    static bool classof(const Expr *E) 
+    { return E->getExprKind() == ExprKind::IntegerLiteral; }
 	
     void accept(Visitor *V) override { V->visit(this); }
 	
@@ -100,7 +139,10 @@ class FloatLiteral final : public Expr {
 
 public:
 	FloatLiteral(const Metadata &M, Type *T, double V) 
-	  : Expr(M, T), m_Value(V) {}
+	  : Expr(ExprKind::FloatLiteral, M, T), m_Value(V) {}
+
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::FloatLiteral; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -120,7 +162,10 @@ class CharLiteral final : public Expr {
 
 public:
 	CharLiteral(const Metadata &M, Type *T, char V)
-	  : Expr(M, T), m_Value(V) {}
+	  : Expr(ExprKind::CharLiteral, M, T), m_Value(V) {}
+
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::CharLiteral; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -140,7 +185,10 @@ class StringLiteral final : public Expr {
 
 public:
 	StringLiteral(const Metadata &M, Type *T, String V)
-	  : Expr(M, T), m_Value(V) {}
+	  : Expr(ExprKind::StringLiteral, M, T), m_Value(V) {}
+
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::StringLiteral; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -157,7 +205,11 @@ class NilLiteral final : public Expr {
 	friend class Sema;
 
 public:
-	NilLiteral(const Metadata &M, Type *T) : Expr(M, T) {}
+	NilLiteral(const Metadata &M, Type *T) 
+	  : Expr(ExprKind::NilLiteral, M, T) {}
+
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::NilLiteral; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -175,13 +227,10 @@ class ArrayExpr final : public Expr {
 
 public:
 	ArrayExpr(const Metadata &M, Type *T, std::vector<Expr *> E = {})
-	  : Expr(M, T), m_Elements(E) {}
+	  : Expr(ExprKind::Array, M, T), m_Elements(E) {}
 
-	~ArrayExpr() override {
-		for (auto &E : m_Elements)
-			delete E;
-		m_Elements.clear();
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Array; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -254,12 +303,10 @@ private:
 
 public:
 	BinaryExpr(const Metadata &M, Type *T, Kind K, Expr *LHS, Expr *RHS)
-	  : Expr(M, T), m_Kind(K), m_LHS(LHS), m_RHS(RHS) {}
+	  : Expr(ExprKind::Binary, M, T), m_Kind(K), m_LHS(LHS), m_RHS(RHS) {}
 
-	~BinaryExpr() override {
-		delete m_LHS;
-		delete m_RHS;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Binary; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -333,11 +380,11 @@ class CastExpr final : public Expr {
 	Expr *m_Expr;
 
 public:
-	CastExpr(const Metadata &M, Type *T, Expr *E) : Expr(M, T), m_Expr(E) {}
+	CastExpr(const Metadata &M, Type *T, Expr *E) 
+	  : Expr(ExprKind::Cast, M, T), m_Expr(E) {}
 
-	~CastExpr() override {
-		delete m_Expr;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Cast; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -358,11 +405,11 @@ class ParenExpr final : public Expr {
 	Expr *m_Expr;
 
 public:
-	ParenExpr(const Metadata &M, Expr *E) : Expr(M, E->getType()), m_Expr(E) {}
+	ParenExpr(const Metadata &M, Expr *E) 
+	  : Expr(ExprKind::Paren, M, E->getType()), m_Expr(E) {}
 
-	~ParenExpr() override {
-		delete m_Expr;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Paren; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -379,16 +426,24 @@ class RefExpr : public Expr {
 	friend class Sema;
 
 protected:
-	String m_Name;
+	Ident m_Name;
 	NamedDecl *m_Ref;
 
 public:
-	RefExpr(const Metadata &M, Type *T, String N, NamedDecl *R = nullptr)
-	  : Expr(M, T, true), m_Name(N), m_Ref(R) {}
+	RefExpr(const Metadata &M, Type *T, const String &N, NamedDecl *R = nullptr,
+			ExprKind K = ExprKind::Ref)
+	  : Expr(K, M, T, true), m_Name(Ident::get(N)), m_Ref(R) {}
+
+	static bool classof(const Expr *E) {
+		return E->getExprKind() >= ExprKind::Ref && 
+			   E->getExprKind() <= ExprKind::TypeSpec;
+	}
 
 	void accept(Visitor *V) override { V->visit(this); }
 
-	String getName() const { return m_Name;}
+	const String &getName() const { return m_Name.str(); }
+
+	Ident getIdent() const { return m_Name; }
 
 	NamedDecl *getRef() const { return m_Ref; }
 
@@ -404,11 +459,10 @@ class AccessExpr final : public RefExpr {
 
 public:
 	AccessExpr(const Metadata &M, Type *T, String N, Expr *B, NamedDecl *R = nullptr)
-	  : RefExpr(M, T, N, R), m_Base(B) {}
+	  : RefExpr(M, T, N, R, ExprKind::Access), m_Base(B) {}
 
-	~AccessExpr() override {
-		delete m_Base;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Access; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -429,12 +483,12 @@ protected:
 public:
 	CallExpr(const Metadata &M, Type *T, const String &N, 
 			 NamedDecl *C = nullptr, std::vector<Expr *> Args = {}, 
-			 std::vector<Type *> TArgs = {})
-	  : RefExpr(M, T, N, C), m_Args(Args), m_TypeArgs(TArgs) {}
+			 std::vector<Type *> TArgs = {}, ExprKind K = ExprKind::Call)
+	  : RefExpr(M, T, N, C, K), m_Args(Args), m_TypeArgs(TArgs) {}
 
-	~CallExpr() override {
-		for (auto &A : m_Args)
-			delete A;
+	static bool classof(const Expr *E) {
+		return E->getExprKind() == ExprKind::Call || 
+			   E->getExprKind() == ExprKind::MethodCall;
 	}
 
 	void accept(Visitor *V) override { V->visit(this); }
@@ -473,11 +527,10 @@ public:
 	MethodCallExpr(const Metadata &M, Type *T, const String &N, Expr *B, 
 				   NamedDecl *C = nullptr, std::vector<Expr *> Args = {},
 				   std::vector<Type *> TArgs = {})
-	  : CallExpr(M, T, N, C, Args, TArgs), m_Base(B) {}
+	  : CallExpr(M, T, N, C, Args, TArgs, ExprKind::MethodCall), m_Base(B) {}
 
-	~MethodCallExpr() override {
-		delete m_Base;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::MethodCall; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -495,11 +548,10 @@ class FieldInitExpr final : public RefExpr {
 
 public:
 	FieldInitExpr(const Metadata &M, Type *T, String N, Expr *E)
-	  : RefExpr(M, T, N), m_Expr(E) {}
+	  : RefExpr(M, T, N, nullptr, ExprKind::FieldInit), m_Expr(E) {}
 
-	~FieldInitExpr() override {
-		delete m_Expr;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::FieldInit; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -519,13 +571,10 @@ class InitExpr final : public Expr {
 
 public:
 	InitExpr(const Metadata &M, Type *T, std::vector<FieldInitExpr *> F)
-	  : Expr(M, T), m_Fields(F) {}
+	  : Expr(ExprKind::Init, M, T), m_Fields(F) {}
 
-	~InitExpr() override {
-		for (auto &F : m_Fields)
-			delete F;
-		m_Fields.clear();
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Init; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -553,7 +602,10 @@ class SizeofExpr final : public Expr {
 
 public:
 	SizeofExpr(const Metadata &M, Type *T, Type *Target)
-	  : Expr(M, T), m_Target(Target) {}
+	  : Expr(ExprKind::Sizeof, M, T), m_Target(Target) {}
+
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Sizeof; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -572,12 +624,10 @@ class SubscriptExpr final : public Expr {
 
 public:
 	SubscriptExpr(const Metadata &M, Type *T, Expr *B, Expr *I)
-	  : Expr(M, T, true), m_Base(B), m_Index(I) {}
+	  : Expr(ExprKind::Subscript, M, T, true), m_Base(B), m_Index(I) {}
 
-	~SubscriptExpr() override {
-		delete m_Base;
-		delete m_Index;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Subscript; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -596,18 +646,21 @@ class TypeSpecExpr final : public RefExpr {
 	friend class NameResolution;
 	friend class Sema;
 
+	TypeRef *m_TypeRef;
 	RefExpr *m_Expr;
 
 public:
-	TypeSpecExpr(const Metadata &M, String N, RefExpr *E, NamedDecl *R = nullptr)
-	  : RefExpr(M, nullptr, N, R), m_Expr(E) {}
+	TypeSpecExpr(const Metadata &M, TypeRef *T, RefExpr *E, NamedDecl *R = nullptr)
+	  : RefExpr(M, nullptr, T->getSpelling().str(), R, ExprKind::TypeSpec), 
+	    m_TypeRef(T), m_Expr(E) {}
 
-	~TypeSpecExpr() override {
-		delete m_Expr;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::TypeSpec; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
+	TypeRef *getTypeRef() const { return m_TypeRef; }
+
 	RefExpr *getExpr() const { return m_Expr; }
 
 	TypeDecl *getTypeDecl() const;
@@ -635,9 +688,8 @@ class UnitSpecExpr final : public Expr {
 public:
 	UnitSpecExpr(const Metadata &M, UseDecl *U, RefExpr *E);
 
-	~UnitSpecExpr() override {
-		delete m_Expr;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::UnitSpec; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -687,11 +739,11 @@ private:
 
 public:
 	UnaryExpr(const Metadata &M, Type *T, Kind K, Expr *E, bool POST)
-	  : Expr(M, T, K == Kind::Dereference), m_Kind(K), m_Expr(E), m_Postfix(POST) {}
+	  : Expr(ExprKind::Unary, M, T, K == Kind::Dereference), m_Kind(K), 
+	    m_Expr(E), m_Postfix(POST) {}
 
-	~UnaryExpr() override {
-		delete m_Expr;
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::Unary; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -723,13 +775,10 @@ class RuneSyscallExpr final : public Expr {
 public:
 	RuneSyscallExpr(const Metadata &M, Type *T, unsigned N, 
 				 std::vector<Expr *> Args)
-	  : Expr(M, T), m_Num(N), m_Args(Args) {}
+	  : Expr(ExprKind::RuneSyscall, M, T), m_Num(N), m_Args(Args) {}
 
-	~RuneSyscallExpr() override {
-		for (auto &E : m_Args)
-			delete E;
-		m_Args.clear();
-	}
+	static bool classof(const Expr *E) 
+	{ return E->getExprKind() == ExprKind::RuneSyscall; }
 
 	void accept(Visitor *V) override { V->visit(this); }
 
@@ -0,0 +1,824 @@
+#include "interface.h"
+#include "decl.h"
+#include "nameres.h"
+#include "scope.h"
+#include "sema.h"
+#include "stmt.h"
+#include "type.h"
+#include "typeref.h"
+#include "../core/logger.h"
+#include "../lexer/lexer.h"
+#include "../parser/parser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace meddle;
+
+/// The first bytes of every module interface.
+static constexpr char InterfaceMagic[4] = { 'M', 'D', 'L', 'I' };
+
+/// The deepest type reference an interface may hold, as in `i64****`.
+static constexpr unsigned MaxTypeDepth = 256;
+
+/// The ways a unit may use another, as written in an interface.
+enum class UseKind : uint8_t {
+    All,
+    Named,
+    Listed,
+};
+
+/// \returns A hash of the source \p S, which is the same in every build.
+static uint64_t hashSource(std::string_view S) {
+    // 64-bit FNV-1a.
+    uint64_t H = 0xcbf29ce484222325;
+    for (char C : S) {
+        H ^= static_cast<uint8_t>(C);
+        H *= 0x100000001b3;
+    }
+
+    return H;
+}
+
+String meddle::getInterfacePath(const String &path) {
+    if (path.size() >= 4 && path.substr(path.size() - 4) == ".mdl")
+        return path + "i";
+
+    return path + ".mdli";
+}
+
+/// \returns The source of the function body that begins at \p loc.
+static std::string_view getBodySource(Metadata loc) {
+    std::string_view rest = loc.getFile().contents.substr(
+        SourceManager::get().getOffset(loc));
+
+    Lexer lexer = Lexer(rest, loc);
+    unsigned depth = 0;
+    for (Token T = lexer.lex(); T.kind != TokenKind::Eof; T = lexer.lex()) {
+        if (T.kind == TokenKind::SetBrace)
+            ++depth;
+        else if (T.kind == TokenKind::EndBrace && --depth == 0)
+            return rest.substr(0, T.md.loc + 1 - loc.loc);
+    }
+
+    return rest;
+}
+
+/// \returns The source of the initializer of the declaration at \p loc, from
+/// after its '=' up to the ';', ',' or '}' that ends the declaration.
+static std::string_view getInitSource(Metadata loc) {
+    std::string_view rest = loc.getFile().contents.substr(
+        SourceManager::get().getOffset(loc));
+
+    Lexer lexer = Lexer(rest, loc);
+    Metadata begin;
+    unsigned depth = 0;
+    for (Token T = lexer.lex(); T.kind != TokenKind::Eof; T = lexer.lex()) {
+        switch (T.kind) {
+        case TokenKind::Equals:
+            if (depth == 0 && !begin.isValid()) {
+                begin = Metadata(T.md.loc + 1);
+                continue;
+            }
+
+            break;
+        case TokenKind::SetParen:
+        case TokenKind::SetBrack:
+        case TokenKind::SetBrace:
+            ++depth;
+            break;
+        case TokenKind::EndBrace:
+            if (depth == 0 && begin.isValid())
+                return rest.substr(begin.loc - loc.loc, T.md.loc - begin.loc);
+
+            [[fallthrough]];
+        case TokenKind::EndParen:
+        case TokenKind::EndBrack:
+            --depth;
+            break;
+        case TokenKind::Semi:
+        case TokenKind::Comma:
+            if (depth == 0 && begin.isValid())
+                return rest.substr(begin.loc - loc.loc, T.md.loc - begin.loc);
+
+            break;
+        default:
+            break;
+        }
+    }
+
+    return std::string_view();
+}
+
+namespace {
+
+/// Writes the module interface of a unit.
+///
+/// An interface is a header, followed by a block of source for the template
+/// bodies and initializers of the unit, its uses, and then its exports.
+/// Numbers are written in the byte order of the host, and strings are
+/// prefixed by their length.
+class InterfaceWriter final {
+    TranslationUnit *m_Unit;
+    String m_Data;
+    String m_Source;
+
+    /// Why the interface cannot be written, if it cannot.
+    String m_Error;
+
+    void writeU8(uint8_t V) { m_Data.push_back(static_cast<char>(V)); }
+
+    void writeU32(uint32_t V)
+    { m_Data.append(reinterpret_cast<const char *>(&V), sizeof(V)); }
+
+    void writeI64(int64_t V)
+    { m_Data.append(reinterpret_cast<const char *>(&V), sizeof(V)); }
+
+    void writeStr(std::string_view S) {
+        writeU32(S.size());
+        m_Data.append(S);
+    }
+
+    /// Add \p S to the source block, and write where it is.
+    void writeSource(std::string_view S) {
+        writeU32(S.empty() ? 0 : m_Source.size());
+        writeU32(S.size());
+        m_Source.append(S);
+        m_Source.push_back('\n');
+    }
+
+    /// Write the name that the type declaration \p D is known by in the unit.
+    bool writeName(TypeDecl *D);
+
+    bool writeType(Type *T);
+
+    /// Write the function \p F, with its body if \p body is set.
+    bool writeFunction(FunctionDecl *F, bool body);
+
+    bool writeStruct(StructDecl *S);
+
+    bool writeEnum(EnumDecl *E);
+
+    bool writeVar(VarDecl *V);
+
+public:
+    InterfaceWriter(TranslationUnit *U) : m_Unit(U) {}
+
+    bool write(std::ostream &OS);
+
+    const String &getError() const { return m_Error; }
+};
+
+/// Reads a module interface into a new unit.
+class InterfaceReader final {
+    const String &m_Path;
+    std::string_view m_Data;
+    size_t m_Pos = 0;
+
+    TranslationUnit *m_Unit = nullptr;
+    Context *m_Context = nullptr;
+    Scope *m_Scope = nullptr;
+
+    /// The source block of the interface and where it begins.
+    std::string_view m_Source;
+    Metadata m_Start;
+
+    [[noreturn]] void fail() const
+    { fatal("malformed module interface: " + m_Path, nullptr); }
+
+    std::string_view read(size_t n) {
+        if (m_Data.size() - m_Pos < n)
+            fail();
+
+        std::string_view S = m_Data.substr(m_Pos, n);
+        m_Pos += n;
+        return S;
+    }
+
+    uint8_t readU8() { return static_cast<uint8_t>(read(1)[0]); }
+
+    uint32_t readU32() {
+        uint32_t V;
+        std::memcpy(&V, read(sizeof(V)).data(), sizeof(V));
+        return V;
+    }
+
+    int64_t readI64() {
+        int64_t V;
+        std::memcpy(&V, read(sizeof(V)).data(), sizeof(V));
+        return V;
+    }
+
+    String readStr() { return String(read(readU32())); }
+
+    /// \returns A count of items, each of which takes at least a byte of the
+    /// rest of the interface.
+    uint32_t readCount() {
+        uint32_t n = readU32();
+        if (n > m_Data.size() - m_Pos)
+            fail();
+
+        return n;
+    }
+
+    /// Fail if the source file \p source exists, and is not the source that
+    /// the interface was written from.
+    void checkSource(const String &source);
+
+    /// Read the location of a piece of the source block into \p src and
+    /// \p md.
+    ///
+    /// \returns If there is any source.
+    bool readSource(std::string_view &src, Metadata &md);
+
+    /// Read a type reference nested \p depth references deep.
+    TypeRef *readTypeRef(unsigned depth = 0);
+
+    Type *readType(Scope *S)
+    { return Type::get(m_Context, readTypeRef(), S, m_Start); }
+
+    /// Read template parameters into the scope \p S.
+    std::vector<TemplateParamDecl *> readTemplateParams(Scope *S);
+
+    /// Read a function into the scope \p S.
+    FunctionDecl *readFunction(Scope *S);
+
+    StructDecl *readStruct();
+
+    EnumDecl *readEnum();
+
+    VarDecl *readVar();
+
+    void readUses();
+
+public:
+    InterfaceReader(const String &path, const String &source);
+
+    TranslationUnit *get() const { return m_Unit; }
+};
+
+} // namespace
+
+bool InterfaceWriter::writeName(TypeDecl *D) {
+    TranslationUnit *owner = D->getPUnit();
+    if (owner == m_Unit) {
+        if (m_Unit->getExport(D->getIdent()) != D) {
+            m_Error = "type '" + D->getName() + "' is not public";
+            return false;
+        }
+
+        writeStr(D->getName());
+        return true;
+    }
+
+    // Types of other units are named as the unit uses them, preferring the
+    // bare name where a use brings it into scope.
+    UseDecl *named = nullptr;
+    for (auto &Use : m_Unit->getUses()) {
+        if (Use->getUnit() != owner)
+            continue;
+
+        if (Use->isNamed()) {
+            named = named ? named : Use;
+            continue;
+        }
+
+        const std::vector<String> &symbols = Use->getSymbols();
+        if (symbols.empty() || std::find(symbols.begin(), symbols.end(), 
+          D->getName()) != symbols.end()) {
+            writeStr(D->getName());
+            return true;
+        }
+    }
+
+    if (named) {
+        writeStr(named->getName() + "::" + D->getName());
+        return true;
+    }
+
+    m_Error = "type '" + D->getName() + "' is not from a used unit";
+    return false;
+}
+
+bool InterfaceWriter::writeType(Type *T) {
+    while (auto *defer = dyn_cast<DeferredType>(T))
+        T = defer->getUnderlying();
+
+    switch (T->getTypeKind()) {
+    case TypeKind::Array:
+        writeU8(uint8_t(TypeRef::Kind::Array));
+        writeU32(T->asArray()->getSize());
+        return writeType(T->asArray()->getElement());
+
+    case TypeKind::Pointer:
+        writeU8(uint8_t(TypeRef::Kind::Pointer));
+        return writeType(T->asPointer()->getPointee());
+
+    case TypeKind::Function:
+        m_Error = "function type '" + T->getName() + "' cannot be named";
+        return false;
+
+    case TypeKind::Enum:
+        writeU8(uint8_t(TypeRef::Kind::Named));
+        return writeName(T->asEnum()->getDecl());
+
+    case TypeKind::Struct:
+        writeU8(uint8_t(TypeRef::Kind::Named));
+        return writeName(T->asStruct()->getDecl());
+
+    case TypeKind::TemplateStruct: {
+        auto *TST = cast<TemplateStructType>(T);
+        writeU8(uint8_t(TypeRef::Kind::Template));
+        if (!writeName(TST->getTemplateDecl()))
+            return false;
+
+        writeU32(TST->getArgs().size());
+        for (auto &arg : TST->getArgs())
+            if (!writeType(arg))
+                return false;
+
+        return true;
+    }
+
+    case TypeKind::DependentTemplateStruct: {
+        auto *DTST = cast<DependentTemplateStructType>(T);
+        writeU8(uint8_t(TypeRef::Kind::Template));
+        if (!writeName(DTST->getTemplateDecl()))
+            return false;
+
+        writeU32(DTST->getArgs().size());
+        for (auto &arg : DTST->getArgs())
+            if (!writeType(arg))
+                return false;
+
+        return true;
+    }
+
+    default:
+        // Primitive types and template parameters are named as they are.
+        writeU8(uint8_t(TypeRef::Kind::Named));
+        writeStr(T->getName());
+        return true;
+    }
+}
+
+bool InterfaceWriter::writeFunction(FunctionDecl *F, bool body) {
+    writeU32(F->getRunes().bits);
+    writeStr(F->getName());
+
+    writeU32(F->getNumTemplateParams());
+    for (auto &param : F->getTemplateParams())
+        writeStr(param->getName());
+
+    writeU32(F->getNumParams());
+    for (auto &param : F->getParams()) {
+        writeStr(param->getName());
+        if (!writeType(param->getType()))
+            return false;
+    }
+
+    if (!writeType(F->getReturnType()))
+        return false;
+
+    Stmt *S = body ? F->getBody() : nullptr;
+    writeSource(S ? getBodySource(S->getMetadata()) : std::string_view());
+    return true;
+}
+
+bool InterfaceWriter::writeStruct(StructDecl *S) {
+    writeU32(S->getRunes().bits);
+    writeStr(S->getName());
+
+    writeU32(S->getNumTemplateParams());
+    for (auto &param : S->getTemplateParams())
+        writeStr(param->getName());
+
+    writeU32(S->getNumFields());
+    for (auto &field : S->getFields()) {
+        writeU32(field->getRunes().bits);
+        writeStr(field->getName());
+        if (!writeType(field->getType()))
+            return false;
+
+        writeSource(field->hasInit() ? getInitSource(field->getMetadata())
+                                     : std::string_view());
+    }
+
+    // Methods of a template are needed to specialize it, and the rest are
+    // only declared by importers.
+    writeU32(S->getNumFunctions());
+    for (auto &fn : S->getFunctions())
+        if (!writeFunction(fn, S->isTemplate()))
+            return false;
+
+    return true;
+}
+
+bool InterfaceWriter::writeEnum(EnumDecl *E) {
+    writeU32(E->getRunes().bits);
+    writeStr(E->getName());
+    if (!writeType(E->getDefinedType()->asEnum()->getUnderlying()))
+        return false;
+
+    writeU32(E->getNumVariants());
+    for (auto &variant : E->getVariants()) {
+        writeU32(variant->getRunes().bits);
+        writeStr(variant->getName());
+        writeI64(variant->getValue());
+    }
+
+    return true;
+}
+
+bool InterfaceWriter::writeVar(VarDecl *V) {
+    writeU32(V->getRunes().bits);
+    writeStr(V->getName());
+    writeU8(V->isMutable());
+    if (!writeType(V->getType()))
+        return false;
+
+    writeSource(getInitSource(V->getMetadata()));
+    return true;
+}
+
+bool InterfaceWriter::write(std::ostream &OS) {
+    m_Source = "// module interface of " + m_Unit->getFile().filename + "\n";
+
+    unsigned count = 0;
+    for (auto &D : m_Unit->getExports()) {
+        bool written = true;
+        if (auto *F = dyn_cast<FunctionDecl>(D)) {
+            writeU8(uint8_t(DeclKind::Function));
+            written = writeFunction(F, F->isTemplate());
+        } else if (auto *S = dyn_cast<StructDecl>(D)) {
+            writeU8(uint8_t(DeclKind::Struct));
+            written = writeStruct(S);
+        } else if (auto *E = dyn_cast<EnumDecl>(D)) {
+            writeU8(uint8_t(DeclKind::Enum));
+            written = writeEnum(E);
+        } else if (auto *V = dyn_cast<VarDecl>(D)) {
+            writeU8(uint8_t(DeclKind::Var));
+            written = writeVar(V);
+        } else {
+            continue;
+        }
+
+        if (!written)
+            return false;
+
+        ++count;
+    }
+
+    String records = std::move(m_Data);
+    m_Data.clear();
+
+    OS.write(InterfaceMagic, sizeof(InterfaceMagic));
+    writeU32(InterfaceVersion);
+
+    std::string_view contents = m_Unit->getFile().contents;
+    writeU32(contents.size());
+    writeI64(hashSource(contents));
+    writeStr(m_Source);
+
+    writeU32(m_Unit->getUses().size());
+    for (auto &Use : m_Unit->getUses()) {
+        if (Use->isNamed()) {
+            writeU8(uint8_t(UseKind::Named));
+            writeStr(Use->getPath());
+            writeStr(Use->getName());
+        } else if (!Use->getSymbols().empty()) {
+            writeU8(uint8_t(UseKind::Listed));
+            writeStr(Use->getPath());
+            writeU32(Use->getSymbols().size());
+            for (auto &symbol : Use->getSymbols())
+                writeStr(symbol);
+        } else {
+            writeU8(uint8_t(UseKind::All));
+            writeStr(Use->getPath());
+        }
+    }
+
+    writeU32(count);
+    OS << m_Data << records;
+    return OS.good();
+}
+
+bool meddle::writeInterface(TranslationUnit *U, std::ostream &OS) {
+    InterfaceWriter writer = InterfaceWriter(U);
+    if (writer.write(OS))
+        return true;
+
+    if (!writer.getError().empty())
+        warn("no module interface for '" + U->getFile().path + "': " +
+             writer.getError(), nullptr);
+
+    return false;
+}
+
+bool InterfaceReader::readSource(std::string_view &src, Metadata &md) {
+    uint32_t offset = readU32();
+    uint32_t size = readU32();
+    if (size == 0)
+        return false;
+
+    if (offset > m_Source.size() || m_Source.size() - offset < size)
+        fail();
+
+    src = m_Source.substr(offset, size);
+    md = Metadata(m_Start.loc + offset);
+    return true;
+}
+
+TypeRef *InterfaceReader::readTypeRef(unsigned depth) {
+    if (depth == MaxTypeDepth)
+        fail();
+
+    switch (TypeRef::Kind(readU8())) {
+    case TypeRef::Kind::Named:
+        return TypeRef::createNamed(m_Context, Ident::get(readStr()));
+
+    case TypeRef::Kind::Pointer:
+        return TypeRef::createPointer(m_Context, readTypeRef(depth + 1));
+
+    case TypeRef::Kind::Array: {
+        unsigned size = readU32();
+        return TypeRef::createArray(m_Context, readTypeRef(depth + 1), size);
+    }
+
+    case TypeRef::Kind::Template: {
+        Ident name = Ident::get(readStr());
+        std::vector<TypeRef *> args(readCount());
+        for (auto &arg : args)
+            arg = readTypeRef(depth + 1);
+
+        return TypeRef::createTemplate(m_Context, name, args);
+    }
+    }
+
+    fail();
+}
+
+std::vector<TemplateParamDecl *> InterfaceReader::readTemplateParams(Scope *S) {
+    std::vector<TemplateParamDecl *> params(readCount());
+    for (unsigned i = 0; i != params.size(); ++i) {
+        params[i] = m_Context->create<TemplateParamDecl>(m_Context, Runes(),
+            m_Start, readStr(), i);
+        S->addDecl(params[i]);
+    }
+
+    return params;
+}
+
+FunctionDecl *InterfaceReader::readFunction(Scope *S) {
+    Runes runes;
+    runes.bits = readU32();
+    String name = readStr();
+
+    Scope *scope = m_Context->create<Scope>(S);
+    std::vector<TemplateParamDecl *> tps = readTemplateParams(scope);
+
+    std::vector<ParamDecl *> params(readCount());
+    std::vector<Type *> paramTys;
+    paramTys.reserve(params.size());
+    for (auto &param : params) {
+        String paramName = readStr();
+        Type *paramTy = readType(scope);
+        param = m_Context->create<ParamDecl>(Runes(), m_Start, paramName,
+            paramTy);
+        scope->addDecl(param);
+        paramTys.push_back(paramTy);
+    }
+
+    Type *retTy = readType(scope);
+
+    std::string_view src;
+    Metadata md = m_Start;
+    bool hasBody = readSource(src, md);
+
+    FunctionDecl *fn = m_Context->create<FunctionDecl>(
+        runes,
+        md,
+        name,
+        FunctionType::get(m_Context, paramTys, retTy),
+        scope,
+        params,
+        nullptr,
+        tps
+    );
+    S->addDecl(fn);
+
+    // Name resolution and sema leave the bodies of an interface alone, so a
+    // body is analyzed here once the first specialization of it is lowered.
+    if (hasBody) {
+        TranslationUnit *unit = m_Unit;
+        fn->setBodyParser([unit, fn, scope, src, md]() -> Stmt * {
+            std::lock_guard<std::recursive_mutex> lock(
+                unit->getSpecializationLock());
+
+            Stmt *body = Parser::parseBody(unit, scope, src, md);
+            NameResolution NR = NameResolution(Options(), unit, fn, body);
+            Sema sema = Sema(Options(), unit, fn, body);
+            return body;
+        });
+    }
+
+    return fn;
+}
+
+StructDecl *InterfaceReader::readStruct() {
+    Runes runes;
+    runes.bits = readU32();
+    String name = readStr();
+
+    Scope *scope = m_Context->create<Scope>(m_Scope);
+    std::vector<TemplateParamDecl *> tps = readTemplateParams(scope);
+
+    std::vector<FieldDecl *> fields(readCount());
+    std::vector<Type *> fieldTys;
+    fieldTys.reserve(fields.size());
+    for (unsigned i = 0; i != fields.size(); ++i) {
+        Runes fieldRunes;
+        fieldRunes.bits = readU32();
+        String fieldName = readStr();
+        Type *fieldTy = readType(scope);
+
+        std::string_view src;
+        Metadata md = m_Start;
+        Expr *init = nullptr;
+        if (readSource(src, md))
+            init = Parser::parseExpr(m_Unit, scope, src, md);
+
+        fields[i] = m_Context->create<FieldDecl>(fieldRunes, md, fieldName,
+            fieldTy, i, init);
+        scope->addDecl(fields[i]);
+        fieldTys.push_back(fieldTy);
+    }
+
+    std::vector<FunctionDecl *> funcs(readCount());
+    for (auto &fn : funcs)
+        fn = readFunction(scope);
+
+    StructType *ty = StructType::create(m_Context, name, fieldTys);
+    StructDecl *decl = m_Context->create<StructDecl>(
+        runes,
+        m_Start,
+        name,
+        ty,
+        scope,
+        fields,
+        funcs,
+        tps
+    );
+    ty->setDecl(decl);
+    m_Scope->addDecl(decl);
+    return decl;
+}
+
+EnumDecl *InterfaceReader::readEnum() {
+    Runes runes;
+    runes.bits = readU32();
+    String name = readStr();
+    EnumType *ty = EnumType::create(m_Context, name, readType(m_Scope));
+
+    std::vector<EnumVariantDecl *> variants(readCount());
+    for (auto &variant : variants) {
+        Runes variantRunes;
+        variantRunes.bits = readU32();
+        String variantName = readStr();
+        variant = m_Context->create<EnumVariantDecl>(variantRunes, m_Start,
+            variantName, ty, readI64());
+        m_Scope->addDecl(variant);
+    }
+
+    EnumDecl *decl = m_Context->create<EnumDecl>(runes, m_Start, name, ty,
+        variants);
+    ty->setDecl(decl);
+    m_Scope->addDecl(decl);
+    return decl;
+}
+
+VarDecl *InterfaceReader::readVar() {
+    Runes runes;
+    runes.bits = readU32();
+    String name = readStr();
+    bool mut = readU8();
+    Type *ty = readType(m_Scope);
+
+    std::string_view src;
+    Metadata md = m_Start;
+    if (!readSource(src, md))
+        fail();
+
+    Expr *init = Parser::parseExpr(m_Unit, m_Scope, src, md);
+    VarDecl *decl = m_Context->create<VarDecl>(runes, md, name, ty, init,
+        mut, true);
+    m_Scope->addDecl(decl);
+    return decl;
+}
+
+void InterfaceReader::readUses() {
+    for (unsigned i = 0, e = readCount(); i != e; ++i) {
+        UseKind kind = UseKind(readU8());
+        String path = readStr();
+
+        UseDecl *use = nullptr;
+        if (kind == UseKind::Named) {
+            use = m_Context->create<UseDecl>(Runes(), m_Start, path,
+                readStr());
+            m_Scope->addDecl(use);
+        } else if (kind == UseKind::Listed) {
+            std::vector<String> symbols(readCount());
+            for (auto &symbol : symbols)
+                symbol = readStr();
+
+            use = m_Context->create<UseDecl>(Runes(), m_Start, path, symbols);
+        } else if (kind == UseKind::All) {
+            use = m_Context->create<UseDecl>(Runes(), m_Start, path);
+        } else {
+            fail();
+        }
+
+        m_Unit->addUse(use);
+    }
+}
+
+void InterfaceReader::checkSource(const String &source) {
+    uint32_t size = readU32();
+    uint64_t hash = readI64();
+
+    // An interface may be all there is of a unit. Otherwise, it must still
+    // match its source, or it would silently stand in for old declarations.
+    std::ifstream file = std::ifstream(source, std::ios::binary);
+    if (!file.is_open())
+        return;
+
+    String contents = String(std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>());
+    if (contents.size() != size || hashSource(contents) != hash) {
+        fatal("module interface is out of date with '" + source +
+              "', and must be emitted again: " + m_Path, nullptr);
+    }
+}
+
+InterfaceReader::InterfaceReader(const String &path, const String &source)
+  : m_Path(path), m_Data(SourceManager::get().mapFile(path)) {
+    if (read(sizeof(InterfaceMagic)) !=
+      std::string_view(InterfaceMagic, sizeof(InterfaceMagic)))
+        fail();
+
+    if (readU32() != InterfaceVersion)
+        fatal("module interface has an unsupported version: " + path, nullptr);
+
+    checkSource(source);
+
+    // The source block becomes a file of its own, so that template bodies and
+    // initializers are lexed and reported on like any other source.
+    std::filesystem::path P = std::filesystem::path(source);
+    std::string_view src = read(readU32());
+    File file = File(P.filename().string(), P.parent_path().string(), path,
+                     src);
+    m_Start = SourceManager::get().addFile(file);
+    m_Source = src;
+
+    m_Unit = new TranslationUnit(P.stem().string(), m_Start.getFile());
+    m_Unit->setInterface();
+    m_Context = m_Unit->getContext();
+    m_Scope = m_Unit->getScope();
+
+    readUses();
+
+    for (unsigned i = 0, e = readCount(); i != e; ++i) {
+        NamedDecl *D = nullptr;
+        switch (DeclKind(readU8())) {
+        case DeclKind::Function:
+            D = readFunction(m_Scope);
+            break;
+        case DeclKind::Struct:
+            D = readStruct();
+            break;
+        case DeclKind::Enum:
+            D = readEnum();
+            break;
+        case DeclKind::Var:
+            D = readVar();
+            break;
+        default:
+            fail();
+        }
+
+        m_Unit->addDecl(D);
+        m_Unit->addExport(D);
+    }
+
+    if (m_Pos != m_Data.size())
+        fail();
+}
+
+TranslationUnit *meddle::loadInterface(const String &path,
+                                       const String &source) {
+    InterfaceReader reader = InterfaceReader(path, source);
+    return reader.get();
+}
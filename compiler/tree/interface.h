@@ -0,0 +1,46 @@
+#ifndef MEDDLE_INTERFACE_H
+#define MEDDLE_INTERFACE_H
+
+#include "unit.h"
+
+#include <ostream>
+#include <string>
+
+using String = std::string;
+
+namespace meddle {
+
+/// The version of the module interface format. Interfaces of any other
+/// version are rejected.
+constexpr uint32_t InterfaceVersion = 1;
+
+/// \returns The path of the module interface for the source file at \p path,
+/// i.e. `lib.mdli` for `lib.mdl`.
+String getInterfacePath(const String &path);
+
+/// Write the module interface of the analyzed unit \p U to \p OS.
+///
+/// An interface holds the uses of a unit and its exported declarations, with
+/// their types written as type references. Template function bodies and
+/// initializers are kept as source, and are parsed once an importer needs
+/// them, so they may only refer to the exports of the unit.
+///
+/// \returns If the interface was written. Nothing is written if an export
+/// cannot be named from outside of the unit, i.e. if its type is private.
+bool writeInterface(TranslationUnit *U, std::ostream &OS);
+
+/// Load the module interface at \p path, which stands in for the source file
+/// \p source. The interface is mapped into memory for the rest of the
+/// compilation.
+///
+/// An interface records a hash of the source it was written from. If \p source
+/// still exists and no longer matches, the interface is rejected as out of
+/// date. Otherwise, the interface is all there is of the unit.
+///
+/// \returns A unit with the exports of the interface, which has yet to be
+/// analyzed like any other unit.
+TranslationUnit *loadInterface(const String &path, const String &source);
+
+} // namespace meddle
+
+#endif // MEDDLE_INTERFACE_H
@@ -13,6 +13,12 @@ NameResolution::NameResolution(const Options &opts, TranslationUnit *U)
     U->accept(this);
 }
 
+NameResolution::NameResolution(const Options &opts, TranslationUnit *U, 
+                               FunctionDecl *F, Stmt *body) 
+  : m_Opts(opts), m_Unit(U), m_Scope(F->getScope()) {
+    body->accept(this);
+}
+
 void NameResolution::visit(TranslationUnit *U) {
     for (auto &D : U->getDecls())
         D->accept(this);
@@ -21,8 +27,20 @@ void NameResolution::visit(TranslationUnit *U) {
 void NameResolution::visit(FunctionDecl *decl) {
     decl->setPUnit(m_Unit);
 
+    // The type of a function is interned when it is parsed, usually over
+    // deferred types, so it is interned again now that they are resolved.
+    decl->m_Type = FunctionType::get(m_Unit->getContext(), 
+        decl->m_Type->getParams(), decl->m_Type->getReturnType());
+
+    // The bodies kept by an interface were checked when it was written, so
+    // they are only parsed and resolved once a specialization needs them.
+    if (m_Unit->isInterface())
+        return;
+
     m_Scope = decl->getScope();
-    decl->getBody()->accept(this);
+    if (Stmt *body = decl->getBody())
+        body->accept(this);
+
     m_Scope = m_Scope->getParent();
 }
 
@@ -152,12 +170,12 @@ void NameResolution::visit(BinaryExpr *expr) {
 }
 
 void NameResolution::visit(CallExpr *expr) {
-    NamedDecl *D = m_Scope->lookup(expr->getName());
+    NamedDecl *D = m_Scope->lookup(expr->getIdent());
     if (!D)
         fatal("unresolved function reference: " + expr->getName(), 
             &expr->getMetadata());
 
-    FunctionDecl *F = dynamic_cast<FunctionDecl *>(D);
+    FunctionDecl *F = dyn_cast<FunctionDecl>(D);
     if (!F)
         fatal("reference exists, but is not a function: " + expr->getName(), 
             &expr->getMetadata());
@@ -175,7 +193,11 @@ void NameResolution::visit(CallExpr *expr) {
                 &expr->getMetadata());
         }
 
-        expr->m_Ref = F->fetchSpecialization(expr->m_TypeArgs);
+        auto *spec = F->fetchSpecialization(expr->m_TypeArgs);
+        if (F->getPUnit() != m_Unit)
+            spec->setExternal();
+
+        expr->m_Ref = spec;
     } else {
         expr->m_Ref = F;
     }
@@ -253,17 +275,17 @@ void NameResolution::visit(ParenExpr *expr) {
 void NameResolution::visit(RefExpr *expr) {
     NamedDecl *named = expr->getRef();
     if (!named) {
-        named = m_Scope->lookup(expr->getName());
+        named = m_Scope->lookup(expr->getIdent());
         if (!named)
             fatal("unresolved reference: " + expr->getName(), 
                 &expr->getMetadata());
     }
     
-    if (auto *var = dynamic_cast<VarDecl *>(named))
+    if (auto *var = dyn_cast<VarDecl>(named))
         expr->m_Type = var->getType();
-    else if (auto *enumvar = dynamic_cast<EnumVariantDecl *>(named))
+    else if (auto *enumvar = dyn_cast<EnumVariantDecl>(named))
         expr->m_Type = enumvar->getType();
-    else if (auto *field = dynamic_cast<FieldDecl *>(named))
+    else if (auto *field = dyn_cast<FieldDecl>(named))
         expr->m_Type = field->getType();
     else
         fatal("reference exists, but is not a variable: " + expr->getName(), 
@@ -278,7 +300,7 @@ void NameResolution::visit(SubscriptExpr *expr) {
 }
 
 void NameResolution::visit(TypeSpecExpr *expr) {
-    Type *T = m_Unit->getContext()->resolveType(expr->getName(), m_Scope, expr->getMetadata(), true);
+    Type *T = m_Unit->getContext()->resolveType(expr->getTypeRef(), m_Scope, expr->getMetadata(), true);
     if (!T)
         fatal("unresolved type reference: " + expr->getName(), 
             &expr->getMetadata());
@@ -290,7 +312,7 @@ void NameResolution::visit(TypeSpecExpr *expr) {
     StructDecl *_struct = T->asStruct()->getDecl();
     expr->m_Ref = _struct; 
 
-    if (!dynamic_cast<CallExpr *>(expr->getExpr()))
+    if (!isa<CallExpr>(expr->getExpr()))
         fatal("expected call expression after '::' operator on structure", 
             &expr->getMetadata());
 
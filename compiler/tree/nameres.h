@@ -17,6 +17,11 @@ class NameResolution final : public Visitor {
 public:
     NameResolution(const Options &opts, TranslationUnit *U);
 
+    /// Resolve names in \p body, the body of \p F in \p U, which was parsed
+    /// after the rest of \p U was resolved.
+    NameResolution(const Options &opts, TranslationUnit *U, FunctionDecl *F, 
+                   Stmt *body);
+
     void visit(TranslationUnit *unit) override;
 
     void visit(FunctionDecl *decl) override;
@@ -11,8 +11,8 @@ using namespace meddle;
 static unsigned g_Indent = 0;
 
 static String stringify_metadata(const Metadata &md) {
-    return md.file.filename + "<" + std::to_string(md.line) + ":" + 
-           std::to_string(md.col) + ">";
+    return md.getFile().filename + "<" + std::to_string(md.getLine()) + ":" + 
+           std::to_string(md.getCol()) + ">";
 }
 
 static String stringify_indent() {
@@ -59,8 +59,8 @@ void FunctionDecl::print(std::ostream &OS) const {
     for (auto &param : m_Params)
         param->print(OS);
 
-    if (m_Body)
-        m_Body->print(OS);
+    if (Stmt *body = getBody())
+        body->print(OS);
 
     for (auto &spec : m_TemplateSpecs)
         spec->print(OS);
@@ -3,20 +3,47 @@
 
 using namespace meddle;
 
-NamedDecl *Scope::lookup(const String &N) const {
-    for (auto &D : m_Decls)
-        if (D->getName() == N)
-            return D;
+NamedDecl *Scope::find(Ident N) const {
+    if (!m_Table.empty()) {
+        auto it = m_Table.find(N);
+        return it != m_Table.end() ? it->second : nullptr;
+    }
 
-    if (m_Parent)
-        return m_Parent->lookup(N);
+    for (unsigned i = 0, e = m_Decls.size(); i != e; ++i)
+        if (m_Inline[i] == N)
+            return m_Decls[i];
+
+    return nullptr;
+}
+
+NamedDecl *Scope::lookup(Ident N) const {
+    // Nothing can be named by a spelling that was never interned.
+    if (N.empty())
+        return nullptr;
+
+    for (const Scope *S = this; S; S = S->m_Parent)
+        if (NamedDecl *D = S->find(N))
+            return D;
 
     return nullptr;
 }
 
 void Scope::addDecl(NamedDecl *D) {
-    if (lookup(D->getName()))
+    Ident N = D->getIdent();
+    if (lookup(N))
         fatal("duplicate declaration: " + D->getName(), &D->getMetadata());
 
+    if (m_Decls.size() < InlineDecls) {
+        m_Inline[m_Decls.size()] = N;
+    } else {
+        if (m_Table.empty()) {
+            m_Table.reserve(InlineDecls * 2);
+            for (unsigned i = 0; i != InlineDecls; ++i)
+                m_Table.emplace(m_Inline[i], m_Decls[i]);
+        }
+
+        m_Table.emplace(N, D);
+    }
+
     m_Decls.push_back(D);
 }
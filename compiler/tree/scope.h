@@ -2,21 +2,42 @@
 #define MEDDLE_SCOPE_H
 
 #include "decl.h"
+#include "../core/ident.h"
+
+#include <unordered_map>
 
 namespace meddle {
 
+/// A symbol table of named declarations, chained to its enclosing scope.
+///
+/// Names are interned, so a lookup only compares pointers. The names of the
+/// first few declarations sit inline in the scope and are searched linearly,
+/// which suits the many small block and parameter scopes. A scope that grows
+/// past that, i.e. a unit with many functions, moves to a hash table.
 class Scope final {
+    static constexpr unsigned InlineDecls = 8;
+
     Scope *m_Parent;
     std::vector<NamedDecl *> m_Decls;
+    Ident m_Inline[InlineDecls];
+    std::unordered_map<Ident, NamedDecl *> m_Table;
+
+    /// \returns The declaration named \p N in this scope alone, if any.
+    NamedDecl *find(Ident N) const;
 
 public:
     Scope(Scope *P = nullptr) : m_Parent(P) {}
 
     Scope *getParent() const { return m_Parent; }
 
-    const std::vector<NamedDecl *> getDecls() const { return m_Decls; }
+    const std::vector<NamedDecl *> &getDecls() const { return m_Decls; }
+
+    /// \returns The declaration named \p N in this scope or any enclosing
+    /// scope, or null if there is none.
+    NamedDecl *lookup(Ident N) const;
 
-    NamedDecl *lookup(const String &N) const;
+    NamedDecl *lookup(std::string_view N) const 
+    { return lookup(Ident::find(N)); }
 
     void addDecl(NamedDecl *D);
 };
@@ -22,10 +22,10 @@ enum class TypeCheckMode {
 /// if ...
 ///     mut x: ... = ... ;
 static void checkCompoundedDeclStmt(Stmt *S) {
-    if (dynamic_cast<CompoundStmt *>(S))
+    if (isa<CompoundStmt>(S))
         return;
 
-    if (dynamic_cast<DeclStmt *>(S))
+    if (isa<DeclStmt>(S))
         fatal("declarations must be in a compound statement", &S->getMetadata());
 }
 
@@ -72,6 +72,15 @@ Sema::Sema(const Options &opts, TranslationUnit *U) : m_Opts(opts), m_Unit(U) {
     m_Unit->accept(this);
 }
 
+Sema::Sema(const Options &opts, TranslationUnit *U, FunctionDecl *F, 
+           Stmt *body) : m_Opts(opts), m_Unit(U), m_Function(F) {
+    body->accept(this);
+}
+
+CastExpr *Sema::createCast(Type *T, Expr *E) {
+    return m_Unit->getContext()->create<CastExpr>(E->getMetadata(), T, E);
+}
+
 void Sema::visit(TranslationUnit *U) {
     for (auto &D : U->getDecls()) D->accept(this);
 }
@@ -103,7 +112,8 @@ void Sema::visit(FunctionDecl *decl) {
                 &first->getMetadata());
     }
 
-    if (decl->getBody())
+    // See NameResolution::visit(FunctionDecl *).
+    if (!m_Unit->isInterface() && decl->getBody())
         decl->getBody()->accept(this);
     
     m_Function = nullptr;
@@ -119,21 +129,17 @@ void Sema::visit(VarDecl *decl) {
             &decl->getInit()->getMetadata(),
             "initializer"
         )) {
-            if (auto *arr = dynamic_cast<ArrayExpr *>(decl->getInit())) {
+            if (auto *arr = dyn_cast<ArrayExpr>(decl->getInit())) {
                 Type *elemTy = static_cast<ArrayType *>(decl->getType())->getElement();
                 
                 for (unsigned i = 0, n = arr->getElements().size(); i != n; ++i) {
                     Expr *elem = arr->m_Elements[i];
-                    arr->m_Elements[i] = new CastExpr(elem->getMetadata(), elemTy, elem);
+                    arr->m_Elements[i] = createCast(elemTy, elem);
                 }
     
                 decl->getInit()->setType(decl->getType());
             } else {
-                decl->m_Init = new CastExpr(
-                    decl->getInit()->getMetadata(), 
-                    decl->getType(), 
-                    decl->getInit()
-                );
+                decl->m_Init = createCast(decl->getType(), decl->getInit());
             }
         }
     }
@@ -204,21 +210,18 @@ void Sema::visit(MatchStmt *stmt) {
             &C->getMetadata(),
             "pattern"
         )) {
-            if (auto *arr = dynamic_cast<ArrayExpr *>(C->getPattern())) {
+            if (auto *arr = dyn_cast<ArrayExpr>(C->getPattern())) {
                 Type *elemTy = static_cast<ArrayType *>(stmt->getPattern()->getType())->getElement();
                 
                 for (unsigned i = 0, n = arr->getElements().size(); i != n; ++i) {
                     Expr *elem = arr->m_Elements[i];
-                    arr->m_Elements[i] = new CastExpr(elem->getMetadata(), elemTy, elem);
+                    arr->m_Elements[i] = createCast(elemTy, elem);
                 }
     
                 C->getPattern()->setType(stmt->getPattern()->getType());
             } else {
-                C->m_Pattern = new CastExpr(
-                    C->getPattern()->getMetadata(), 
-                    stmt->getPattern()->getType(), 
-                    C->getPattern()
-                );
+                C->m_Pattern = createCast(stmt->getPattern()->getType(), 
+                    C->getPattern());
             }
         }
     }
@@ -241,21 +244,17 @@ void Sema::visit(RetStmt *stmt) {
             &stmt->getMetadata(),
             "return"
         )) {
-            if (auto *arr = dynamic_cast<ArrayExpr *>(stmt->getExpr())) {
+            if (auto *arr = dyn_cast<ArrayExpr>(stmt->getExpr())) {
                 Type *elemTy = static_cast<ArrayType *>(m_Function->getReturnType())->getElement();
                 
                 for (unsigned i = 0, n = arr->getElements().size(); i != n; ++i) {
                     Expr *elem = arr->m_Elements[i];
-                    arr->m_Elements[i] = new CastExpr(elem->getMetadata(), elemTy, elem);
+                    arr->m_Elements[i] = createCast(elemTy, elem);
                 }
     
                 stmt->getExpr()->setType(m_Function->getReturnType());
             } else {
-                stmt->m_Expr = new CastExpr(
-                    stmt->m_Expr->getMetadata(), 
-                    m_Function->getReturnType(), 
-                    stmt->m_Expr
-                );
+                stmt->m_Expr = createCast(m_Function->getReturnType(), stmt->m_Expr);
             }
         }
     } else if (!m_Function->getReturnType()->isVoid()) {
@@ -301,21 +300,17 @@ ARRAY_EXPR_ERROR:
             &Elem->getMetadata(), 
             "array element"
         )) {
-            if (auto *arr = dynamic_cast<ArrayExpr *>(Elem)) {
+            if (auto *arr = dyn_cast<ArrayExpr>(Elem)) {
                 Type *elemTy = static_cast<ArrayType *>(arrTy->getElement())->getElement();
                 
                 for (unsigned i = 0, n = arr->getElements().size(); i != n; ++i) {
                     Expr *elem = arr->m_Elements[i];
-                    arr->m_Elements[i] = new CastExpr(elem->getMetadata(), elemTy, elem);
+                    arr->m_Elements[i] = createCast(elemTy, elem);
                 }
     
                 Elem->setType(arrTy->getElement());
             } else {
-                expr->m_Elements[i] = new CastExpr(
-                    Elem->getMetadata(), 
-                    expr->getType(), 
-                    Elem
-                );
+                expr->m_Elements[i] = createCast(expr->getType(), Elem);
             }
         }
     }
@@ -333,21 +328,17 @@ void Sema::visit(BinaryExpr *expr) {
         mode = TypeCheckMode::Loose;
 
     if (typeCheck(RTy, LTy, &expr->getMetadata(), "operator", mode)) {
-        if (auto *arr = dynamic_cast<ArrayExpr *>(LTy)) {
+        if (auto *arr = dyn_cast<ArrayExpr>(expr->getRHS())) {
             Type *elemTy = static_cast<ArrayType *>(LTy)->getElement();
             
             for (unsigned i = 0, n = arr->getElements().size(); i != n; ++i) {
                 Expr *elem = arr->m_Elements[i];
-                arr->m_Elements[i] = new CastExpr(elem->getMetadata(), elemTy, elem);
+                arr->m_Elements[i] = createCast(elemTy, elem);
             }
 
             expr->getRHS()->setType(LTy);
         } else {
-            expr->m_RHS = new CastExpr(
-                expr->getRHS()->getMetadata(), 
-                LTy, 
-                expr->getRHS()
-            );
+            expr->m_RHS = createCast(LTy, expr->getRHS());
         }
     }
 
@@ -365,23 +356,23 @@ void Sema::visit(BinaryExpr *expr) {
 
     VarDecl *LVal = nullptr;
     
-    if (auto *E = dynamic_cast<UnaryExpr *>(expr->getLHS())) {
+    if (auto *E = dyn_cast<UnaryExpr>(expr->getLHS())) {
         if (E->getKind() == UnaryExpr::Kind::Dereference) {
             // Unary expressions are only lvalues for dereferences `*`.
-            RefExpr *RE = dynamic_cast<RefExpr *>(E->getExpr());
+            RefExpr *RE = dyn_cast<RefExpr>(E->getExpr());
             assert(RE && "Non-referencing deference expression.");
-            LVal = dynamic_cast<VarDecl *>(RE->getRef());
+            LVal = dyn_cast_or_null<VarDecl>(RE->getRef());
         }
-    } else if (auto *E = dynamic_cast<SubscriptExpr *>(expr->getLHS())) {
-        RefExpr *RE = dynamic_cast<RefExpr *>(E->getBase());
+    } else if (auto *E = dyn_cast<SubscriptExpr>(expr->getLHS())) {
+        RefExpr *RE = dyn_cast<RefExpr>(E->getBase());
         assert(RE && "Non-referencing subscript expression.");
-        LVal = dynamic_cast<VarDecl *>(RE->getRef());
-    } else if (auto *E = dynamic_cast<AccessExpr *>(expr->getLHS())) {
-        RefExpr *RE = dynamic_cast<RefExpr *>(E->getBase());
+        LVal = dyn_cast_or_null<VarDecl>(RE->getRef());
+    } else if (auto *E = dyn_cast<AccessExpr>(expr->getLHS())) {
+        RefExpr *RE = dyn_cast<RefExpr>(E->getBase());
         assert(RE && "Non-referencing access expression.");
-        LVal = dynamic_cast<VarDecl *>(RE->getRef());
-    } else if (auto *E = dynamic_cast<RefExpr *>(expr->getLHS())) {
-        LVal = dynamic_cast<VarDecl *>(E->getRef());
+        LVal = dyn_cast_or_null<VarDecl>(RE->getRef());
+    } else if (auto *E = dyn_cast<RefExpr>(expr->getLHS())) {
+        LVal = dyn_cast_or_null<VarDecl>(E->getRef());
     }
 
     assert(LVal && "LHS must be a reference.");
@@ -407,21 +398,17 @@ void Sema::visit(CallExpr *expr) {
         ParamDecl *param = callee->getParam(i);
 
         if (typeCheck(arg->getType(), param->getType(), &arg->getMetadata(), "argument")) {
-            if (auto *arr = dynamic_cast<ArrayExpr *>(arg)) {
+            if (auto *arr = dyn_cast<ArrayExpr>(arg)) {
                 Type *elemTy = static_cast<ArrayType *>(param->getType())->getElement();
                 
                 for (unsigned i = 0, n = arr->getElements().size(); i != n; ++i) {
                     Expr *elem = arr->m_Elements[i];
-                    arr->m_Elements[i] = new CastExpr(elem->getMetadata(), elemTy, elem);
+                    arr->m_Elements[i] = createCast(elemTy, elem);
                 }
     
                 arg->setType(param->getType());
             } else {
-                expr->m_Args[i] = new CastExpr(
-                    arg->getMetadata(), 
-                    param->getType(), 
-                    arg
-                );
+                expr->m_Args[i] = createCast(param->getType(), arg);
             }
         }
     }
@@ -444,7 +431,7 @@ void Sema::visit(FieldInitExpr *expr) {
     FieldDecl *fld = static_cast<FieldDecl *>(expr->getRef());
 
     if (typeCheck(expr->getType(), fld->getType(), &expr->getMetadata(), "field initializer")) {
-        if (auto *arr = dynamic_cast<ArrayExpr *>(expr->getExpr())) {
+        if (auto *arr = dyn_cast<ArrayExpr>(expr->getExpr())) {
             Type *elementTy = nullptr;
             if (fld->getType()->isArray())
                 elementTy = fld->getType()->asArray()->getElement();
@@ -455,16 +442,12 @@ void Sema::visit(FieldInitExpr *expr) {
             
             for (unsigned i = 0, n = arr->getElements().size(); i != n; ++i) {
                 Expr *elem = arr->m_Elements[i];
-                arr->m_Elements[i] = new CastExpr(elem->getMetadata(), elementTy, elem);
+                arr->m_Elements[i] = createCast(elementTy, elem);
             }
 
             expr->m_Expr->setType(fld->getType());
         } else {
-            expr->m_Expr = new CastExpr(
-                expr->getExpr()->getMetadata(), 
-                fld->getType(), 
-                expr->getExpr()
-            );
+            expr->m_Expr = createCast(fld->getType(), expr->getExpr());
             
         }
 
@@ -504,21 +487,17 @@ void Sema::visit(MethodCallExpr *expr) {
         ParamDecl *param = callee->getParam(i + 1);
 
         if (typeCheck(arg->getType(), param->getType(), &arg->getMetadata(), "argument")) {
-            if (auto *arr = dynamic_cast<ArrayExpr *>(arg)) {
+            if (auto *arr = dyn_cast<ArrayExpr>(arg)) {
                 Type *elemTy = static_cast<ArrayType *>(param->getType())->getElement();
                 
                 for (unsigned i = 0, n = arr->getElements().size(); i != n; ++i) {
                     Expr *elem = arr->m_Elements[i];
-                    arr->m_Elements[i] = new CastExpr(elem->getMetadata(), elemTy, elem);
+                    arr->m_Elements[i] = createCast(elemTy, elem);
                 }
     
                 arg->setType(param->getType());
             } else {
-                expr->m_Args[i] = new CastExpr(
-                    arg->getMetadata(), 
-                    param->getType(), 
-                    arg
-                );
+                expr->m_Args[i] = createCast(param->getType(), arg);
             }
         }
     }
@@ -600,8 +579,8 @@ void Sema::visit(UnaryExpr *expr) {
                   &expr->getMetadata());
 
         VarDecl *LVal = nullptr;
-        if (auto *E = dynamic_cast<RefExpr *>(expr->getExpr())) {
-            LVal = dynamic_cast<VarDecl *>(E->getRef());
+        if (auto *E = dyn_cast<RefExpr>(expr->getExpr())) {
+            LVal = dyn_cast_or_null<VarDecl>(E->getRef());
         }
               
         assert(LVal && "LHS must be a reference.");
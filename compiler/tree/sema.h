@@ -18,9 +18,16 @@ class Sema final : public Visitor {
     TranslationUnit *m_Unit;
     FunctionDecl *m_Function;
 
+    /// \returns A new implicit cast of \p E to \p T, in the unit's context.
+    CastExpr *createCast(Type *T, Expr *E);
+
 public:
     Sema(const Options &opts, TranslationUnit *U);
 
+    /// Check \p body, the body of \p F in \p U, which was parsed after the
+    /// rest of \p U was checked.
+    Sema(const Options &opts, TranslationUnit *U, FunctionDecl *F, Stmt *body);
+
     void visit(TranslationUnit *unit) override;
 
     void visit(FunctionDecl *decl) override;
@@ -0,0 +1,56 @@
+#ifndef MEDDLE_SPECTABLE_H
+#define MEDDLE_SPECTABLE_H
+
+#include "type.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace meddle {
+
+/// \returns A hash of the type arguments \p args that agrees with
+/// Type::compare. Primitive and composite types are hashed by structure, as
+/// each unit has its own instances of them, and named types by identity.
+size_t hashTypeArgs(const std::vector<Type *> &args);
+
+/// The specializations of a template, indexed by a hash of their type
+/// arguments. Any number of threads may look up specializations while
+/// another adds one.
+template <typename SpecT>
+class SpecializationTable final {
+    mutable std::shared_mutex m_Lock;
+    std::unordered_multimap<size_t, SpecT *> m_Specs = {};
+
+public:
+    /// \returns The specialization for \p args, if there is one.
+    SpecT *find(const std::vector<Type *> &args) const {
+        size_t hash = hashTypeArgs(args);
+        std::shared_lock<std::shared_mutex> lock(m_Lock);
+
+        auto [begin, end] = m_Specs.equal_range(hash);
+        for (auto it = begin; it != end; ++it)
+            if (it->second->compareArgs(args))
+                return it->second;
+
+        return nullptr;
+    }
+
+    /// Add \p spec to this table, under its type arguments.
+    void insert(SpecT *spec) {
+        size_t hash = hashTypeArgs(spec->getArgs());
+        std::unique_lock<std::shared_mutex> lock(m_Lock);
+        m_Specs.emplace(hash, spec);
+    }
+
+    /// \returns The number of specializations in this table.
+    size_t size() const {
+        std::shared_lock<std::shared_mutex> lock(m_Lock);
+        return m_Specs.size();
+    }
+};
+
+} // namespace meddle
+
+#endif // MEDDLE_SPECTABLE_H
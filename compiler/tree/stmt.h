@@ -12,16 +12,33 @@ namespace meddle {
 
 class Scope;
 
+/// The kind of a statement.
+enum class StmtKind : uint8_t {
+    Break,
+    Continue,
+    Compound,
+    Decl,
+    Expr,
+    If,
+    Case,
+    Match,
+    Ret,
+    Until,
+};
+
 class Stmt {
 protected:
+    StmtKind m_StmtKind;
     Metadata m_Metadata;
 
 public:
-    Stmt(const Metadata &M) : m_Metadata(M) {}
+    Stmt(StmtKind K, const Metadata &M) : m_StmtKind(K), m_Metadata(M) {}
     virtual ~Stmt() = default;
 
     virtual void accept(Visitor *V) = 0;
 
+    StmtKind getStmtKind() const { return m_StmtKind; }
+
     const Metadata &getMetadata() const { return m_Metadata; }
 
     virtual void print(std::ostream &OS) const = 0;
@@ -33,9 +50,12 @@ class BreakStmt final : public Stmt {
     friend class Sema;
 
 public:
-    BreakStmt(const Metadata &M) : Stmt(M) {}
+    BreakStmt(const Metadata &M) : Stmt(StmtKind::Break, M) {}
     ~BreakStmt() override = default;
 
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Break; }
+
     void accept(Visitor *V) override { V->visit(this); }
 
     void print(std::ostream &OS) const override;
@@ -47,9 +67,12 @@ class ContinueStmt final : public Stmt {
     friend class Sema;
 
 public:
-    ContinueStmt(const Metadata &M) : Stmt(M) {}
+    ContinueStmt(const Metadata &M) : Stmt(StmtKind::Continue, M) {}
     ~ContinueStmt() override = default;
 
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Continue; }
+
     void accept(Visitor *V) override { V->visit(this); }
 
     void print(std::ostream &OS) const override;
@@ -65,14 +88,10 @@ class CompoundStmt final : public Stmt {
 
 public:
     CompoundStmt(const Metadata &M, Scope *S, std::vector<Stmt *> stmts = {}) 
-      : Stmt(M), m_Scope(S), m_Stmts(stmts) {}
-
-    ~CompoundStmt() override {
-        for (auto &S : m_Stmts)
-            delete S;
+      : Stmt(StmtKind::Compound, M), m_Scope(S), m_Stmts(stmts) {}
 
-        delete m_Scope;
-    }
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Compound; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -93,11 +112,10 @@ class DeclStmt final : public Stmt {
     Decl *m_Decl;
 
 public:
-    DeclStmt(const Metadata &M, Decl *D) : Stmt(M), m_Decl(D) {}
+    DeclStmt(const Metadata &M, Decl *D) : Stmt(StmtKind::Decl, M), m_Decl(D) {}
 
-    ~DeclStmt() override {
-        delete m_Decl;
-    }
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Decl; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -114,11 +132,10 @@ class ExprStmt final : public Stmt {
     Expr *m_Expr;
 
 public:
-    ExprStmt(const Metadata &M, Expr *E) : Stmt(M), m_Expr(E) {}
+    ExprStmt(const Metadata &M, Expr *E) : Stmt(StmtKind::Expr, M), m_Expr(E) {}
 
-    ~ExprStmt() override {
-        delete m_Expr;
-    }
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Expr; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -138,15 +155,10 @@ class IfStmt final : public Stmt {
 
 public:
     IfStmt(const Metadata &M, Expr *C, Stmt *T, Stmt *E)
-      : Stmt(M), m_Cond(C), m_Then(T), m_Else(E) {}
+      : Stmt(StmtKind::If, M), m_Cond(C), m_Then(T), m_Else(E) {}
 
-    ~IfStmt() override {
-        delete m_Cond;
-        delete m_Then;
-
-        if (m_Else)
-            delete m_Else;
-    }
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::If; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -171,13 +183,11 @@ class CaseStmt final : public Stmt {
 
 public:
     CaseStmt(const Metadata &M, Expr *P, Stmt *B) 
-      : Stmt(M), m_Pattern(P), m_Body(B) {}
+      : Stmt(StmtKind::Case, M), m_Pattern(P), m_Body(B) {}
+
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Case; }
 
-    ~CaseStmt() override {
-        delete m_Pattern;
-        delete m_Body;
-    }
-    
     void accept(Visitor *V) override { V->visit(this); }
 
     Expr *getPattern() const { return m_Pattern; }
@@ -198,17 +208,10 @@ class MatchStmt final : public Stmt {
 
 public:
     MatchStmt(const Metadata &M, Expr *P, std::vector<CaseStmt *> C, Stmt *D)
-      : Stmt(M), m_Pattern(P), m_Cases(C), m_Default(D) {}
-
-    ~MatchStmt() override {
-        delete m_Pattern;
-
-        if (m_Default)
-            delete m_Default;
+      : Stmt(StmtKind::Match, M), m_Pattern(P), m_Cases(C), m_Default(D) {}
 
-        for (auto &C : m_Cases)
-            delete C;
-    }
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Match; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -229,12 +232,10 @@ class RetStmt final : public Stmt {
     Expr *m_Expr;
 
 public:
-    RetStmt(const Metadata &M, Expr *E) : Stmt(M), m_Expr(E) {}
+    RetStmt(const Metadata &M, Expr *E) : Stmt(StmtKind::Ret, M), m_Expr(E) {}
 
-    ~RetStmt() override {
-        if (m_Expr)
-            delete m_Expr;
-    }
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Ret; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
@@ -253,12 +254,10 @@ class UntilStmt final : public Stmt {
 
 public:
     UntilStmt(const Metadata &M, Expr *C, Stmt *B) 
-      : Stmt(M), m_Cond(C), m_Body(B) {}
+      : Stmt(StmtKind::Until, M), m_Cond(C), m_Body(B) {}
 
-    ~UntilStmt() override {
-        delete m_Cond;
-        delete m_Body;
-    }
+    static bool classof(const Stmt *S) 
+    { return S->getStmtKind() == StmtKind::Until; }
 
     void accept(Visitor *V) override { V->visit(this); }
 
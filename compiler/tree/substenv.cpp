@@ -5,17 +5,37 @@
 using namespace meddle;
 
 Type *SubstEnv::substType(Context *ctx, Type *ty) {
-    if (ty->isDeferred()) {
-        DeferredType *defer = ty->asDeferred();
-        return substType(ctx, ty->asDeferred()->getUnderlying());
-    } else if (ty->isArray()) {
-        return ArrayType::get(ctx, substType(ctx, ty->asArray()->getElement()), 
-            ty->asArray()->getSize());
-    } else if (ty->isPointer()) {
-        return PointerType::get(ctx, substType(ctx, ty->asPointer()->getPointee()));
-    } else if (auto *param = dynamic_cast<TemplateParamType *>(ty)) {
-        return substParam(param);
-    } else if (auto *spec = dynamic_cast<TemplateStructType *>(ty)) {
+    switch (ty->getTypeKind()) {
+    case TypeKind::TemplateParam:
+        return substParam(cast<TemplateParamType>(ty));
+    case TypeKind::Deferred:
+    case TypeKind::Array:
+    case TypeKind::Pointer:
+    case TypeKind::TemplateStruct:
+    case TypeKind::DependentTemplateStruct:
+        break;
+    default:
+        return ty;
+    }
+
+    auto it = m_Cache.find(ty);
+    if (it != m_Cache.end())
+        return it->second;
+
+    Type *conc = substComposite(ctx, ty);
+    m_Cache.emplace(ty, conc);
+    return conc;
+}
+
+Type *SubstEnv::substComposite(Context *ctx, Type *ty) {
+    if (auto *defer = dyn_cast<DeferredType>(ty)) {
+        return substType(ctx, defer->getUnderlying());
+    } else if (auto *arr = dyn_cast<ArrayType>(ty)) {
+        return ArrayType::get(ctx, substType(ctx, arr->getElement()), 
+            arr->getSize());
+    } else if (auto *ptr = dyn_cast<PointerType>(ty)) {
+        return PointerType::get(ctx, substType(ctx, ptr->getPointee()));
+    } else if (auto *spec = dyn_cast<TemplateStructType>(ty)) {
         std::vector<Type *> substArgs;
         substArgs.reserve(spec->getArgs().size());
         bool changed = false;
@@ -31,7 +51,7 @@ Type *SubstEnv::substType(Context *ctx, Type *ty) {
             return spec;
 
         return TemplateStructType::get(ctx, spec->getTemplateDecl(), substArgs);
-    } else if (auto *dep = dynamic_cast<DependentTemplateStructType *>(ty)) {
+    } else if (auto *dep = dyn_cast<DependentTemplateStructType>(ty)) {
         std::vector<Type *> nonDependents;
         nonDependents.reserve(dep->getArgs().size());
 
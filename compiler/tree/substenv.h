@@ -12,20 +12,35 @@ namespace meddle {
 
 class SubstEnv final {
     SubstEnv *m_Parent;
+
+    /// The mapping of this environment, merged with those of its parents so
+    /// that every parameter is found in a single lookup.
     std::unordered_map<TemplateParamType *, Type *> m_Mapping;
 
+    /// Types already substituted in this environment. An environment is only
+    /// ever used with one context, so results are keyed on the type alone.
+    std::unordered_map<Type *, Type *> m_Cache = {};
+
+    Type *substComposite(Context *ctx, Type *ty);
+
 public:
     SubstEnv(std::unordered_map<TemplateParamType *, Type *> map, 
              SubstEnv *parent = nullptr)
-      : m_Parent(parent), m_Mapping(map) {}
+      : m_Parent(parent), m_Mapping(std::move(map)) {
+        // Parameters mapped by this environment shadow those of its parents.
+        if (parent)
+            m_Mapping.insert(parent->m_Mapping.begin(), parent->m_Mapping.end());
+    }
 
-    const std::unordered_map<TemplateParamType *, Type *> getMapping() const
+    /// \returns The mapping of this environment, including those inherited
+    /// from its parents.
+    const std::unordered_map<TemplateParamType *, Type *> &getMapping() const
     { return m_Mapping; }
 
     SubstEnv *getParent() const { return m_Parent; }
 
-    void setParent(SubstEnv *parent) { m_Parent = parent; }
-
+    /// \returns The type \p ty with every template parameter replaced by its
+    /// mapping in this environment.
     Type *substType(Context *ctx, Type *ty);
 
     Type *substParam(TemplateParamType *param) {
@@ -33,9 +48,6 @@ public:
         if (it != m_Mapping.end())
             return it->second;
 
-        if (m_Parent)
-            return m_Parent->substParam(param);
-
         std::cout << "param " << param->getName() << " " << param->getDecl() << " unfound" << "\n";
         exit(1);
     }
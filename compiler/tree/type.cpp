@@ -2,6 +2,7 @@
 #include "decl.h"
 #include "scope.h"
 #include "type.h"
+#include "unit.h"
 #include "../core/logger.h"
 
 #include <cassert>
@@ -38,35 +39,98 @@ static bool hasSignedness(PrimitiveType::Kind K) {
     }
 }
 
+/// \returns The type that \p T stands for, looking through resolved deferred
+/// types. Composite types are uniqued on these, so that every spelling of a
+/// type shares one instance. A type built over a deferred type that is not
+/// resolved yet is only unique among others built over it, so such types are
+/// interned again once the deferred type is resolved.
+static Type *canonicalize(Type *T) {
+    while (T->isDeferred() && T->asDeferred()->getUnderlying())
+        T = T->asDeferred()->getUnderlying();
+
+    return T;
+}
+
+/// \returns A hash of the identity of \p head followed by each of \p types.
+static size_t hashComponents(const void *head, const std::vector<Type *> &types) {
+    size_t H = std::hash<const void *>()(head);
+    for (auto &T : types)
+        H = H * 31 + std::hash<Type *>()(T);
+
+    return H;
+}
+
 static String getNameForFunctionType(const std::vector<Type *> P, Type *R) {
     String N = "(";
     for (auto &T : P) N += T->getName() + (T == P.back() ? "" : ", ");
     return N + ")" + (R ? " -> " + R->getName() : "");
 }
 
-Type *Type::get(Context *C, const String &name, const Scope *scope, 
+String Type::getQualifiedName() const {
+    switch (m_Kind) {
+    case TypeKind::Deferred: {
+        Type *U = static_cast<const DeferredType *>(this)->getUnderlying();
+        return U ? U->getQualifiedName() : m_Name;
+    }
+    case TypeKind::Array: {
+        auto *AT = static_cast<const ArrayType *>(this);
+        return AT->getElement()->getQualifiedName() + "[" + 
+            std::to_string(AT->getSize()) + "]";
+    }
+    case TypeKind::Pointer:
+        return static_cast<const PointerType *>(this)->getPointee()
+            ->getQualifiedName() + "*";
+    case TypeKind::Function: {
+        auto *FT = static_cast<const FunctionType *>(this);
+        String N = "(";
+        for (unsigned i = 0; i != FT->getNumParams(); ++i)
+            N += (i ? ", " : "") + FT->getParams()[i]->getQualifiedName();
+
+        Type *R = FT->getReturnType();
+        return N + ")" + (R ? " -> " + R->getQualifiedName() : "");
+    }
+    case TypeKind::Enum: {
+        EnumDecl *D = static_cast<const EnumType *>(this)->getDecl();
+        return D->getPUnit()->getID() + "." + m_Name;
+    }
+    case TypeKind::Struct:
+        return static_cast<const StructType *>(this)->getDecl()->getPUnit()
+            ->getID() + "." + m_Name;
+    case TypeKind::TemplateStruct: {
+        auto *spec = static_cast<const TemplateStructType *>(this)
+            ->getSpecializedDecl();
+        return spec->getPUnit()->getID() + "." + spec->getQualifiedName();
+    }
+    default:
+        return m_Name;
+    }
+}
+
+Type *Type::get(Context *C, TypeRef *ref, const Scope *scope, 
                 const Metadata &md) {
     assert(C && "Context cannot be null.");
-    assert(!name.empty() && "Name cannot be empty.");
+    assert(ref && "Type reference cannot be null.");
     assert(scope && "Scope cannot be null.");
 
-    if (NamedDecl *N = scope->lookup(name)) {
-        if (auto *TD = dynamic_cast<TypeDecl *>(N))
+    Ident ident = ref->getSpelling();
+    if (NamedDecl *N = scope->lookup(ident)) {
+        if (auto *TD = dyn_cast<TypeDecl>(N))
             return TD->getDefinedType();
 
-        fatal("named declaration is not a type: " + name, &md);
+        fatal("named declaration is not a type: " + ident.str(), &md);
     }
 
-    auto prim_it = C->m_Primitives.find(name);
+    auto prim_it = C->m_Primitives.find(ident);
     if (prim_it != C->m_Primitives.end())
         return prim_it->second;
 
-    auto unresolved_it = C->m_Deferred.find(name);
+    auto unresolved_it = C->m_Deferred.find(ident);
     if (unresolved_it != C->m_Deferred.end())
         return unresolved_it->second;
 
-    DeferredType *defer = new DeferredType(name, scope, md);
-    return C->m_Deferred[name] = defer;
+    DeferredType *defer = C->create<DeferredType>(ref, scope, md);
+    C->m_DeferredOrder.push_back(defer);
+    return C->m_Deferred[ident] = defer;
 }
 
 ArrayType *DeferredType::asArray() {
@@ -94,66 +158,25 @@ StructType *DeferredType::asStruct() {
 }
 
 PrimitiveType::PrimitiveType(PrimitiveType::Kind K) 
-  : Type(getNameForPrimitiveType(K)), m_Kind(K), m_Signed(hasSignedness(K)) {}
+  : Type(static_cast<TypeKind>(K), getNameForPrimitiveType(K)), 
+    m_Signed(hasSignedness(K)) {}
+
+static_assert(static_cast<TypeKind>(PrimitiveType::Kind::Float64) == 
+              TypeKind::Float64, "Primitive kinds must prefix type kinds.");
 
 PrimitiveType *PrimitiveType::get(Context *C, const Kind &K) {
     assert(C && "Context cannot be null.");
-
-    auto it = C->m_Primitives.find(getNameForPrimitiveType(K));
-    assert(it != C->m_Primitives.end() && "Primitive type not found in context.");
-    return it->second;
-}
-
-bool PrimitiveType::isSInt() const {
-    return m_Kind == Kind::Int8 ||
-           m_Kind == Kind::Int16 ||
-           m_Kind == Kind::Int32 ||
-           m_Kind == Kind::Int64;
-}
-
-bool PrimitiveType::isSInt(unsigned N) const {
-    switch (m_Kind) {
-        case Kind::Int8: return N == 8;
-        case Kind::Int16: return N == 16;
-        case Kind::Int32: return N == 32;
-        case Kind::Int64: return N == 64;
-        default: return false;
-    }
-}
-
-bool PrimitiveType::isUInt() const {
-    return m_Kind == Kind::UInt8 ||
-           m_Kind == Kind::UInt16 ||
-           m_Kind == Kind::UInt32 ||
-           m_Kind == Kind::UInt64;
-}
-
-bool PrimitiveType::isUInt(unsigned N) const {
-    switch (m_Kind) {
-        case Kind::UInt8: return N == 8;
-        case Kind::UInt16: return N == 16;
-        case Kind::UInt32: return N == 32;
-        case Kind::UInt64: return N == 64;
-        default: return false;
-    }
-}
-
-bool PrimitiveType::isFloat(unsigned N) const {
-    switch (m_Kind) {
-        case Kind::Float32: return N == 32;
-        case Kind::Float64: return N == 64;
-        default: return false;
-    }
+    return C->m_PrimitiveTypes[static_cast<unsigned>(K)];
 }
 
 bool PrimitiveType::canCastTo(Type *T) const {
     assert(T && "Type cannot be null.");
 
-    if (auto *prim = dynamic_cast<PrimitiveType *>(T))
+    if (auto *prim = dyn_cast<PrimitiveType>(T))
         return isVoid() == T->isVoid();
-    else if (auto *ptr = dynamic_cast<PointerType *>(T))
+    else if (auto *ptr = dyn_cast<PointerType>(T))
         return isSInt() || isUInt();
-    else if (auto *defer = dynamic_cast<DeferredType *>(T))
+    else if (auto *defer = dyn_cast<DeferredType>(T))
         return canCastTo(defer->getUnderlying());
 
     return false;
@@ -162,10 +185,10 @@ bool PrimitiveType::canCastTo(Type *T) const {
 bool PrimitiveType::canImplCastTo(Type *T) const {
     assert(T && "Type cannot be null.");
 
-    if (auto *defer = dynamic_cast<DeferredType *>(T))
+    if (auto *defer = dyn_cast<DeferredType>(T))
         return canImplCastTo(defer->getUnderlying());
 
-    auto *prim = dynamic_cast<PrimitiveType *>(T);
+    auto *prim = dyn_cast<PrimitiveType>(T);
     if (!prim)
         return false;
 
@@ -179,9 +202,9 @@ bool PrimitiveType::canImplCastTo(Type *T) const {
 bool PrimitiveType::compare(Type *T) const {
     assert(T && "Type cannot be null.");
 
-    if (auto *prim = dynamic_cast<PrimitiveType *>(T))
+    if (auto *prim = dyn_cast<PrimitiveType>(T))
         return m_Kind == prim->m_Kind;
-    else if (auto *defer = dynamic_cast<DeferredType *>(T))
+    else if (auto *defer = dyn_cast<DeferredType>(T))
         return compare(defer->getUnderlying());
 
     return false;
@@ -193,22 +216,22 @@ ArrayType *ArrayType::get(Context *C, Type *Elem, unsigned Sz) {
     assert(Elem->isQualified() && "Element type must be qualified.");
     assert(Sz > 0 && "Size must be greater than zero.");
 
-    String name = Elem->getName() + "[" + std::to_string(Sz) + "]";
-    auto it = C->m_Arrays.find(name);
-    if (it != C->m_Arrays.end())
-        return it->second;
+    Elem = canonicalize(Elem);
+    auto [it, inserted] = C->m_Arrays.try_emplace({ Elem, Sz }, nullptr);
+    if (inserted)
+        it->second = C->create<ArrayType>(Elem, Sz);
 
-    return C->m_Arrays[name] = new ArrayType(Elem, Sz);
+    return it->second;
 }
 
 bool ArrayType::canCastTo(Type *T) const {
     assert(T && "Type cannot be null.");
 
-    if (auto *arr = dynamic_cast<ArrayType *>(T))
+    if (auto *arr = dyn_cast<ArrayType>(T))
         return m_Element->canCastTo(arr->getElement()) && m_Size == arr->m_Size;
-    else if (auto *ptr = dynamic_cast<PointerType *>(T))
+    else if (auto *ptr = dyn_cast<PointerType>(T))
         return m_Element->canCastTo(ptr->getPointee());
-    else if (auto *defer = dynamic_cast<DeferredType *>(T))
+    else if (auto *defer = dyn_cast<DeferredType>(T))
         return canCastTo(defer->getUnderlying());
     else
         return false;
@@ -217,11 +240,11 @@ bool ArrayType::canCastTo(Type *T) const {
 bool ArrayType::canImplCastTo(Type *T) const {
     assert(T && "Type cannot be null.");
 
-    if (auto *arr = dynamic_cast<ArrayType *>(T))
+    if (auto *arr = dyn_cast<ArrayType>(T))
         return m_Element->canImplCastTo(arr->getElement()) && m_Size == arr->m_Size;
-    else if (auto *ptr = dynamic_cast<PointerType *>(T))
+    else if (auto *ptr = dyn_cast<PointerType>(T))
         return m_Element->canImplCastTo(ptr->getPointee());
-    else if (auto *defer = dynamic_cast<DeferredType *>(T))
+    else if (auto *defer = dyn_cast<DeferredType>(T))
         return canImplCastTo(defer->getUnderlying());
     else
         return false;
@@ -230,9 +253,9 @@ bool ArrayType::canImplCastTo(Type *T) const {
 bool ArrayType::compare(Type *T) const {
     assert(T && "Type cannot be null.");
 
-    if (auto *arr = dynamic_cast<ArrayType *>(T))
+    if (auto *arr = dyn_cast<ArrayType>(T))
         return m_Element->compare(arr->m_Element) && m_Size == arr->m_Size;
-    else if (auto *defer = dynamic_cast<DeferredType *>(T))
+    else if (auto *defer = dyn_cast<DeferredType>(T))
         return compare(defer->getUnderlying());
 
     return false;
@@ -243,12 +266,12 @@ PointerType *PointerType::get(Context *C, Type *Pt) {
     assert(Pt && "Pointee type cannot be null.");
     assert(Pt->isQualified() && "Pointee type must be qualified.");
 
-    String name = Pt->getName() + "*";
-    auto it = C->m_Pointers.find(name);
-    if (it != C->m_Pointers.end())
-        return it->second;
+    Pt = canonicalize(Pt);
+    auto [it, inserted] = C->m_Pointers.try_emplace(Pt, nullptr);
+    if (inserted)
+        it->second = C->create<PointerType>(Pt);
 
-    return C->m_Pointers[name] = new PointerType(Pt);
+    return it->second;
 }
 
 bool PointerType::canCastTo(Type *T) const {
@@ -263,30 +286,43 @@ bool PointerType::canImplCastTo(Type *T) const {
 
 bool PointerType::compare(Type *T) const {
     assert(T && "Type cannot be null.");
-    if (auto *ptr = dynamic_cast<PointerType *>(T))
+    if (auto *ptr = dyn_cast<PointerType>(T))
         return m_Pointee->compare(ptr->getPointee());
-    else if (auto *defer = dynamic_cast<DeferredType *>(T))
+    else if (auto *defer = dyn_cast<DeferredType>(T))
         return compare(defer->getUnderlying());
     
     return false;
 }
 
 FunctionType::FunctionType(std::vector<Type *> P, Type *R)
-  : Type(getNameForFunctionType(P, R)), m_Params(P), m_Ret(R) {}
+  : Type(TypeKind::Function, getNameForFunctionType(P, R)), m_Params(P), 
+    m_Ret(R) {}
 
-FunctionType *FunctionType::create(Context *C, std::vector<Type *> Params, 
-                                   Type *Ret) {
+FunctionType *FunctionType::get(Context *C, std::vector<Type *> Params, 
+                                Type *Ret) {
     assert(C && "Context cannot be null.");
     assert(Ret && "Return type cannot be null.");
 
-    FunctionType *FT = new FunctionType(Params, Ret);
-    C->m_FunctionTypes.push_back(FT);
+    Ret = canonicalize(Ret);
+    for (auto &P : Params)
+        P = canonicalize(P);
+
+    size_t hash = hashComponents(Ret, Params);
+    auto [begin, end] = C->m_FunctionTypes.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+        FunctionType *FT = it->second;
+        if (FT->m_Ret == Ret && FT->m_Params == Params)
+            return FT;
+    }
+
+    FunctionType *FT = C->create<FunctionType>(std::move(Params), Ret);
+    C->m_FunctionTypes.emplace(hash, FT);
     return FT;
 }
 
 bool FunctionType::compare(Type *T) const {
     assert(T && "Type cannot be null.");
-    FunctionType *FT = dynamic_cast<FunctionType *>(T);
+    FunctionType *FT = dyn_cast<FunctionType>(T);
     if (!FT)
         return false;
 
@@ -308,12 +344,13 @@ EnumType *EnumType::create(Context *C, const String &name, Type *underlying,
     assert(underlying->isQualified() && "Underlying enum type must be qualified.");
     assert(underlying->isInt() && "Underlying enum type must be an integer.");
 
-    auto enum_it = C->m_Enums.find(name);
+    Ident ident = Ident::get(name);
+    auto enum_it = C->m_Enums.find(ident);
     if (enum_it != C->m_Enums.end())
         fatal("duplicate enum type: " + name, 
             decl ? &decl->getMetadata() : nullptr);
 
-    return C->m_Enums[name] = new EnumType(name, underlying, decl);
+    return C->m_Enums[ident] = C->create<EnumType>(name, underlying, decl);
 }
 
 bool EnumType::canCastTo(Type *T) const {
@@ -344,12 +381,13 @@ StructType *StructType::create(Context *C, const String &name,
     assert(!name.empty() && "Name cannot be empty.");
     assert(!fields.empty() && "Fields cannot be empty.");
 
-    auto struct_it = C->m_Structs.find(name);
+    Ident ident = Ident::get(name);
+    auto struct_it = C->m_Structs.find(ident);
     if (struct_it != C->m_Structs.end())
         fatal("duplicate struct type: " + name, 
             decl ? &decl->getMetadata() : nullptr);
 
-    return C->m_Structs[name] = new StructType(name, fields, decl);
+    return C->m_Structs[ident] = C->create<StructType>(name, fields, decl);
 }
 
 bool StructType::compare(Type *T) const {
@@ -370,7 +408,7 @@ bool TemplateParamType::compare(Type *T) const {
 
     if (this == T)
         return true;
-    else if (auto *other = dynamic_cast<TemplateParamType *>(T))
+    else if (auto *other = dyn_cast<TemplateParamType>(T))
         return getDecl() == other->getDecl();
 
     return false;
@@ -384,7 +422,7 @@ unsigned TemplateParamType::getIndex() const {
 TemplateStructType::TemplateStructType(const String &N, std::vector<Type *> F, 
                                        std::vector<Type *> A, 
                                        StructTemplateSpecializationDecl *D)
-  : StructType(N, F, D), m_Args(A) { if (D) D->setDefinedType(this); }
+  : StructType(N, F, D, TypeKind::TemplateStruct), m_Args(A) { if (D) D->setDefinedType(this); }
 
 TemplateStructType *TemplateStructType::get(Context *ctx, StructDecl *tmpl,
                                             std::vector<Type *> args) {
@@ -395,10 +433,6 @@ TemplateStructType *TemplateStructType::get(Context *ctx, StructDecl *tmpl,
     for (auto &arg : args)
         assert(!arg->isParamDependent() && "Template type arguments cannot be dependent.");
 
-    auto spec_it = ctx->m_StructSpecs.find(tmpl->getName());
-    if (spec_it != ctx->m_StructSpecs.end())
-        return dynamic_cast<TemplateStructType *>(spec_it->second);
-
     return static_cast<TemplateStructType *>(
         tmpl->fetchSpecialization(args)->getDefinedType());
 }
@@ -415,7 +449,7 @@ TemplateStructType *TemplateStructType::create(Context *ctx, const String &name,
     //    fatal("duplicate template specialization: " + decl->getName(), 
     //        &decl->getMetadata());
 
-    return ctx->m_StructSpecs[name] = new TemplateStructType(name, fields, args, decl);
+    return ctx->create<TemplateStructType>(name, fields, args, decl);
 }
 
 bool TemplateStructType::compare(Type *T) const {
@@ -442,7 +476,8 @@ TemplateStructType::getSpecializedDecl() const {
 DependentTemplateStructType::DependentTemplateStructType(const String &name, 
                                                          StructDecl *tmpl, 
                                                          std::vector<Type *> args)
-  : Type(name), m_Tmpl(tmpl), m_Args(args) {}
+  : Type(TypeKind::DependentTemplateStruct, name), m_Tmpl(tmpl), 
+    m_Args(args) {}
 
 DependentTemplateStructType*
 DependentTemplateStructType::get(Context *ctx, StructDecl *tmpl, 
@@ -451,11 +486,23 @@ DependentTemplateStructType::get(Context *ctx, StructDecl *tmpl,
     assert(tmpl && "Template struct declaration cannot be null.");
     assert(!args.empty() && "Template type arguments cannot be empty.");
 
-    auto dep_it = ctx->m_Dependents.find(tmpl->getConcreteName(args));
-    if (dep_it != ctx->m_Dependents.end())
-        return dynamic_cast<DependentTemplateStructType *>(dep_it->second);
+    std::vector<Type *> canonArgs;
+    canonArgs.reserve(args.size());
+    for (auto &arg : args)
+        canonArgs.push_back(canonicalize(arg));
+
+    size_t hash = hashComponents(tmpl, canonArgs);
+    auto [begin, end] = ctx->m_Dependents.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+        DependentTemplateStructType *dep = it->second;
+        if (dep->m_Tmpl == tmpl && dep->m_Args == canonArgs)
+            return dep;
+    }
 
-    return nullptr;
+    auto *dep = ctx->create<DependentTemplateStructType>(
+        tmpl->getConcreteName(canonArgs), tmpl, canonArgs);
+    ctx->m_Dependents.emplace(hash, dep);
+    return dep;
 }
 
 bool DependentTemplateStructType::compare(Type *T) const {
@@ -1,9 +1,12 @@
 #ifndef MEDDLE_TREE_TYPE_H
 #define MEDDLE_TREE_TYPE_H
 
+#include "typeref.h"
+#include "../core/casting.h"
 #include "../core/metadata.h"
 
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -29,63 +32,142 @@ class StructType;
 class TemplateParamType;
 class TemplateStructType;
 
+/// The kind of a type. The primitive kinds come first, in the same order as
+/// PrimitiveType::Kind.
+enum class TypeKind : uint8_t {
+    Void,
+    Bool,
+    Char,
+    Int8,
+    Int16,
+    Int32,
+    Int64,
+    UInt8,
+    UInt16,
+    UInt32,
+    UInt64,
+    Float32,
+    Float64,
+    Array,
+    Pointer,
+    Function,
+    Enum,
+    Struct,
+    TemplateStruct,
+    TemplateParam,
+    DependentTemplateStruct,
+    Deferred,
+};
+
 class Type {
     friend class Context;
+    friend class DeferredType;
+    friend class EnumType;
 
 protected:
     String m_Name;
 
-    Type(const String &N) : m_Name(N) {}
+    /// The kind of this type.
+    TypeKind m_Kind;
+
+    /// The kind of this type, or of the type it was resolved to if this is a
+    /// deferred type. Predicates look through deferred types with this.
+    TypeKind m_ResolvedKind;
+
+    /// The resolved kind of this type, or of its underlying type if this is an
+    /// enum. The integer and floating point predicates test this.
+    TypeKind m_ScalarKind;
+
+    Type(TypeKind K, const String &N) 
+      : m_Name(N), m_Kind(K), m_ResolvedKind(K), m_ScalarKind(K) {}
+
+    /// \returns If \p K is the kind of the \p N-bit type among the 8, 16, 32
+    /// and 64-bit kinds starting at \p First.
+    static bool isSizedKind(TypeKind K, TypeKind First, unsigned N) {
+        switch (N) {
+        case 8: return K == First;
+        case 16: return K == static_cast<TypeKind>(unsigned(First) + 1);
+        case 32: return K == static_cast<TypeKind>(unsigned(First) + 2);
+        case 64: return K == static_cast<TypeKind>(unsigned(First) + 3);
+        default: return false;
+        }
+    }
 
 public:
-    static Type *get(Context *C, const String &name, const Scope *scope, 
+    /// \returns The type that \p ref refers to, or a deferred type if it
+    /// cannot be resolved until the whole unit has been parsed.
+    static Type *get(Context *C, TypeRef *ref, const Scope *scope, 
                      const Metadata &md);
 
     virtual ~Type() = default;
 
     const String &getName() const { return m_Name; }
 
-    virtual bool isArray() const { return false; }
+    /// \returns The name of this type, with each struct and enum in it
+    /// qualified by the unit that declares it, i.e. `usea.pt*`. Unlike the
+    /// name, this tells apart private types of different units.
+    String getQualifiedName() const;
+
+    TypeKind getTypeKind() const { return m_Kind; }
+
+    bool isArray() const { return m_ResolvedKind == TypeKind::Array; }
 
     virtual ArrayType *asArray()
     { assert(false && "Cannot cast type to an array."); }
 
-    virtual bool isPointer() const { return false; }
+    bool isPointer() const { return m_ResolvedKind == TypeKind::Pointer; }
 
     virtual PointerType *asPointer()
     { assert(false && "Cannot cast type to a pointer."); }
 
-    virtual bool isFunction() const { return false; }
+    bool isFunction() const { return m_ResolvedKind == TypeKind::Function; }
 
     virtual FunctionType *asFunction()
     { assert(false && "Cannot cast type to a function."); }
 
-    virtual bool isEnum() const { return false; }
+    bool isEnum() const { return m_ResolvedKind == TypeKind::Enum; }
 
     virtual EnumType *asEnum() 
     { assert(false && "Cannot cast type to an enum."); }
 
-    virtual bool isStruct() const { return false; }
+    bool isStruct() const { 
+        return m_ResolvedKind == TypeKind::Struct || 
+               m_ResolvedKind == TypeKind::TemplateStruct;
+    }
 
     virtual StructType *asStruct() 
     { assert(false && "Cannot cast type to a struct."); }
 
-    virtual bool isDeferred() const { return false; }
+    bool isDeferred() const { return m_Kind == TypeKind::Deferred; }
 
     virtual DeferredType *asDeferred() 
     { assert(false && "Cannot cast type to a deferred type."); }
     
-    virtual bool isSInt() const { return false; }
+    bool isSInt() const { 
+        return m_ScalarKind >= TypeKind::Int8 && 
+               m_ScalarKind <= TypeKind::Int64;
+    }
 
-    virtual bool isSInt(unsigned N) const { return false; }
+    bool isSInt(unsigned N) const 
+    { return isSizedKind(m_ScalarKind, TypeKind::Int8, N); }
 
-    virtual bool isUInt() const { return false; }
+    bool isUInt() const { 
+        return m_ScalarKind >= TypeKind::UInt8 && 
+               m_ScalarKind <= TypeKind::UInt64;
+    }
 
-    virtual bool isUInt(unsigned N) const { return false; }
+    bool isUInt(unsigned N) const 
+    { return isSizedKind(m_ScalarKind, TypeKind::UInt8, N); }
 
-    virtual bool isFloat() const { return false; }
+    bool isFloat() const { 
+        return m_ScalarKind == TypeKind::Float32 || 
+               m_ScalarKind == TypeKind::Float64;
+    }
 
-    virtual bool isFloat(unsigned N) const { return false; }
+    bool isFloat(unsigned N) const { 
+        return (N == 32 && m_ScalarKind == TypeKind::Float32) || 
+               (N == 64 && m_ScalarKind == TypeKind::Float64);
+    }
 
     virtual bool canCastTo(Type *T) const { return false; }
 
@@ -97,56 +179,57 @@ public:
 
     virtual bool isQualified() const { return true; }
 
-    bool isVoid() const { return m_Name == "void"; }
+    bool isVoid() const { return m_ResolvedKind == TypeKind::Void; }
 
-    bool isBool() const { return m_Name == "bool"; }
+    bool isBool() const { return m_ResolvedKind == TypeKind::Bool; }
 
-    bool isChar() const { return m_Name == "char"; }
+    bool isChar() const { return m_ResolvedKind == TypeKind::Char; }
 
-    bool isInt() const { return isSInt() || isUInt(); }
+    bool isInt() const { 
+        return m_ScalarKind >= TypeKind::Int8 && 
+               m_ScalarKind <= TypeKind::UInt64;
+    }
 
     bool isAggregate() const { return isArray() || isStruct(); }
 };
 
 class DeferredType final : public Type {
+    friend class Arena;
     friend class Context;
     friend class Type;
 
-    Type *m_Underlying;
+    Type *m_Underlying = nullptr;
+    TypeRef *m_Ref;
     const Scope *m_Scope;
     Metadata m_Metadata;
 
-    DeferredType(const String &N, const Scope *S, const Metadata &M) 
-      : Type(N), m_Scope(S), m_Metadata(M) {}
+    DeferredType(TypeRef *R, const Scope *S, const Metadata &M) 
+      : Type(TypeKind::Deferred, R->getSpelling().str()), m_Ref(R), 
+        m_Scope(S), m_Metadata(M) {}
 
 public:
-    bool isArray() const override 
-    { return m_Underlying && m_Underlying->isArray(); }
+    static bool classof(const Type *T) 
+    { return T->getTypeKind() == TypeKind::Deferred; }
 
     ArrayType *asArray() override;
 
-    bool isPointer() const override
-    { return m_Underlying && m_Underlying->isPointer(); }
-
     PointerType *asPointer() override;
 
-    bool isEnum() const override
-    { return m_Underlying && m_Underlying->isEnum(); }
-
     EnumType *asEnum() override;
 
-    bool isStruct() const override
-    { return m_Underlying && m_Underlying->isStruct(); }
-
     StructType *asStruct() override;
 
-    bool isDeferred() const override { return true; }
-
     DeferredType *asDeferred() override { return this; }
 
     Type *getUnderlying() const { return m_Underlying; }
 
-    void setUnderlying(Type *T) { m_Underlying = T; }
+    void setUnderlying(Type *T) { 
+        m_Underlying = T;
+        m_ResolvedKind = T ? T->m_ResolvedKind : TypeKind::Deferred;
+        m_ScalarKind = T ? T->m_ScalarKind : TypeKind::Deferred;
+    }
+
+    TypeRef *getRef() const { return m_Ref; }
 
     const Scope *getScope() const { return m_Scope; }
 
@@ -171,6 +254,7 @@ public:
 };
 
 class PrimitiveType final : public Type {
+    friend class Arena;
     friend class Context;
 
 public:
@@ -191,31 +275,20 @@ public:
     };
 
 private:
-    Kind m_Kind;
     bool m_Signed;
 
     PrimitiveType(Kind K);
     
 public:
+    static bool classof(const Type *T) 
+    { return T->getTypeKind() <= TypeKind::Float64; }
+
     static PrimitiveType *get(Context *C, const Kind &K);
 
-    Kind getKind() const { return m_Kind; }
+    Kind getKind() const { return static_cast<Kind>(m_Kind); }
 
     bool isSigned() const { return m_Signed; }
 
-    bool isSInt() const override;
-
-    bool isSInt(unsigned N) const override;
-
-    bool isUInt() const override;
-
-    bool isUInt(unsigned N) const override;
-
-    bool isFloat() const override
-    { return m_Kind == Kind::Float32 || m_Kind == Kind::Float64; }
-
-    bool isFloat(unsigned N) const override;
-
     bool canCastTo(Type *T) const override;
     
     bool canImplCastTo(Type *T) const override;
@@ -224,19 +297,21 @@ public:
 };
 
 class ArrayType final : public Type {
+    friend class Arena;
     friend class Context;
 
     Type *m_Element;
     unsigned m_Size;
 
     ArrayType(Type *E, unsigned S)
-      : Type(E->getName() + "[" + std::to_string(S) + "]"), m_Element(E), 
-        m_Size(S) {}
+      : Type(TypeKind::Array, E->getName() + "[" + std::to_string(S) + "]"), 
+        m_Element(E), m_Size(S) {}
 
 public:
-    static ArrayType *get(Context *C, Type *Elem, unsigned Sz);
+    static bool classof(const Type *T) 
+    { return T->getTypeKind() == TypeKind::Array; }
 
-    bool isArray() const override { return true; }
+    static ArrayType *get(Context *C, Type *Elem, unsigned Sz);
 
     ArrayType *asArray() override { return this; }
 
@@ -255,16 +330,19 @@ public:
 };
 
 class PointerType final : public Type {
+    friend class Arena;
     friend class Context;
 
     Type *m_Pointee;
 
-    PointerType(Type *P) : Type(P->getName() + "*"), m_Pointee(P) {}
+    PointerType(Type *P) 
+      : Type(TypeKind::Pointer, P->getName() + "*"), m_Pointee(P) {}
 
 public:
-    static PointerType *get(Context *C, Type *Pt);
+    static bool classof(const Type *T) 
+    { return T->getTypeKind() == TypeKind::Pointer; }
 
-    bool isPointer() const override { return true; }
+    static PointerType *get(Context *C, Type *Pt);
 
     PointerType *asPointer() override { return this; }
 
@@ -281,6 +359,7 @@ public:
 };
 
 class FunctionType final : public Type {
+    friend class Arena;
     friend class Context;
     
     std::vector<Type *> m_Params;
@@ -289,9 +368,11 @@ class FunctionType final : public Type {
     FunctionType(std::vector<Type *> P, Type *R);
 
 public:
-    static FunctionType *create(Context *C, std::vector<Type *> Params, Type *Ret);
+    static bool classof(const Type *T) 
+    { return T->getTypeKind() == TypeKind::Function; }
 
-    bool isFunction() const override { return true; }
+    /// \returns The unique function type returning \p Ret from \p Params.
+    static FunctionType *get(Context *C, std::vector<Type *> Params, Type *Ret);
 
     FunctionType *asFunction() override { return this; }
     
@@ -304,43 +385,31 @@ public:
 
     unsigned getNumParams() const { return m_Params.size(); }
 
-    void setParamType(Type *T, unsigned i) {
-        assert(i <= m_Params.size() && "Index out of range.");
-        m_Params[i] = T;
-    }
-
     Type *getReturnType() const { return m_Ret; }
 
-    void setReturnType(Type *T) { m_Ret = T; }
-
     bool compare(Type *T) const override;
 };
 
 class EnumType final : public Type {
+    friend class Arena;
     friend class Context;
 
     Type *m_Underlying;
     EnumDecl *m_Decl;
 
     EnumType(const String &N, Type *U, EnumDecl *E = nullptr)
-      : Type(N), m_Underlying(U), m_Decl(E) {}
+      : Type(TypeKind::Enum, N), m_Underlying(U), m_Decl(E) 
+    { m_ScalarKind = U->m_ScalarKind; }
 
 public:
+    static bool classof(const Type *T) 
+    { return T->getTypeKind() == TypeKind::Enum; }
+
     static EnumType *create(Context *C, const String &name, Type *underlying, 
                             EnumDecl *decl = nullptr);
 
-    bool isEnum() const override { return true; }
-
     EnumType *asEnum() override { return this; }
 
-    bool isUInt() const override { return m_Underlying->isUInt(); }
-
-    bool isUInt(unsigned N) const override { return m_Underlying->isUInt(N); }
-
-    bool isSInt() const override { return m_Underlying->isSInt(); }
-
-    bool isSInt(unsigned N) const override { return m_Underlying->isSInt(N); }
-
     bool canCastTo(Type *T) const override;
 
     bool canImplCastTo(Type *T) const override;
@@ -355,22 +424,27 @@ public:
 };
 
 class StructType : public Type {
+    friend class Arena;
     friend class Context;
 
 protected:
     std::vector<Type *> m_Fields;
     StructDecl *m_Decl;
 
-    StructType(const String &N, std::vector<Type *> F, StructDecl *D = nullptr) 
-        : Type(N), m_Fields(F), m_Decl(D) {}
+    StructType(const String &N, std::vector<Type *> F, StructDecl *D = nullptr,
+               TypeKind K = TypeKind::Struct) 
+      : Type(K, N), m_Fields(F), m_Decl(D) {}
 
 public:
+    static bool classof(const Type *T) {
+        return T->getTypeKind() == TypeKind::Struct || 
+               T->getTypeKind() == TypeKind::TemplateStruct;
+    }
+
     static StructType *create(Context *C, const String &name, 
                               std::vector<Type *> fields, 
                               StructDecl *decl = nullptr);
 
-    bool isStruct() const override { return true; }
-
     StructType *asStruct() override { return this; }
 
     bool compare(Type *T) const override;
@@ -398,13 +472,17 @@ public:
 };
 
 class TemplateParamType final : public Type {
+    friend class Arena;
     friend class Context;
 
     TemplateParamDecl *m_Decl;
 
 public:
+    static bool classof(const Type *T) 
+    { return T->getTypeKind() == TypeKind::TemplateParam; }
+
     TemplateParamType(const String &N, TemplateParamDecl *D)
-      : Type(N), m_Decl(D) {}
+      : Type(TypeKind::TemplateParam, N), m_Decl(D) {}
 
     bool compare(Type *T) const override;
 
@@ -420,6 +498,7 @@ public:
 /// Represents instantiated structure types not dependent on a parameterized
 /// type, i.e. `Box<i32, i64>`.
 class TemplateStructType final : public StructType {
+    friend class Arena;
     friend class Context;
 
     std::vector<Type *> m_Args;
@@ -429,6 +508,9 @@ class TemplateStructType final : public StructType {
                        StructTemplateSpecializationDecl *decl = nullptr);
 
 public:
+    static bool classof(const Type *T) 
+    { return T->getTypeKind() == TypeKind::TemplateStruct; }
+
     static TemplateStructType *get(Context *ctx, StructDecl *tmpl,
                                    std::vector<Type *> args);
     static TemplateStructType *create(Context *ctx, const String &name, 
@@ -449,6 +531,7 @@ public:
 /// on a parameterized type, i.e. `Box<T>` in a context where `T` is a
 /// parameter type.
 class DependentTemplateStructType final : public Type {
+    friend class Arena;
     friend class Context;
 
     StructDecl *m_Tmpl;
@@ -458,6 +541,11 @@ class DependentTemplateStructType final : public Type {
                                 std::vector<Type *> args);
 
 public:
+    static bool classof(const Type *T) {
+        return T->getTypeKind() == 
+            TypeKind::DependentTemplateStruct;
+    }
+
     static DependentTemplateStructType *get(Context *ctx, StructDecl *tmpl, 
                                             const std::vector<Type *> &args);
 
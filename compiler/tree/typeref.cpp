@@ -0,0 +1,50 @@
+#include "context.h"
+#include "typeref.h"
+
+#include <cassert>
+
+using namespace meddle;
+
+TypeRef *TypeRef::createNamed(Context *C, Ident name) {
+    assert(C && "Context cannot be null.");
+    assert(!name.empty() && "Name cannot be empty.");
+
+    TypeRef *ref = C->create<TypeRef>(Kind::Named, name, name);
+    return ref;
+}
+
+TypeRef *TypeRef::createPointer(Context *C, TypeRef *pointee) {
+    assert(C && "Context cannot be null.");
+    assert(pointee && "Pointee cannot be null.");
+
+    TypeRef *ref = C->create<TypeRef>(Kind::Pointer, Ident(), 
+        Ident::get(pointee->m_Spelling.str() + "*"));
+    ref->m_Base = pointee;
+    return ref;
+}
+
+TypeRef *TypeRef::createArray(Context *C, TypeRef *element, unsigned size) {
+    assert(C && "Context cannot be null.");
+    assert(element && "Element cannot be null.");
+
+    TypeRef *ref = C->create<TypeRef>(Kind::Array, Ident(), Ident::get(
+        element->m_Spelling.str() + "[" + std::to_string(size) + "]"));
+    ref->m_Base = element;
+    ref->m_Size = size;
+    return ref;
+}
+
+TypeRef *TypeRef::createTemplate(Context *C, Ident name, 
+                                 std::vector<TypeRef *> args) {
+    assert(C && "Context cannot be null.");
+    assert(!name.empty() && "Name cannot be empty.");
+
+    String spelling = name.str() + "<";
+    for (unsigned i = 0, n = args.size(); i != n; ++i)
+        spelling += args[i]->m_Spelling.str() + (i + 1 == n ? "" : ", ");
+
+    TypeRef *ref = C->create<TypeRef>(Kind::Template, name, 
+        Ident::get(spelling + ">"));
+    ref->m_Args = std::move(args);
+    return ref;
+}
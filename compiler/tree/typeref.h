@@ -0,0 +1,81 @@
+#ifndef MEDDLE_TYPEREF_H
+#define MEDDLE_TYPEREF_H
+
+#include "../core/ident.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace meddle {
+
+class Context;
+class Type;
+
+/// A reference to a type as it is written in source, i.e. `box<i32>*[4]`.
+///
+/// The parser builds these instead of spelling types out as strings, so that
+/// a context resolves a type by walking its structure once. Each reference
+/// remembers the type it resolved to, so resolving it again, or resolving a
+/// reference which encloses it, does not repeat any work.
+///
+/// References are owned by the context of the unit they were parsed in.
+class TypeRef final {
+    friend class Arena;
+    friend class Context;
+
+public:
+    enum class Kind : uint8_t {
+        Named,
+        Pointer,
+        Array,
+        Template,
+    };
+
+private:
+    Kind m_Kind;
+
+    /// The name of a named type or template, which may be qualified by a use,
+    /// i.e. `Boxes::box`.
+    Ident m_Name;
+
+    /// The full spelling of this reference, i.e. `box<i32>*`.
+    Ident m_Spelling;
+
+    /// The pointee or element of a pointer or array reference.
+    TypeRef *m_Base = nullptr;
+    unsigned m_Size = 0;
+    std::vector<TypeRef *> m_Args;
+
+    Type *m_Resolved = nullptr;
+
+    TypeRef(Kind K, Ident N, Ident S) : m_Kind(K), m_Name(N), m_Spelling(S) {}
+
+public:
+    static TypeRef *createNamed(Context *C, Ident name);
+
+    static TypeRef *createPointer(Context *C, TypeRef *pointee);
+
+    static TypeRef *createArray(Context *C, TypeRef *element, unsigned size);
+
+    static TypeRef *createTemplate(Context *C, Ident name, 
+                                   std::vector<TypeRef *> args);
+
+    Kind getKind() const { return m_Kind; }
+
+    Ident getName() const { return m_Name; }
+
+    Ident getSpelling() const { return m_Spelling; }
+
+    TypeRef *getBase() const { return m_Base; }
+
+    unsigned getSize() const { return m_Size; }
+
+    const std::vector<TypeRef *> &getArgs() const { return m_Args; }
+
+    /// \returns The type this reference has resolved to, if it has yet.
+    Type *getResolved() const { return m_Resolved; }
+};
+
+} // namespace meddle
+
+#endif // MEDDLE_TYPEREF_H
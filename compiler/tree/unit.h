@@ -6,6 +6,9 @@
 #include "nameres.h"
 #include "scope.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace meddle {
 
 class TranslationUnit final {
@@ -15,31 +18,27 @@ class TranslationUnit final {
     friend class UnitManager;
     
     String m_ID;
-    File m_File;
+    const File &m_File;
     Context m_Context;
     Scope *m_Scope;
     std::vector<Decl *> m_Decls = {};
     std::vector<UseDecl *> m_Uses = {};
     std::vector<NamedDecl *> m_Imports = {};
     std::vector<NamedDecl *> m_Exports = {};
+    std::unordered_map<Ident, NamedDecl *> m_ExportTable = {};
 
-public:
-    TranslationUnit(const String &ID, const File &F) 
-      : m_ID(ID), m_File(F), m_Context(this), m_Scope(new Scope) {}
-
-    ~TranslationUnit() {
-        for (auto &U : m_Uses)
-            delete U;
-        m_Uses.clear();
+    /// Guards the template specializations of this unit, and the types they
+    /// create in its context, as importing units may request them at once.
+    std::recursive_mutex m_SpecLock;
 
-        for (auto &D : m_Decls)
-            delete D;
-        m_Decls.clear();
+    /// If this unit was loaded from a module interface instead of parsed from
+    /// source, in which case it is analyzed, but never lowered.
+    bool m_Interface = false;
 
-        m_Exports.clear();
-
-        delete m_Scope;
-    }
+public:
+    TranslationUnit(const String &ID, const File &F) 
+      : m_ID(ID), m_File(F), m_Context(this), 
+        m_Scope(m_Context.create<Scope>()) {}
 
     void accept(Visitor *V) { V->visit(this); }
 
@@ -51,6 +50,12 @@ public:
 
     Scope *getScope() const { return m_Scope; }
 
+    std::recursive_mutex &getSpecializationLock() { return m_SpecLock; }
+
+    bool isInterface() const { return m_Interface; }
+
+    void setInterface() { m_Interface = true; }
+
     const std::vector<Decl *> &getDecls() const { return m_Decls; }
 
     const std::vector<UseDecl *> &getUses() const { return m_Uses; }
@@ -67,7 +72,16 @@ public:
 
     void addImport(NamedDecl *D) { m_Imports.push_back(D); }
 
-    void addExport(NamedDecl *D) { m_Exports.push_back(D); }
+    void addExport(NamedDecl *D) { 
+        m_Exports.push_back(D); 
+        m_ExportTable.emplace(D->getIdent(), D);
+    }
+
+    /// \returns The first exported declaration named \p name, if it exists.
+    NamedDecl *getExport(Ident name) const {
+        auto it = m_ExportTable.find(name);
+        return it != m_ExportTable.end() ? it->second : nullptr;
+    }
 
     const std::vector<NamedDecl *> &getImports() const { return m_Imports; }
 
@@ -1,5 +1,11 @@
+#include "interface.h"
 #include "unitman.h"
+#include "../core/threadpool.h"
+
+#include <atomic>
 #include <fstream>
+#include <functional>
+#include <sstream>
 
 using namespace meddle;
 
@@ -7,31 +13,19 @@ void UnitManager::resolveImports(UseDecl *use, TranslationUnit *parent) {
     assert(use && "Use cannot be null.");
     assert(use->getUnit() && "Use must have its target resolved.");
 
-    std::vector<NamedDecl *> Imports;
-    if (use->getSymbols().empty()) {
-        // If the use is not named, i.e. `use "..."`, then all named symbols
-        // exported by the unit are to be added.
-        Imports = use->getUnit()->getExports();
-    } else {
+    TranslationUnit *unit = use->getUnit();
+    std::vector<NamedDecl *> Listed;
+    if (!use->getSymbols().empty()) {
         // If the use specifies only certain symbols, i.e.
         // `use { Foo, Bar } = "..."`, then only those symbols are to be 
         // added. They must be exported by the unit and actually exist.
-        std::vector<NamedDecl *> exports = use->getUnit()->getExports();
-        Imports.reserve(use->getSymbols().size());
+        Listed.reserve(use->getSymbols().size());
         for (auto &name : use->getSymbols()) {
-            NamedDecl *target = nullptr;
-
-            for (auto &exp : exports) {
-                if (exp->getName() == name) {
-                    target = exp;
-                    break;
-                }
-            }
-
+            NamedDecl *target = unit->getExport(Ident::find(name));
             if (!target) {
                 fatal(
                     "name '" + name + "' does not exist in: '" + 
-                    use->getUnit()->getFile().path + "'", &use->getMetadata()
+                    unit->getFile().path + "'", &use->getMetadata()
                 );
             }
 
@@ -40,10 +34,15 @@ void UnitManager::resolveImports(UseDecl *use, TranslationUnit *parent) {
                     &use->getMetadata());
             }
 
-            Imports.push_back(target);
+            Listed.push_back(target);
         }
     }
 
+    // If the use is not named, i.e. `use "..."`, then all named symbols
+    // exported by the unit are to be added.
+    const std::vector<NamedDecl *> &Imports = 
+        use->getSymbols().empty() ? unit->getExports() : Listed;
+
     Scope *scope = parent->getScope();
     Context *ctx = parent->getContext();
     for (auto &Import : Imports) {
@@ -52,93 +51,207 @@ void UnitManager::resolveImports(UseDecl *use, TranslationUnit *parent) {
         if (!use->isNamed())
             scope->addDecl(Import);
 
-        if (TypeDecl *TD = dynamic_cast<TypeDecl *>(Import))
+        if (TypeDecl *TD = dyn_cast<TypeDecl>(Import))
             ctx->importType(TD->getDefinedType(), 
                 (use->isNamed() ? use->getName() + "::" + TD->getName() : ""));
     }
 }
 
-bool UnitManager::resolveUsesUtil(TranslationUnit *U, 
-                                  std::vector<TranslationUnit *> V, 
-                                  std::vector<TranslationUnit *> S) {
-    if (std::find(V.begin(), V.end(), U) != V.end()) {
-        // If this package has been visited before: no cycle.
-        if (!S.empty())
-            S.pop_back();
+TranslationUnit *UnitManager::resolveUse(UseDecl *use, const String &dir) {
+    String usePath = dir + '/' + use->getPath();
 
-        return false;
-    }
+    // Check if the use path ends with .mdl, and if it doesn't, add it.
+    if (usePath.size() < 4 || usePath.substr(usePath.size() - 4) != ".mdl")
+        usePath += ".mdl";
 
-    // Mark the current package as having been visited.
-    V.push_back(U);
-    S.push_back(U);
-
-    for (auto &Use : U->getUses()) {
-        // Resolve the use dependency.
-        TranslationUnit *dep = resolveUse(Use, U->getFile().path);
-        if (!dep) {
-            fatal(
-                "unresolved unit: " + Use->getPath(), 
-                &Use->getMetadata()
-            );
-        }
+    // Units are known by their lexically normal absolute path, so most uses
+    // resolve without touching the filesystem. Anything else, i.e. a path
+    // through a symlink, is canonicalized once and then remembered.
+    auto it = m_Resolved.find(usePath);
+    if (it != m_Resolved.end())
+        return it->second;
 
-        Use->setUnit(dep);
-
-        if (std::find(V.begin(), V.end(), dep) != V.end()
-        && resolveUsesUtil(dep, V, S)) {
-            fatal(
-                "cyclical use in file '" + U->getFile().path
-                + "', using: '" + dep->getFile().path + "'", 
-                &Use->getMetadata()
-            );
-        } else if (std::find(S.begin(), S.end(), dep) != S.end()) {
-            return true;
-        }
+    String normal = Path(usePath).lexically_normal().string();
+    it = m_Resolved.find(normal);
+    if (it != m_Resolved.end())
+        return m_Resolved[usePath] = it->second;
+
+    std::error_code EC;
+    Path absol = canonical(normal, EC);
 
-        resolveImports(Use, U);
+    TranslationUnit *unit = nullptr;
+    if (!EC) {
+        auto found = m_Units.find(absol.string());
+        if (found != m_Units.end())
+            unit = found->second;
     }
 
-    return false;
-}
+    // A unit which is not an input may still have the module interface that
+    // an earlier compilation wrote for it, so long as it is not out of date.
+    if (!unit) {
+        Path interface = canonical(getInterfacePath(normal), EC);
+        if (!EC) {
+            TranslationUnit *&loaded = m_Units[interface.string()];
+            if (!loaded)
+                loaded = loadInterface(interface.string(), normal);
 
-TranslationUnit *UnitManager::resolveUse(UseDecl *use, 
-                                         const String &importer) const {
-    String usePath = use->getPath();
+            unit = loaded;
+        }
+    }
 
-    // Check if the use path ends with .mdl, and if it doesn't, add it.
-    if (usePath.size() < 4 || usePath.substr(usePath.size() - 4) != ".mdl")
-        usePath += ".mdl";
+    m_Resolved[normal] = unit;
+    return m_Resolved[usePath] = unit;
+}
 
-    Path importerPath(importer);
-    Path resolved = importerPath.parent_path() / usePath;
+void UnitManager::sortUses(const std::vector<TranslationUnit *> &nodes,
+                           const std::vector<std::vector<unsigned>> &edges) {
+    // Tarjan's algorithm, run iteratively so that long use chains cannot
+    // overflow the stack. Components are completed in reverse topological
+    // order, which puts every unit after the units it uses.
+    constexpr unsigned None = ~0u;
+    std::vector<unsigned> index(nodes.size(), None);
+    std::vector<unsigned> low(nodes.size(), 0);
+    std::vector<bool> onStack(nodes.size(), false);
+    std::vector<unsigned> stack;
+    std::vector<std::pair<unsigned, unsigned>> frames;
+    std::vector<unsigned> order;
+    order.reserve(nodes.size());
+    unsigned next = 0;
+
+    auto visit = [&](unsigned v) {
+        index[v] = low[v] = next++;
+        stack.push_back(v);
+        onStack[v] = true;
+        frames.push_back({ v, 0 });
+    };
+
+    for (unsigned root = 0; root != nodes.size(); ++root) {
+        if (index[root] != None)
+            continue;
+
+        visit(root);
+        while (!frames.empty()) {
+            unsigned v = frames.back().first;
+            unsigned e = frames.back().second++;
+            if (e != edges[v].size()) {
+                unsigned w = edges[v][e];
+                if (index[w] == None)
+                    visit(w);
+                else if (onStack[w])
+                    low[v] = std::min(low[v], index[w]);
+
+                continue;
+            }
 
-    std::error_code EC;
-    Path absol = canonical(resolved, EC);
+            frames.pop_back();
+            if (!frames.empty()) {
+                unsigned parent = frames.back().first;
+                low[parent] = std::min(low[parent], low[v]);
+            }
 
-    if (EC)
-        return nullptr;
-    
-    auto key = absol.string();
+            if (low[v] != index[v])
+                continue;
+
+            if (stack.back() != v) {
+                // The root of a cyclic component uses some other unit of it,
+                // and the rest of the component is still above it.
+                for (auto &Use : nodes[v]->getUses()) {
+                    unsigned w = m_Indices.at(Use->getUnit());
+                    if (w != v && onStack[w]) {
+                        fatal(
+                            "cyclical use in file '" + nodes[v]->getFile().path
+                            + "', using: '" + Use->getUnit()->getFile().path 
+                            + "'", &Use->getMetadata()
+                        );
+                    }
+                }
+            }
 
-    if (m_Units.count(key))
-        return m_Units.at(key);
+            stack.pop_back();
+            onStack[v] = false;
+            order.push_back(v);
+        }
+    }
 
-    return nullptr;
+    // Renumber the graph by position in the use order.
+    std::vector<unsigned> position(nodes.size());
+    for (unsigned i = 0; i != order.size(); ++i)
+        position[order[i]] = i;
+
+    m_Order.resize(nodes.size());
+    m_Edges.assign(nodes.size(), {});
+    for (unsigned i = 0; i != nodes.size(); ++i) {
+        unsigned pos = position[i];
+        m_Order[pos] = nodes[i];
+        m_Indices[nodes[i]] = pos;
+        for (auto &dep : edges[i])
+            m_Edges[pos].push_back(position[dep]);
+    }
 }
 
 void UnitManager::sanitate() {
-    for (auto &[ Path, Unit ] : m_Units)
+    // Sanitizing a unit may specialize templates of the units it uses, which
+    // needs their own types to be sanitized first.
+    for (auto &Unit : m_Order)
         Unit->getContext()->sanitate();
 }
 
 void UnitManager::resolveUses() {
-    std::vector<TranslationUnit *> Visited;
-    std::vector<TranslationUnit *> Stack;
+    std::vector<TranslationUnit *> nodes = getUnits();
+    m_Indices.clear();
+    m_Indices.reserve(nodes.size());
+    for (unsigned i = 0; i != nodes.size(); ++i)
+        m_Indices[nodes[i]] = i;
+
+    // Resolve the target of every use, and record the distinct units that
+    // each unit uses as the edges of the graph. Interfaces loaded on the way
+    // join the graph, so that their own uses are resolved in turn.
+    std::vector<std::vector<unsigned>> edges(nodes.size());
+    std::vector<unsigned> seen(nodes.size(), ~0u);
+    Path cwd = current_path();
+    for (unsigned i = 0; i != nodes.size(); ++i) {
+        TranslationUnit *U = nodes[i];
+        String dir = (cwd / U->getFile().path).lexically_normal()
+            .parent_path().string();
+        for (auto &Use : U->getUses()) {
+            TranslationUnit *dep = resolveUse(Use, dir);
+            if (!dep) {
+                fatal(
+                    "unresolved unit: " + Use->getPath(), 
+                    &Use->getMetadata()
+                );
+            }
 
-    for (auto &[ Path, Unit ] : m_Units)
-        if (std::find(Visited.begin(), Visited.end(), Unit) == Visited.end())
-            resolveUsesUtil(Unit, Visited, Stack);
+            if (dep == U) {
+                fatal(
+                    "cyclical use in file '" + U->getFile().path
+                    + "', using: '" + dep->getFile().path + "'", 
+                    &Use->getMetadata()
+                );
+            }
+
+            Use->setUnit(dep);
+
+            auto [ it, added ] = m_Indices.emplace(dep, nodes.size());
+            if (added) {
+                nodes.push_back(dep);
+                edges.emplace_back();
+                seen.push_back(~0u);
+            }
+
+            unsigned idx = it->second;
+            if (seen[idx] != i) {
+                seen[idx] = i;
+                edges[i].push_back(idx);
+            }
+        }
+    }
+
+    sortUses(nodes, edges);
+
+    for (auto &Unit : m_Order)
+        for (auto &Use : Unit->getUses())
+            resolveImports(Use, Unit);
 }
 
 void UnitManager::addUnit(TranslationUnit *U) {
@@ -152,6 +265,7 @@ void UnitManager::addUnit(TranslationUnit *U) {
         fatal("multiple files with same path: " + key, nullptr);
 
     m_Units[key] = U;
+    m_Resolved[absolute(U->getFile().path).lexically_normal().string()] = U;
 }
 
 void UnitManager::addVirtUnit(TranslationUnit *U) {
@@ -172,21 +286,94 @@ std::vector<TranslationUnit *> UnitManager::getUnits() const {
     return units;
 }
 
+void UnitManager::analyze(const Options &opts) {
+    // Count the units that each unit waits on, and record the reverse edges
+    // so that a finished unit can release the units that use it.
+    std::vector<std::atomic<unsigned>> waiting(m_Order.size());
+    std::vector<std::vector<unsigned>> dependents(m_Order.size());
+    for (unsigned i = 0; i != m_Order.size(); ++i) {
+        waiting[i] = m_Edges[i].size();
+        for (auto &dep : m_Edges[i])
+            dependents[dep].push_back(i);
+    }
+
+    ThreadPool pool(opts.Jobs);
+    std::function<void(unsigned)> run = [&](unsigned i) {
+        m_Order[i]->getContext()->sanitate();
+        NameResolution NR = NameResolution(opts, m_Order[i]);
+        Sema sema = Sema(opts, m_Order[i]);
+
+        for (auto &dep : dependents[i])
+            if (--waiting[dep] == 0)
+                pool.submit([&run, dep] { run(dep); });
+    };
+
+    // The use graph is acyclic, so starting from the units which use nothing
+    // eventually reaches every unit.
+    for (unsigned i = 0; i != m_Order.size(); ++i)
+        if (waiting[i] == 0)
+            pool.submit([&run, i] { run(i); });
+
+    pool.wait();
+}
+
+void UnitManager::sortSpecializations() {
+    for (auto &Unit : m_Order) {
+        for (auto &D : Unit->getDecls()) {
+            if (auto *F = dyn_cast<FunctionDecl>(D); F && F->isTemplate())
+                F->sortSpecializations();
+            else if (auto *S = dyn_cast<StructDecl>(D); S && S->isTemplate())
+                S->sortSpecializations();
+        }
+    }
+}
+
+void UnitManager::emitInterfaces() {
+    for (auto &Unit : m_Order) {
+        if (Unit->isInterface())
+            continue;
+
+        // Interfaces are built in memory first, so that a unit which has no
+        // interface leaves no partial file behind.
+        std::ostringstream OS;
+        if (!writeInterface(Unit, OS))
+            continue;
+
+        String path = getInterfacePath(Unit->getFile().path);
+        std::ofstream file = std::ofstream(path, std::ios::binary);
+        if (!file.is_open())
+            fatal("unable to open file: " + path, nullptr);
+
+        file << OS.str();
+    }
+}
+
 void UnitManager::drive(const Options &opts) {
     resolveUses();
-    
-    for (auto &[ Path, Unit ] : m_Units)
-        Unit->getContext()->sanitate();
 
-    for (auto &[ Path, Unit ] : m_Units)
-        NameResolution NR = NameResolution(opts, Unit);
+    if (opts.Jobs != 1) {
+        analyze(opts);
+    } else {
+        sanitate();
 
-    for (auto &[ Path, Unit ] : m_Units)
-        Sema sema = Sema(opts, Unit);
+        for (auto &[ Path, Unit ] : m_Units)
+            NameResolution NR = NameResolution(opts, Unit);
+
+        for (auto &[ Path, Unit ] : m_Units)
+            Sema sema = Sema(opts, Unit);
+    }
+
+    sortSpecializations();
+
+    if (opts.EmitInterfaces)
+        emitInterfaces();
 }
 
 void UnitManager::printc(const Options &opts) {
     for (auto &[ Path, Unit ] : m_Units) {
+        if (Unit->isInterface())
+            continue;
+
         std::ofstream file = std::ofstream(Unit->getFile().filename + ".ast");
         if (!file.is_open())
             fatal("unable to open file: " + Unit->getFile().filename, nullptr);
@@ -20,17 +20,44 @@ namespace meddle {
 class UnitManager final {
     std::unordered_map<String, TranslationUnit *> m_Units;
 
+    /// The target of each absolute use path that has been resolved so far, or
+    /// null if the path is not a unit.
+    std::unordered_map<String, TranslationUnit *> m_Resolved;
+
+    /// Every unit, with each unit after all of the units it uses, and the
+    /// distinct units that each one uses by position in m_Order.
+    std::vector<TranslationUnit *> m_Order;
+    std::vector<std::vector<unsigned>> m_Edges;
+    std::unordered_map<TranslationUnit *, unsigned> m_Indices;
+
     void resolveImports(UseDecl *use, TranslationUnit *parent);
 
-    bool resolveUsesUtil(TranslationUnit *U, std::vector<TranslationUnit *> V, 
-                         std::vector<TranslationUnit *> S);
+    /// \returns The unit that \p use refers to from a unit in the absolute
+    /// directory \p dir, or null if there is no such unit.
+    TranslationUnit *resolveUse(UseDecl *use, const String &dir);
 
-    TranslationUnit *resolveUse(UseDecl *use, const String &importer) const;
+    /// Order the units of the use graph given by \p edges over \p nodes, and
+    /// fail on any cyclical use.
+    void sortUses(const std::vector<TranslationUnit *> &nodes,
+                  const std::vector<std::vector<unsigned>> &edges);
 
     void sanitate();
 
     void resolveUses();
 
+    /// Sanitize, name resolve and analyze every unit with a pool of
+    /// \p opts.Jobs workers. A unit is scheduled as soon as every unit it
+    /// uses has been analyzed.
+    void analyze(const Options &opts);
+
+    /// Order the specializations of every template, which units analyzed in
+    /// parallel may have created in any order, so that the output of the
+    /// compilation does not depend on scheduling.
+    void sortSpecializations();
+
+    /// Write the module interface of every unit that is not one already.
+    void emitInterfaces();
+
 public:
     UnitManager() = default;
 
@@ -45,6 +72,11 @@ public:
 
     std::vector<TranslationUnit *> getUnits() const;
 
+    /// \returns Every unit, with each unit after all of the units it uses.
+    /// This is only available once the units have been driven.
+    const std::vector<TranslationUnit *> &getUseOrder() const 
+    { return m_Order; }
+
     void drive(const Options &opts);
 
     void printc(const Options &opts);
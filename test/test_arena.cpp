@@ -0,0 +1,86 @@
+#include "../compiler/core/arena.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace meddle {
+
+namespace test {
+
+class ArenaTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+struct Counted final {
+    unsigned *counter;
+    std::vector<std::string> names;
+
+    Counted(unsigned *C) : counter(C), names({ "a", "b", "c" }) {}
+
+    ~Counted() { ++*counter; }
+};
+
+struct Big final {
+    char bytes[80 * 1024];
+    unsigned *counter;
+
+    Big(unsigned *C) : counter(C) {}
+
+    ~Big() { ++*counter; }
+};
+
+TEST_F(ArenaTest, Reset_Runs_Destructors) {
+    unsigned destroyed = 0;
+    Arena arena;
+
+    std::vector<Counted *> objects;
+    for (unsigned i = 0; i != 10000; ++i)
+        objects.push_back(arena.create<Counted>(&destroyed));
+
+    EXPECT_EQ(arena.getNumObjects(), 10000);
+    EXPECT_GT(arena.getNumSlabs(), 1);
+    EXPECT_EQ(objects.back()->names.size(), 3);
+    EXPECT_EQ(destroyed, 0);
+
+    arena.reset();
+    EXPECT_EQ(destroyed, 10000);
+    EXPECT_EQ(arena.getNumObjects(), 0);
+    EXPECT_EQ(arena.getNumSlabs(), 0);
+    EXPECT_EQ(arena.getBytesReserved(), 0);
+}
+
+TEST_F(ArenaTest, Oversized_Objects) {
+    unsigned destroyed = 0;
+    {
+        Arena arena;
+        Counted *first = arena.create<Counted>(&destroyed);
+        Big *big = arena.create<Big>(&destroyed);
+        Counted *second = arena.create<Counted>(&destroyed);
+
+        // Objects larger than a slab get their own, and do not close off the
+        // current slab.
+        EXPECT_EQ(arena.getNumSlabs(), 2);
+        EXPECT_LT(reinterpret_cast<char *>(first),
+                  reinterpret_cast<char *>(second));
+        EXPECT_EQ(big->counter, &destroyed);
+
+        for (unsigned i = 0; i != 100; ++i)
+            arena.create<int>(i);
+
+        EXPECT_EQ(arena.getNumObjects(), 103);
+    }
+
+    EXPECT_EQ(destroyed, 3);
+}
+
+} // namespace test
+
+} // namespace meddle
@@ -22,9 +22,6 @@ protected:
     std::ofstream m_File;
 
     void SetUp() override {
-        mir::clear_bb_dict();
-        mir::clear_inst_dict();
-        
         // create a new file /test.mdl
         m_File = std::ofstream("/test.mdl", std::ios::out | std::ios::trunc);
     }
@@ -1264,11 +1261,11 @@ TEST_F(IntegratedCodegenTest, Binary_FP_Div_Assign) {
     Parser parser = Parser(file, stream);
     TranslationUnit *unit = parser.get();
 
-    FunctionDecl *A = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
-    CompoundStmt *B = dynamic_cast<CompoundStmt *>(A->getBody());
-    ExprStmt *C = dynamic_cast<ExprStmt *>(B->getStmts()[1]);
-    BinaryExpr *D = dynamic_cast<BinaryExpr *>(C->getExpr());
-    FloatLiteral *E = dynamic_cast<FloatLiteral *>(D->getRHS());
+    FunctionDecl *A = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
+    CompoundStmt *B = dyn_cast<CompoundStmt>(A->getBody());
+    ExprStmt *C = dyn_cast<ExprStmt>(B->getStmts()[1]);
+    BinaryExpr *D = dyn_cast<BinaryExpr>(C->getExpr());
+    FloatLiteral *E = dyn_cast<FloatLiteral>(D->getRHS());
     EXPECT_EQ(E->getValue(), 1.230000);
 
     UnitManager units;
@@ -3492,8 +3489,8 @@ TEST_F(IntegratedCodegenTest, Unary_Address_Of) {
     String expected = R"(target :: x86_64 linux system_v
 
 test :: () -> void {
-    _y := slot i64*, align 8
     _x := slot i64, align 8
+    _y := slot i64*, align 8
 
 1:
     str i64 42 -> i64* _x, align 8
@@ -3813,8 +3810,8 @@ TEST_F(IntegratedCodegenTest, Array_Assign_Basic) {
     String expected = R"(target :: x86_64 linux system_v
 
 test :: () -> void {
-    _y := slot i64[3], align 8
     _x := slot i64[3], align 8
+    _y := slot i64[3], align 8
 
 1:
     $2 := ap i64*, i64[3]* _x, i64 0
@@ -3899,8 +3896,8 @@ TEST_F(IntegratedCodegenTest, Array_Reassign_To) {
     String expected = R"(target :: x86_64 linux system_v
 
 test :: () -> void {
-    _y := slot i64[2], align 8
     _x := slot i64[2], align 8
+    _y := slot i64[2], align 8
 
 1:
     $2 := ap i64*, i64[2]* _x, i64 0
@@ -4142,9 +4139,9 @@ TEST_F(IntegratedCodegenTest, Function_Aggregate_Arg_Many) {
     String expected = R"(target :: x86_64 linux system_v
 
 test :: (aarg i64[1]* %x, aarg i64[2]* %y, aarg i64[3]* %z) -> void {
-    _z := slot i64[3], align 8
-    _y := slot i64[2], align 8
     _x := slot i64[1], align 8
+    _y := slot i64[2], align 8
+    _z := slot i64[3], align 8
 
 1:
     cpy i64 8, i64[1]* %x, align 8 -> i64[1]* _x, align 8
@@ -4397,8 +4394,8 @@ TEST_F(IntegratedCodegenTest, Call_Aggregate_Array_Arg_Ref_Basic) {
     String expected = R"(target :: x86_64 linux system_v
 
 test :: () -> void {
-    _8 := slot i64[3], align 8
     _x := slot i64[3], align 8
+    _8 := slot i64[3], align 8
 
 4:
     $5 := ap i64*, i64[3]* _x, i64 0
@@ -4451,8 +4448,8 @@ TEST_F(IntegratedCodegenTest, Call_Aggregate_Array_Arg_Init_Basic) {
     String expected = R"(target :: x86_64 linux system_v
 
 test :: () -> void {
-    _5 := slot i64[3], align 8
     _x := slot i64, align 8
+    _5 := slot i64[3], align 8
 
 4:
     $6 := ap i64*, i64[3]* _5, i64 0
@@ -4504,9 +4501,9 @@ TEST_F(IntegratedCodegenTest, Call_Aggregate_Array_Return_And_Aggregate_Array_Ar
     String expected = R"(target :: x86_64 linux system_v
 
 test :: () -> void {
-    _8 := slot i64[3], align 8
-    _y := slot i64[3], align 8
     _x := slot i64[3], align 8
+    _y := slot i64[3], align 8
+    _8 := slot i64[3], align 8
 
 4:
     $5 := ap i64*, i64[3]* _x, i64 0
@@ -4876,8 +4873,8 @@ TEST_F(IntegratedCodegenTest, Spec_Struct_Method_Basic) {
 Color :: type { i64 }
 
 test :: () -> void {
-    _y := slot i64, align 8
     _x := slot Color*, align 8
+    _y := slot i64, align 8
 
 5:
     $6 := reint void* nil -> Color*
@@ -5028,8 +5025,8 @@ test :: () -> void {
 }
 
 box.foo :: (box* %self, i64 %y) -> i64 {
-    _y := slot i64, align 8
     _self := slot box*, align 8
+    _y := slot i64, align 8
 
 1:
     str box* %self -> box** _self, align 8
@@ -5150,8 +5147,8 @@ TEST_F(IntegratedCodegenTest, Nested_Struct_Init) {
 
     String expected = R"(target :: x86_64 linux system_v
 
-sb :: type { sa, f32 }
 sa :: type { i64, i8 }
+sb :: type { sa, f32 }
 
 test :: () -> void {
     _x := slot sb, align 8
@@ -5345,8 +5342,8 @@ TEST_F(IntegratedCodegenTest, Call_Aggregate_Struct_Arg_Ref_Basic) {
 box :: type { i64, i32 }
 
 test :: () -> void {
-    _8 := slot box, align 8
     _x := slot box, align 8
+    _8 := slot box, align 8
 
 4:
     $5 := ap i64*, box* _x, i64 0
@@ -5400,8 +5397,8 @@ TEST_F(IntegratedCodegenTest, Call_Aggregate_Struct_Arg_Init_Basic) {
 box :: type { i64, i32 }
 
 test :: () -> void {
-    _5 := slot box, align 8
     _x := slot i32, align 4
+    _5 := slot box, align 8
 
 4:
     $6 := ap i64*, box* _5, i64 0
@@ -5455,9 +5452,9 @@ TEST_F(IntegratedCodegenTest, Call_Aggregate_Struct_Return_Aggregate_Struct_Arg_
 box :: type { i64, i1 }
 
 test :: () -> void {
-    _7 := slot box, align 8
-    _y := slot box, align 8
     _x := slot box, align 8
+    _y := slot box, align 8
+    _7 := slot box, align 8
 
 4:
     $5 := ap i64*, box* _x, i64 0
@@ -5551,8 +5548,8 @@ TEST_F(IntegratedCodegenTest, Method_Call_Aggregate_Struct_Return_Basic) {
 box :: type { i64, f32 }
 
 test :: () -> void {
-    _y := slot box, align 8
     _x := slot box, align 8
+    _y := slot box, align 8
 
 6:
     call void box.foo(box* _y, box* _x)
@@ -5664,6 +5661,98 @@ test :: () -> void {
     delete seg;
 }
 
+#define NAMED_MIR_IF_BASIC R"(test :: (x: i64) i64 { if x { ret 1; } if x { ret 2; } ret x; })"
+TEST_F(IntegratedCodegenTest, Named_MIR_If_Basic) {
+    File file = File("test.mdl", "/", "/test.mdl", NAMED_MIR_IF_BASIC);
+    Lexer lexer = Lexer(file);
+    TokenStream stream = lexer.unwrap();
+    Parser parser = Parser(file, stream);
+    TranslationUnit *unit = parser.get();
+
+    UnitManager units;
+    units.addVirtUnit(unit);
+    units.drive(Options());
+
+    Target target = Target(mir::Arch::X86_64, mir::OS::Linux, 
+                           mir::ABI::SystemV);
+
+    Options opts = Options();
+    opts.NamedMIR = 1;
+
+    Segment *seg = new Segment(target);
+    CGN cgn = CGN(opts, unit, seg);
+
+    std::stringstream ss;
+    seg->print(ss);
+
+    String expected = R"(target :: x86_64 linux system_v
+
+test :: (i64 %x) -> i64 {
+    _x := slot i64, align 8
+
+entry:
+    str i64 %x -> i64* _x, align 8
+    $x.val := load i64* _x, align 8
+    $int.cmp := icmp_ne i64 $x.val, i64 0
+    brif i1 $int.cmp, #if.then, #if.merge
+
+if.then (entry):
+    ret i64 1
+
+if.merge (entry):
+    $x.val1 := load i64* _x, align 8
+    $int.cmp1 := icmp_ne i64 $x.val1, i64 0
+    brif i1 $int.cmp1, #if.then1, #if.merge1
+
+if.then1 (if.merge):
+    ret i64 2
+
+if.merge1 (if.merge):
+    $x.val2 := load i64* _x, align 8
+    ret i64 $x.val2
+}
+)";
+    EXPECT_EQ(ss.str(), expected);
+
+    delete seg;
+}
+
+#define LAZY_BODIES R"(box<T> { x: T, y: i32 } get<T> :: (x: T) -> T { ret x; } test :: () i64 { mut p: pair = pair { a: 1, b: 2 }; mut b: box<i64> = box<i64> { x: p.a, y: 3 }; ret get<i64>(b.x) + cast<i64> p.b; } pair :: { a: i64, b: i32 })"
+TEST_F(IntegratedCodegenTest, Lazy_Bodies) {
+    Target target = Target(mir::Arch::X86_64, mir::OS::Linux, 
+                           mir::ABI::SystemV);
+
+    // Bodies that are parsed late, i.e. once the unit has been sanitized,
+    // must lower the same as bodies that were parsed up front.
+    std::stringstream eager, lazy;
+    for (unsigned i = 0; i != 2; ++i) {
+        Options opts = Options();
+        opts.LazyBodies = i;
+
+        File file = File("test.mdl", "/", "/test.mdl", LAZY_BODIES);
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer, &opts);
+        TranslationUnit *unit = parser.get();
+
+        auto *test = cast<FunctionDecl>(unit->getDecls().at(2));
+        EXPECT_EQ(test->isBodyDeferred(), opts.LazyBodies);
+
+        UnitManager units;
+        units.addVirtUnit(unit);
+        units.drive(opts);
+        EXPECT_FALSE(test->isBodyDeferred());
+
+        Segment *seg = new Segment(target);
+        CGN cgn = CGN(opts, unit, seg);
+        seg->print(i ? lazy : eager);
+
+        delete seg;
+    }
+
+    EXPECT_NE(eager.str().find("test :: () -> i64"), String::npos);
+    EXPECT_EQ(lazy.str(), eager.str());
+}
+
 } // namespace test
 
 } // namespace meddle
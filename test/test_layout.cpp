@@ -0,0 +1,77 @@
+#include "../compiler/mir/builder.h"
+#include "../compiler/mir/segment.h"
+#include "../compiler/mir/type.h"
+
+#include <gtest/gtest.h>
+
+namespace mir {
+
+namespace test {
+
+class LayoutTest : public ::testing::Test {
+protected:
+    Segment *m_Segment = nullptr;
+    Builder *m_Builder = nullptr;
+
+    void SetUp() override {
+        m_Segment = new Segment(Target(Arch::X86_64, OS::Linux, ABI::SystemV));
+        m_Builder = new Builder(m_Segment);
+    }
+
+    void TearDown() override {
+        delete m_Builder;
+        delete m_Segment;
+    }
+};
+
+TEST_F(LayoutTest, Structural_Types_Are_Unique) {
+    Type *i8 = m_Builder->get_i8_ty();
+    Type *i64 = m_Builder->get_i64_ty();
+
+    EXPECT_EQ(PointerType::get(m_Segment, i64),
+              PointerType::get(m_Segment, i64));
+    EXPECT_NE(PointerType::get(m_Segment, i64),
+              PointerType::get(m_Segment, i8));
+
+    ArrayType *AT = ArrayType::get(m_Segment, i64, 4);
+    EXPECT_EQ(AT, ArrayType::get(m_Segment, i64, 4));
+    EXPECT_NE(AT, ArrayType::get(m_Segment, i64, 5));
+    EXPECT_EQ(AT->get_name(), "i64[4]");
+
+    FunctionType *FT = FunctionType::get(m_Segment, { i64, i8 }, i64);
+    EXPECT_EQ(FT, FunctionType::get(m_Segment, { i64, i8 }, i64));
+    EXPECT_NE(FT, FunctionType::get(m_Segment, { i8, i64 }, i64));
+    EXPECT_NE(FT, FunctionType::get(m_Segment, { i64, i8 }, i8));
+    EXPECT_EQ(FT->get_name(), "(i64, i8) -> i64");
+}
+
+TEST_F(LayoutTest, Struct_Layout) {
+    const DataLayout &DL = m_Segment->get_data_layout();
+    Type *i8 = m_Builder->get_i8_ty();
+    Type *i32 = m_Builder->get_i32_ty();
+    Type *i64 = m_Builder->get_i64_ty();
+
+    StructType *inner = StructType::create(m_Segment, "inner", { i8, i32 });
+    StructType *outer = StructType::create(m_Segment, "outer",
+        { i8, inner, ArrayType::get(m_Segment, i64, 2), i8 });
+
+    const StructLayout &SL = DL.get_struct_layout(outer);
+    EXPECT_EQ(SL.size, 40);
+    EXPECT_EQ(SL.align, 8);
+    ASSERT_EQ(SL.offsets.size(), 4);
+    EXPECT_EQ(SL.offsets[1], 4);
+    EXPECT_EQ(SL.offsets[2], 16);
+    EXPECT_EQ(SL.offsets[3], 32);
+
+    EXPECT_EQ(DL.get_type_size(inner), 8);
+    EXPECT_EQ(DL.get_type_align(inner), 4);
+    EXPECT_EQ(DL.get_struct_member_offset(inner, 1), 4);
+
+    // The layout is computed once and then shared by every query.
+    EXPECT_EQ(&DL.get_struct_layout(outer), &SL);
+    EXPECT_EQ(DL.get_type_size(outer), 40);
+}
+
+} // namespace test
+
+} // namespace mir
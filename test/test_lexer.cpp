@@ -1,6 +1,9 @@
 #include "../compiler/lexer/lexer.h"
+#include "../compiler/lexer/scan.h"
+#include "../compiler/core/ident.h"
 
 #include <gtest/gtest.h>
+#include <thread>
 
 namespace meddle {
 
@@ -243,6 +246,195 @@ TEST_F(LexerTest, LexNegativeInteger) {
     EXPECT_EQ(stream.get(13)->kind, TokenKind::Eof);
 }
 
+TEST_F(LexerTest, LexLocations) {
+    Lexer lexer = Lexer(File("loc.mdl", "", "", "a bc\n\n  d"));
+    TokenStream stream = lexer.unwrap();
+
+    EXPECT_EQ(stream.getTokens().size(), 4);
+    EXPECT_EQ(stream.get(0)->md.getFile().filename, "loc.mdl");
+    EXPECT_EQ(stream.get(0)->md.getLine(), 1);
+    EXPECT_EQ(stream.get(0)->md.getCol(), 1);
+    EXPECT_EQ(stream.get(1)->md.getLine(), 1);
+    EXPECT_EQ(stream.get(1)->md.getCol(), 3);
+    EXPECT_EQ(stream.get(2)->md.getLine(), 3);
+    EXPECT_EQ(stream.get(2)->md.getCol(), 3);
+    EXPECT_EQ(stream.get(3)->kind, TokenKind::Eof);
+    EXPECT_EQ(stream.get(3)->md.getLine(), 3);
+    EXPECT_EQ(stream.get(3)->md.getCol(), 4);
+}
+
+TEST_F(LexerTest, LexLocationsAcrossFiles) {
+    Lexer first = Lexer(File("first.mdl", "", "", "x"));
+    Lexer second = Lexer(File("second.mdl", "", "", "\ny"));
+    TokenStream a = first.unwrap();
+    TokenStream b = second.unwrap();
+
+    EXPECT_EQ(a.get(0)->md.getFile().filename, "first.mdl");
+    EXPECT_EQ(b.get(0)->md.getFile().filename, "second.mdl");
+    EXPECT_EQ(b.get(0)->md.getLine(), 2);
+    EXPECT_EQ(b.get(0)->md.getCol(), 1);
+    EXPECT_EQ(sizeof(Metadata), 4);
+}
+
+TEST_F(LexerTest, LexSpellingsViewSource) {
+    File file = File("", "", "", "foo \"bar\" \"a\\nb\"");
+    Lexer lexer = Lexer(file);
+    TokenStream stream = lexer.unwrap();
+
+    EXPECT_EQ(stream.getTokens().size(), 4);
+    EXPECT_EQ(stream.get(0)->value, "foo");
+    EXPECT_EQ(stream.get(0)->value.data(), file.contents.data());
+    EXPECT_EQ(stream.get(1)->value, "bar");
+    EXPECT_EQ(stream.get(1)->value.data(), file.contents.data() + 5);
+    EXPECT_EQ(stream.get(2)->value, "a\nb");
+}
+
+TEST_F(LexerTest, ScanKernelsAgree) {
+    String src;
+    const char alphabet[] = "ab_Z09 \t\n\"\\/+{}\x80\xff";
+    unsigned seed = 7;
+    for (unsigned i = 0; i != 512; ++i) {
+        seed = seed * 1103515245 + 12345;
+        unsigned n = 1 + (seed >> 16) % 40;
+        char c = alphabet[(seed >> 8) % (sizeof(alphabet) - 1)];
+        src.append(n, c);
+    }
+
+    const char *B = src.data();
+    const char *E = B + src.size();
+    ScanLevel prev = getScanLevel();
+    for (unsigned L = 0; L <= unsigned(getBestScanLevel()); ++L) {
+        for (const char *P = B; P != E; ++P) {
+            setScanLevel(ScanLevel::Scalar);
+            unsigned expectedLines = 0;
+            const char *ws = scanWhitespace(P, E, expectedLines);
+            const char *id = scanIdentifier(P, E);
+            const char *eol = scanLineEnd(P, E);
+            const char *str = scanStringEnd(P, E);
+
+            setScanLevel(ScanLevel(L));
+            unsigned lines = 0;
+            EXPECT_EQ(scanWhitespace(P, E, lines), ws);
+            EXPECT_EQ(lines, expectedLines);
+            EXPECT_EQ(scanIdentifier(P, E), id);
+            EXPECT_EQ(scanLineEnd(P, E), eol);
+            EXPECT_EQ(scanStringEnd(P, E), str);
+        }
+    }
+
+    setScanLevel(prev);
+}
+
+TEST_F(LexerTest, LexCommentsAndBlankLines) {
+    String src = "// first\n\n\n   // second\n\t\tfoo // trailing\n\nbar";
+    Lexer lexer = Lexer(File("", "", "", src));
+    TokenStream stream = lexer.unwrap();
+
+    EXPECT_EQ(stream.getTokens().size(), 3);
+    EXPECT_EQ(stream.get(0)->value, "foo");
+    EXPECT_EQ(stream.get(0)->md.getLine(), 5);
+    EXPECT_EQ(stream.get(0)->md.getCol(), 3);
+    EXPECT_EQ(stream.get(1)->value, "bar");
+    EXPECT_EQ(stream.get(1)->md.getLine(), 7);
+    EXPECT_EQ(stream.get(2)->kind, TokenKind::Eof);
+}
+
+TEST_F(LexerTest, LexKeywords) {
+    Lexer lexer = Lexer(File("", "", "", "mut until untill _ _x no_mangle \"ret\""));
+    TokenStream stream = lexer.unwrap();
+
+    EXPECT_EQ(stream.getTokens().size(), 8);
+    EXPECT_EQ(stream.get(0)->kind, TokenKind::Identifier);
+    EXPECT_EQ(stream.get(0)->keyword, KeywordKind::Mut);
+    EXPECT_EQ(stream.get(1)->keyword, KeywordKind::Until);
+    EXPECT_EQ(stream.get(2)->keyword, KeywordKind::None);
+    EXPECT_EQ(stream.get(3)->keyword, KeywordKind::Underscore);
+    EXPECT_EQ(stream.get(4)->keyword, KeywordKind::None);
+    EXPECT_EQ(stream.get(5)->keyword, KeywordKind::NoMangle);
+    EXPECT_EQ(stream.get(6)->kind, TokenKind::Literal);
+    EXPECT_EQ(stream.get(6)->keyword, KeywordKind::None);
+}
+
+TEST_F(LexerTest, StreamTokensOnDemand) {
+    String src;
+    for (unsigned i = 0; i != 100; ++i)
+        src += "tok" + std::to_string(i) + " ";
+
+    Lexer eager = Lexer(File("", "", "", src));
+    TokenStream all = eager.unwrap();
+
+    Lexer lazy = Lexer(File("", "", "", src));
+    TokenStream stream = TokenStream(lazy, 4);
+    EXPECT_TRUE(stream.isStreaming());
+
+    for (unsigned i = 0; i != all.getTokens().size(); ++i) {
+        EXPECT_EQ(stream.get()->value, all.get(i)->value);
+    }
+
+    EXPECT_EQ(stream.getCapacity(), 4);
+    EXPECT_EQ(stream.get()->kind, TokenKind::Eof);
+    EXPECT_FALSE(stream.isEnd());
+}
+
+TEST_F(LexerTest, StreamRestorePinnedPosition) {
+    String src;
+    for (unsigned i = 0; i != 100; ++i)
+        src += "tok" + std::to_string(i) + " ";
+
+    Lexer lazy = Lexer(File("", "", "", src));
+    TokenStream stream = TokenStream(lazy, 4);
+
+    EXPECT_EQ(stream.get()->value, "tok0");
+    unsigned pos = stream.getPos();
+    stream.pin(pos);
+
+    for (unsigned i = 1; i != 50; ++i)
+        EXPECT_EQ(stream.get()->value, "tok" + std::to_string(i));
+
+    EXPECT_GE(stream.getCapacity(), 50);
+    stream.setPos(pos);
+    EXPECT_EQ(stream.get()->value, "tok1");
+    stream.unpin();
+
+    for (unsigned i = 2; i != 100; ++i)
+        EXPECT_EQ(stream.get()->value, "tok" + std::to_string(i));
+
+    EXPECT_EQ(stream.get()->kind, TokenKind::Eof);
+}
+
+TEST_F(LexerTest, InternIdentifiers) {
+    File file = File("", "", "", "foo bar foo");
+    Lexer lexer = Lexer(file);
+    TokenStream stream = lexer.unwrap();
+
+    Ident first = Ident::get(stream.get(0)->value);
+    Ident second = Ident::get(stream.get(1)->value);
+    Ident third = Ident::get(stream.get(2)->value);
+    EXPECT_EQ(first, third);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(first.str(), "foo");
+    EXPECT_EQ(Ident::find(String("f") + "oo"), first);
+    EXPECT_TRUE(Ident::find("never_interned_anywhere").empty());
+    EXPECT_TRUE(Ident::get("").empty());
+
+    // Threads racing to intern the same spellings must agree on them.
+    std::vector<Ident> idents(8 * 256);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t != 8; ++t) {
+        threads.emplace_back([&idents, t] {
+            for (unsigned i = 0; i != 256; ++i)
+                idents[t * 256 + i] = Ident::get("race" + std::to_string(i));
+        });
+    }
+
+    for (auto &T : threads)
+        T.join();
+
+    for (unsigned t = 1; t != 8; ++t)
+        for (unsigned i = 0; i != 256; ++i)
+            EXPECT_EQ(idents[t * 256 + i], idents[i]);
+}
+
 } // namespace test
 
 } // namespace meddle
@@ -1,10 +1,16 @@
+#include "../compiler/cgn/codegen.h"
+#include "../compiler/core/threadpool.h"
+#include "../compiler/mir/function.h"
+#include "../compiler/mir/segment.h"
 #include "../compiler/parser/parser.h"
 #include "../compiler/lexer/lexer.h"
 #include "../compiler/tree/decl.h"
+#include "../compiler/tree/interface.h"
 #include "../compiler/tree/unitman.h"
 
 #include "gtest/gtest.h"
 #include <fstream>
+#include <sstream>
 #include <gtest/gtest.h>
 
 namespace meddle {
@@ -395,6 +401,454 @@ TEST_F(MultiUnitTest, Two_Files_Named_Use_Enum) {
     std::remove("cli.mdl");
 }
 
+TEST_F(MultiUnitTest, Many_Files_Parallel_Parse) {
+    const unsigned N = 32;
+    std::vector<File> files;
+    for (unsigned i = 0; i != N; ++i) {
+        String name = "par" + std::to_string(i) + ".mdl";
+        std::ofstream F(name);
+        F << "$public fn" << i << " :: () i64 {\n    ret " << i << ";\n}\n";
+        if (i > 0)
+            F << "use \"par" << i - 1 << "\";\n";
+        F.close();
+        files.push_back(parseInputFile(name));
+    }
+
+    Options opts;
+    std::vector<TranslationUnit *> parsed(N, nullptr);
+    {
+        ThreadPool pool(4);
+        for (unsigned i = 0; i != N; ++i) {
+            pool.submit([&files, &parsed, &opts, i] {
+                Lexer lexer = Lexer(files[i]);
+                Parser parser = Parser(files[i], lexer);
+                opts.lexedLines += lexer.getLineCount();
+                parsed[i] = parser.get();
+            });
+        }
+
+        pool.wait();
+    }
+
+    // Every file but the first has a trailing use, and each ends in a newline.
+    EXPECT_EQ(opts.lexedLines.get(), 4 + (N - 1) * 5);
+
+    UnitManager units;
+    for (unsigned i = 0; i != N; ++i) {
+        ASSERT_NE(parsed[i], nullptr);
+        EXPECT_EQ(parsed[i]->getID(), "par" + std::to_string(i));
+        EXPECT_EQ(parsed[i]->getDecls().size(), 1);
+        units.addUnit(parsed[i]);
+    }
+
+    EXPECT_NO_FATAL_FAILURE(units.drive(opts));
+
+    for (unsigned i = 0; i != N; ++i)
+        std::remove(("par" + std::to_string(i) + ".mdl").c_str());
+}
+
+TEST_F(MultiUnitTest, Three_Files_Cyclical_Use) {
+    std::ofstream F1("a.mdl");
+    F1 << R"(use "b"; $public a :: () i64 { ret 1; })";
+    F1.close();
+
+    std::ofstream F2("b.mdl");
+    F2 << R"(use "c"; $public b :: () i64 { ret 2; })";
+    F2.close();
+
+    std::ofstream F3("c.mdl");
+    F3 << R"(use "a"; $public c :: () i64 { ret 3; })";
+    F3.close();
+
+    std::vector<File> files = { 
+        parseInputFile("a.mdl"), parseInputFile("b.mdl"), parseInputFile("c.mdl")
+    };
+    UnitManager units;
+    
+    for (auto &file : files) {
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer);
+        units.addUnit(parser.get());
+    }
+
+    EXPECT_EXIT(units.drive(Options()), ::testing::ExitedWithCode(1), ".*");
+
+    std::remove("a.mdl");
+    std::remove("b.mdl");
+    std::remove("c.mdl");
+}
+
+TEST_F(MultiUnitTest, Many_Files_Dense_Uses) {
+    const unsigned N = 200;
+    std::vector<File> files;
+    for (unsigned i = 0; i != N; ++i) {
+        String name = "dense" + std::to_string(i) + ".mdl";
+        std::ofstream F(name);
+        for (unsigned j = i > 16 ? i - 16 : 0; j < i; ++j)
+            F << "use { fn" << j << " } = \"dense" << j << "\";\n";
+        F << "$public fn" << i << " :: () i64 {\n    ret " << i << ";\n}\n";
+        F.close();
+        files.push_back(parseInputFile(name));
+    }
+
+    UnitManager units;
+    for (auto &file : files) {
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer);
+        units.addUnit(parser.get());
+    }
+
+    EXPECT_NO_FATAL_FAILURE(units.drive(Options()));
+
+    // Every unit must come after each of the units that it uses.
+    const std::vector<TranslationUnit *> &order = units.getUseOrder();
+    ASSERT_EQ(order.size(), N);
+    for (unsigned i = 0; i != N; ++i) {
+        for (auto &Use : order[i]->getUses()) {
+            auto it = std::find(order.begin(), order.end(), Use->getUnit());
+            EXPECT_LT(it - order.begin(), i);
+        }
+    }
+
+    for (unsigned i = 0; i != N; ++i)
+        std::remove(("dense" + std::to_string(i) + ".mdl").c_str());
+}
+
+#define PARALLEL_TEMPLATES R"($public box<T> { x: T*, y: T } $public get<T> :: (x: T) -> T { ret x; })"
+
+/// Parse and analyze \p files with \p jobs workers, and lower each of them.
+///
+/// \returns The printed MIR of every unit, in the order of \p files.
+static String lowerFiles(const std::vector<File> &files, unsigned jobs) {
+    UnitManager units;
+    std::vector<TranslationUnit *> parsed;
+    for (auto &file : files) {
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer);
+        parsed.push_back(parser.get());
+        units.addUnit(parsed.back());
+    }
+
+    Options opts;
+    opts.Jobs = jobs;
+    units.drive(opts);
+
+    std::ostringstream OS;
+    mir::Target target = mir::Target(mir::Arch::X86_64, mir::OS::Linux, 
+                                     mir::ABI::SystemV);
+    for (auto &unit : parsed) {
+        mir::Segment seg = mir::Segment(target);
+        CGN cgn = CGN(Options(), unit, &seg);
+        seg.print(OS);
+    }
+
+    return OS.str();
+}
+
+TEST_F(MultiUnitTest, Many_Files_Parallel_Analysis) {
+    const unsigned N = 24;
+    std::ofstream T("tmpl.mdl");
+    T << PARALLEL_TEMPLATES;
+    T.close();
+
+    // Every user specializes the same templates, half with i32 and half with
+    // i64. The users are independent of each other, so that the analysis 
+    // races for the same specializations.
+    std::vector<File> files = { parseInputFile("tmpl.mdl") };
+    for (unsigned i = 0; i != N; ++i) {
+        String name = "user" + std::to_string(i) + ".mdl";
+        String ty = i % 2 ? "i32" : "i64";
+        std::ofstream F(name);
+        F << "use \"tmpl\";\n";
+        F << "$public fn" << i << " :: () -> " << ty << " {\n"
+          << "    mut b: box<" << ty << "> = box<" << ty << "> { x: nil, y: "
+          << i << " };\n    ret get<" << ty << ">(b.y);\n}\n";
+        F.close();
+        files.push_back(parseInputFile(name));
+    }
+
+    UnitManager units;
+    TranslationUnit *tmpl = nullptr;
+    for (auto &file : files) {
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer);
+        units.addUnit(parser.get());
+        if (!tmpl)
+            tmpl = parser.get();
+    }
+
+    Options opts;
+    opts.Jobs = 4;
+    EXPECT_NO_FATAL_FAILURE(units.drive(opts));
+
+    auto *box = dyn_cast<StructDecl>(tmpl->getDecls().at(0));
+    auto *get = dyn_cast<FunctionDecl>(tmpl->getDecls().at(1));
+    ASSERT_NE(box, nullptr);
+    ASSERT_NE(get, nullptr);
+
+    Context *ctx = tmpl->getContext();
+    for (Type *ty : { ctx->getI32Type(), ctx->getI64Type() }) {
+        EXPECT_NE(box->findSpecialization({ ty }), nullptr);
+        ASSERT_NE(get->findSpecialization({ ty }), nullptr);
+
+        // Only other units call `get`, so its owner must lower it even when
+        // specializations are lowered lazily.
+        EXPECT_TRUE(get->findSpecialization({ ty })->isExternal());
+    }
+
+    // The output must not depend on how the analysis was scheduled, so the
+    // specializations are lowered in order of their names, and the first of
+    // them is given the first block.
+    String serial = lowerFiles(files, 1);
+    size_t first = serial.find("tmpl.get<i32> ::");
+    ASSERT_NE(first, String::npos);
+    String body = serial.substr(first, serial.find('}', first) - first);
+    EXPECT_NE(body.find("\n1:\n"), String::npos);
+    for (unsigned r = 0; r != 4; ++r)
+        EXPECT_EQ(lowerFiles(files, 4), serial);
+
+    std::remove("tmpl.mdl");
+    for (unsigned i = 0; i != N; ++i)
+        std::remove(("user" + std::to_string(i) + ".mdl").c_str());
+}
+
+#define SHARED_SPECS_TMPL R"($public box<T> { x: T*, y: T } $public get<T> :: (x: T) -> T { ret x; })"
+#define SHARED_SPECS_A R"(use "tmpl"; pt { a: i64, b: i64 } $public fa :: () -> i64 { mut b: box<i64>* = nil; mut p: pt = get<pt>(pt { a: 1, b: 2 }); ret get<i64>(p.a); })"
+#define SHARED_SPECS_B R"(use "tmpl"; pt { c: i8 } $public fb :: () -> i32 { mut p: pt* = get<pt*>(nil); mut q: pt = get<pt>(pt { c: 1 }); mut c: box<i32>* = nil; ret get<i32>(2) + cast<i32> get<i64>(3); })"
+TEST_F(MultiUnitTest, Shared_Specializations) {
+    std::ofstream T("tmpl.mdl");
+    T << SHARED_SPECS_TMPL;
+    T.close();
+
+    std::ofstream A("usea.mdl");
+    A << SHARED_SPECS_A;
+    A.close();
+
+    std::ofstream B("useb.mdl");
+    B << SHARED_SPECS_B;
+    B.close();
+
+    std::vector<File> files = { parseInputFile("tmpl.mdl"), 
+        parseInputFile("usea.mdl"), parseInputFile("useb.mdl") };
+
+    UnitManager units;
+    std::vector<TranslationUnit *> parsed;
+    for (auto &file : files) {
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer);
+        parsed.push_back(parser.get());
+        units.addUnit(parsed.back());
+    }
+
+    EXPECT_NO_FATAL_FAILURE(units.drive(Options()));
+
+    mir::Target target = mir::Target(mir::Arch::X86_64, mir::OS::Linux, 
+                                     mir::ABI::SystemV);
+    std::vector<mir::Segment *> segs;
+    for (auto &unit : parsed) {
+        segs.push_back(new mir::Segment(target));
+        CGN cgn = CGN(Options(), unit, segs.back());
+    }
+
+    // The unit of the templates defines every specialization, including those
+    // over types private to other units, which are named after their unit.
+    for (auto *name : { "tmpl.get<i64>", "tmpl.get<i32>", "tmpl.get<useb.pt*>",
+      "tmpl.get<usea.pt>", "tmpl.get<useb.pt>" }) {
+        ASSERT_NE(segs[0]->get_function(name), nullptr);
+        EXPECT_NE(segs[0]->get_function(name)->head(), nullptr);
+    }
+
+    // Two private types of the same name are lowered apart.
+    const mir::DataLayout &DL = segs[0]->get_data_layout();
+    ASSERT_NE(mir::StructType::get(segs[0], "usea.pt"), nullptr);
+    ASSERT_NE(mir::StructType::get(segs[0], "useb.pt"), nullptr);
+    EXPECT_EQ(mir::StructType::get(segs[0], "pt"), nullptr);
+    EXPECT_EQ(DL.get_type_size(mir::StructType::get(segs[0], "usea.pt")), 16);
+    EXPECT_EQ(DL.get_type_size(mir::StructType::get(segs[0], "useb.pt")), 1);
+
+    // Users only declare the specializations they call, and only lower the
+    // specialized types they name.
+    ASSERT_NE(segs[1]->get_function("tmpl.get<i64>"), nullptr);
+    EXPECT_EQ(segs[1]->get_function("tmpl.get<i64>")->head(), nullptr);
+    EXPECT_EQ(segs[1]->get_function("tmpl.get<i32>"), nullptr);
+    EXPECT_EQ(segs[1]->get_function("tmpl.get<useb.pt*>"), nullptr);
+    EXPECT_NE(segs[1]->get_function("tmpl.get<usea.pt>"), nullptr);
+    EXPECT_EQ(segs[1]->get_function("tmpl.get<useb.pt>"), nullptr);
+    EXPECT_NE(mir::StructType::get(segs[1], "pt"), nullptr);
+    EXPECT_NE(mir::StructType::get(segs[1], "tmpl.box<i64>"), nullptr);
+    EXPECT_EQ(mir::StructType::get(segs[1], "tmpl.box<i32>"), nullptr);
+
+    for (auto *name : { "tmpl.get<i64>", "tmpl.get<i32>", "tmpl.get<useb.pt*>",
+      "tmpl.get<useb.pt>" }) {
+        ASSERT_NE(segs[2]->get_function(name), nullptr);
+        EXPECT_EQ(segs[2]->get_function(name)->head(), nullptr);
+    }
+
+    EXPECT_EQ(mir::StructType::get(segs[2], "tmpl.box<i64>"), nullptr);
+
+    for (auto *seg : segs)
+        delete seg;
+
+    std::remove("tmpl.mdl");
+    std::remove("usea.mdl");
+    std::remove("useb.mdl");
+}
+
+#define INTERFACE_LIB R"($public pt :: { a: i64, b: i64 = 5 } $public add :: (x: i64, y: i64) -> i64 { ret x + y; } $public get<T> :: (x: T) -> T { mut y: T = x; ret y; })"
+#define INTERFACE_USER R"(use "ilib"; user :: () -> i64 { mut p: pt = pt { a: 1, b: 2 }; ret add(p.a, get<i64>(3)); })"
+TEST_F(MultiUnitTest, Interface_Round_Trip) {
+    std::ofstream L("ilib.mdl");
+    L << INTERFACE_LIB;
+    L.close();
+
+    {
+        File file = parseInputFile("ilib.mdl");
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer);
+        UnitManager units;
+        units.addUnit(parser.get());
+
+        Options opts;
+        opts.EmitInterfaces = 1;
+        EXPECT_NO_FATAL_FAILURE(units.drive(opts));
+    }
+
+    // The user is compiled against the interface alone.
+    std::remove("ilib.mdl");
+    ASSERT_TRUE(std::filesystem::exists("ilib.mdli"));
+
+    std::ofstream U("iuser.mdl");
+    U << INTERFACE_USER;
+    U.close();
+
+    File file = parseInputFile("iuser.mdl");
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *user = parser.get();
+    UnitManager units;
+    units.addUnit(user);
+    EXPECT_NO_FATAL_FAILURE(units.drive(Options()));
+
+    ASSERT_EQ(units.getUseOrder().size(), 2);
+    TranslationUnit *lib = units.getUseOrder()[0];
+    EXPECT_TRUE(lib->isInterface());
+    EXPECT_EQ(lib->getID(), "ilib");
+    EXPECT_EQ(lib->getExports().size(), 3);
+
+    // The body of the template is left alone until it is specialized.
+    auto *get = dyn_cast_or_null<FunctionDecl>(lib->getScope()->lookup("get"));
+    ASSERT_NE(get, nullptr);
+    EXPECT_TRUE(get->isBodyDeferred());
+
+    mir::Segment *seg = new mir::Segment(mir::Target(mir::Arch::X86_64, 
+        mir::OS::Linux, mir::ABI::SystemV));
+    CGN cgn = CGN(Options(), user, seg);
+    EXPECT_FALSE(get->isBodyDeferred());
+
+    // Functions of the interface are only declared, but the user defines the
+    // specializations it needs, as the interface is never lowered.
+    ASSERT_NE(seg->get_function("ilib.add"), nullptr);
+    EXPECT_EQ(seg->get_function("ilib.add")->head(), nullptr);
+    ASSERT_NE(seg->get_function("ilib.get<i64>"), nullptr);
+    EXPECT_NE(seg->get_function("ilib.get<i64>")->head(), nullptr);
+    EXPECT_NE(mir::StructType::get(seg, "ilib.pt"), nullptr);
+
+    delete seg;
+    std::remove("iuser.mdl");
+    std::remove("ilib.mdli");
+}
+
+TEST_F(MultiUnitTest, Interface_Bad_Version) {
+    std::ofstream L("ibad.mdli", std::ios::binary);
+    uint32_t version = InterfaceVersion + 1;
+    L.write("MDLI", 4);
+    L.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    L.close();
+
+    std::ofstream U("iuser.mdl");
+    U << R"(use "ibad"; user :: () -> i64 { ret 0; })";
+    U.close();
+
+    File file = parseInputFile("iuser.mdl");
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    UnitManager units;
+    units.addUnit(parser.get());
+    EXPECT_EXIT(units.drive(Options()), ::testing::ExitedWithCode(1), ".*");
+
+    std::remove("iuser.mdl");
+    std::remove("ibad.mdli");
+}
+
+TEST_F(MultiUnitTest, Interface_Bad_Count) {
+    // A header for an interface of no source, which claims more uses than it
+    // could possibly hold.
+    std::ofstream L("ibad.mdli", std::ios::binary);
+    uint32_t version = InterfaceVersion;
+    uint32_t zero = 0;
+    int64_t hash = 0;
+    uint32_t uses = 0xFFFFFFFF;
+    L.write("MDLI", 4);
+    L.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    L.write(reinterpret_cast<const char *>(&zero), sizeof(zero));
+    L.write(reinterpret_cast<const char *>(&hash), sizeof(hash));
+    L.write(reinterpret_cast<const char *>(&zero), sizeof(zero));
+    L.write(reinterpret_cast<const char *>(&uses), sizeof(uses));
+    L.close();
+
+    std::ofstream U("iuser.mdl");
+    U << R"(use "ibad"; user :: () -> i64 { ret 0; })";
+    U.close();
+
+    File file = parseInputFile("iuser.mdl");
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    UnitManager units;
+    units.addUnit(parser.get());
+    EXPECT_EXIT(units.drive(Options()), ::testing::ExitedWithCode(1), ".*");
+
+    std::remove("iuser.mdl");
+    std::remove("ibad.mdli");
+}
+
+TEST_F(MultiUnitTest, Interface_Out_Of_Date) {
+    std::ofstream L("ilib.mdl");
+    L << INTERFACE_LIB;
+    L.close();
+
+    {
+        File file = parseInputFile("ilib.mdl");
+        Lexer lexer = Lexer(file);
+        Parser parser = Parser(file, lexer);
+        UnitManager units;
+        units.addUnit(parser.get());
+
+        Options opts;
+        opts.EmitInterfaces = 1;
+        EXPECT_NO_FATAL_FAILURE(units.drive(opts));
+    }
+
+    // The source changes after its interface was written.
+    L.open("ilib.mdl");
+    L << INTERFACE_LIB << R"( $public sub :: (x: i64) -> i64 { ret x; })";
+    L.close();
+
+    std::ofstream U("iuser.mdl");
+    U << INTERFACE_USER;
+    U.close();
+
+    File file = parseInputFile("iuser.mdl");
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    UnitManager units;
+    units.addUnit(parser.get());
+    EXPECT_EXIT(units.drive(Options()), ::testing::ExitedWithCode(1), ".*");
+
+    std::remove("iuser.mdl");
+    std::remove("ilib.mdl");
+    std::remove("ilib.mdli");
+}
+
 } // namespace test
 
 } // namespace meddle
@@ -25,7 +25,7 @@ TEST_F(ParseDeclTest, Function_Empty) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
 
     EXPECT_EQ(FN->getName(), "test");
@@ -46,22 +46,22 @@ TEST_F(ParseDeclTest, Function_Single_Statement) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_EQ(FN->getName(), "test");
     EXPECT_EQ(FN->getReturnType()->getName(), "void");
     EXPECT_EQ(FN->getParams().size(), 0);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_NE(RS->getExpr(), nullptr);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(RS->getExpr());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(RS->getExpr());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 0);
 
@@ -78,7 +78,7 @@ TEST_F(ParseDeclTest, Function_Params_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_EQ(FN->getName(), "test");
     EXPECT_EQ(FN->getReturnType()->getName(), "void");
@@ -101,7 +101,7 @@ TEST_F(ParseDeclTest, Function_Params_Many) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_EQ(FN->getName(), "test");
     EXPECT_EQ(FN->getReturnType()->getName(), "void");
@@ -131,18 +131,18 @@ TEST_F(ParseDeclTest, Var_Local_Mut_Empty) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
     
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i64");
@@ -162,18 +162,18 @@ TEST_F(ParseDeclTest, Var_Local_Mut_Init) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
     
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i64");
@@ -181,7 +181,7 @@ TEST_F(ParseDeclTest, Var_Local_Mut_Init) {
     EXPECT_TRUE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(VD->getInit());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(VD->getInit());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 0);
 
@@ -197,18 +197,18 @@ TEST_F(ParseDeclTest, Var_Local_Fix_Init) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i64");
@@ -216,7 +216,7 @@ TEST_F(ParseDeclTest, Var_Local_Fix_Init) {
     EXPECT_FALSE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(VD->getInit());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(VD->getInit());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 0);
 
@@ -232,18 +232,18 @@ TEST_F(ParseDeclTest, Var_Local_No_Type) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType(), nullptr);
@@ -251,7 +251,7 @@ TEST_F(ParseDeclTest, Var_Local_No_Type) {
     EXPECT_FALSE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(VD->getInit());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(VD->getInit());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 0);
 
@@ -267,18 +267,18 @@ TEST_F(ParseDeclTest, Var_Local_Nested_Array_Type) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i64[2][3]");
@@ -299,7 +299,7 @@ TEST_F(ParseDeclTest, Var_Global_Fix_Init) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(unit->getDecls()[0]);
+    VarDecl *VD = dyn_cast<VarDecl>(unit->getDecls()[0]);
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "global");
     EXPECT_EQ(VD->getType()->getName(), "i64");
@@ -307,7 +307,7 @@ TEST_F(ParseDeclTest, Var_Global_Fix_Init) {
     EXPECT_FALSE(VD->isMutable());
     EXPECT_TRUE(VD->isGlobal());
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(VD->getInit());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(VD->getInit());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 0);
 
@@ -324,7 +324,7 @@ TEST_F(ParseDeclTest, Var_Global_Mut_Init) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(unit->getDecls()[0]);
+    VarDecl *VD = dyn_cast<VarDecl>(unit->getDecls()[0]);
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "global");
     EXPECT_EQ(VD->getType()->getName(), "i64");
@@ -332,7 +332,7 @@ TEST_F(ParseDeclTest, Var_Global_Mut_Init) {
     EXPECT_TRUE(VD->isMutable());
     EXPECT_TRUE(VD->isGlobal());
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(VD->getInit());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(VD->getInit());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 0);
 
@@ -349,7 +349,7 @@ TEST_F(ParseDeclTest, Enum_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    EnumDecl *ED = dynamic_cast<EnumDecl *>(unit->getDecls()[0]);
+    EnumDecl *ED = dyn_cast<EnumDecl>(unit->getDecls()[0]);
     EXPECT_NE(ED, nullptr);
     EXPECT_EQ(ED->getName(), "Colors");
     EXPECT_EQ(ED->getDefinedType()->getName(), "Colors");
@@ -388,7 +388,7 @@ TEST_F(ParseDeclTest, Struct_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    StructDecl *SD = dynamic_cast<StructDecl *>(unit->getDecls()[0]);
+    StructDecl *SD = dyn_cast<StructDecl>(unit->getDecls()[0]);
     EXPECT_NE(SD, nullptr);
     EXPECT_EQ(SD->getName(), "box");
     EXPECT_EQ(SD->getFields().size(), 3);
@@ -411,7 +411,7 @@ TEST_F(ParseDeclTest, Struct_Basic) {
     EXPECT_NE(FD3->getInit(), nullptr);
     EXPECT_EQ(FD3->getParent(), SD);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(FD3->getInit());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(FD3->getInit());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 42);
 
@@ -428,7 +428,7 @@ TEST_F(ParseDeclTest, Struct_Methods_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    StructDecl *SD = dynamic_cast<StructDecl *>(unit->getDecls()[0]);
+    StructDecl *SD = dyn_cast<StructDecl>(unit->getDecls()[0]);
     EXPECT_NE(SD, nullptr);
     EXPECT_EQ(SD->getName(), "box");
     EXPECT_EQ(SD->getFunctions().size(), 1);
@@ -441,11 +441,11 @@ TEST_F(ParseDeclTest, Struct_Methods_Basic) {
     EXPECT_EQ(FD->getParent(), SD);
     EXPECT_EQ(FD->isMethod(), true);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FD->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FD->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
@@ -462,7 +462,7 @@ TEST_F(ParseDeclTest, Struct_Associated_Function_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    StructDecl *SD = dynamic_cast<StructDecl *>(unit->getDecls()[0]);
+    StructDecl *SD = dyn_cast<StructDecl>(unit->getDecls()[0]);
     EXPECT_NE(SD, nullptr);
     EXPECT_EQ(SD->getName(), "box");
     EXPECT_EQ(SD->getFunctions().size(), 1);
@@ -475,11 +475,11 @@ TEST_F(ParseDeclTest, Struct_Associated_Function_Basic) {
     EXPECT_EQ(FD->getParent(), SD);
     EXPECT_EQ(FD->isMethod(), false);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FD->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FD->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
@@ -496,7 +496,7 @@ TEST_F(ParseDeclTest, Struct_Method_Field_Ref) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    StructDecl *SD = dynamic_cast<StructDecl *>(unit->getDecls()[0]);
+    StructDecl *SD = dyn_cast<StructDecl>(unit->getDecls()[0]);
     EXPECT_NE(SD, nullptr);
     EXPECT_EQ(SD->getName(), "box");
     EXPECT_EQ(SD->getFunctions().size(), 1);
@@ -515,15 +515,15 @@ TEST_F(ParseDeclTest, Struct_Method_Field_Ref) {
     EXPECT_EQ(FD->getParent(), SD);
     EXPECT_EQ(FD->isMethod(), true);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FD->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FD->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_NE(RS->getExpr(), nullptr);
 
-    RefExpr *VRE = dynamic_cast<RefExpr *>(RS->getExpr());
+    RefExpr *VRE = dyn_cast<RefExpr>(RS->getExpr());
     EXPECT_NE(VRE, nullptr);
     EXPECT_EQ(VRE->getName(), "x");
     EXPECT_EQ(VRE->getRef(), FLD);
@@ -541,37 +541,37 @@ TEST_F(ParseDeclTest, Struct_Field_Access_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getInit(), nullptr);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
     EXPECT_NE(ES->getExpr(), nullptr);
 
-    BinaryExpr *BE = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BE = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BE, nullptr);
     EXPECT_NE(BE->getLHS(), nullptr);
     EXPECT_NE(BE->getRHS(), nullptr);
 
-    AccessExpr *AE = dynamic_cast<AccessExpr *>(BE->getLHS());
+    AccessExpr *AE = dyn_cast<AccessExpr>(BE->getLHS());
     EXPECT_NE(AE, nullptr);
     EXPECT_NE(AE->getBase(), nullptr);
     EXPECT_EQ(AE->getName(), "a");
 
-    RefExpr *VRE = dynamic_cast<RefExpr *>(AE->getBase());
+    RefExpr *VRE = dyn_cast<RefExpr>(AE->getBase());
     EXPECT_NE(VRE, nullptr);
     EXPECT_EQ(VRE->getName(), "x");
     EXPECT_EQ(VRE->getRef(), VD);
@@ -589,7 +589,7 @@ TEST_F(ParseDeclTest, Use_Anonymous) {
 
     EXPECT_EQ(unit->getUses().size(), 1);
 
-    UseDecl *UD = dynamic_cast<UseDecl *>(unit->getUses()[0]);
+    UseDecl *UD = dyn_cast<UseDecl>(unit->getUses()[0]);
     EXPECT_NE(UD, nullptr);
     EXPECT_EQ(UD->getPath(), "test");
     EXPECT_EQ(UD->getSymbols().size(), 0);
@@ -607,7 +607,7 @@ TEST_F(ParseDeclTest, Use_Named) {
 
     EXPECT_EQ(unit->getUses().size(), 1);
 
-    UseDecl *UD = dynamic_cast<UseDecl *>(unit->getUses()[0]);
+    UseDecl *UD = dyn_cast<UseDecl>(unit->getUses()[0]);
     EXPECT_NE(UD, nullptr);
     EXPECT_EQ(UD->getPath(), "test");
     EXPECT_EQ(UD->getName(), "Name");
@@ -627,7 +627,7 @@ TEST_F(ParseDeclTest, Use_List) {
 
     EXPECT_EQ(unit->getUses().size(), 1);
 
-    UseDecl *UD = dynamic_cast<UseDecl *>(unit->getUses()[0]);
+    UseDecl *UD = dyn_cast<UseDecl>(unit->getUses()[0]);
     EXPECT_NE(UD, nullptr);
     EXPECT_EQ(UD->getPath(), "test");
     EXPECT_EQ(UD->getName(), "");
@@ -649,7 +649,7 @@ TEST_F(ParseDeclTest, Template_Function) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FD = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FD = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FD, nullptr);
     EXPECT_EQ(FD->getName(), "foo");
     EXPECT_EQ(FD->getReturnType()->getName(), "T");
@@ -677,7 +677,7 @@ TEST_F(ParseDeclTest, Template_Struct) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    StructDecl *SD = dynamic_cast<StructDecl *>(unit->getDecls()[0]);
+    StructDecl *SD = dyn_cast<StructDecl>(unit->getDecls()[0]);
     EXPECT_NE(SD, nullptr);
     EXPECT_EQ(SD->getName(), "box");
     EXPECT_EQ(SD->getNumFields(), 1);
@@ -704,7 +704,7 @@ TEST_F(ParseDeclTest, Template_Struct_With_Method) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    StructDecl *SD = dynamic_cast<StructDecl *>(unit->getDecls()[0]);
+    StructDecl *SD = dyn_cast<StructDecl>(unit->getDecls()[0]);
     EXPECT_NE(SD, nullptr);
     EXPECT_EQ(SD->getName(), "box");
     EXPECT_EQ(SD->getNumFields(), 1);
@@ -727,6 +727,92 @@ TEST_F(ParseDeclTest, Template_Struct_With_Method) {
     delete unit;
 }
 
+TEST_F(ParseDeclTest, Function_Many_In_Scope) {
+    String src;
+    for (unsigned i = 0; i != 100; ++i)
+        src += "fn" + std::to_string(i) + " :: () i64 { ret " + 
+            std::to_string(i) + "; }\n";
+
+    File file = File("", "", "", src);
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+
+    Scope *scope = unit->getScope();
+    EXPECT_EQ(scope->getDecls().size(), 100);
+    for (unsigned i = 0; i != 100; ++i) {
+        NamedDecl *D = scope->lookup("fn" + std::to_string(i));
+        ASSERT_NE(D, nullptr);
+        EXPECT_EQ(D, unit->getDecls()[i]);
+    }
+
+    EXPECT_EQ(scope->lookup("fn100"), nullptr);
+    EXPECT_EQ(scope->lookup(Ident::get("fn42")), unit->getDecls()[42]);
+
+    delete unit;
+}
+
+#define FUNCTION_DUPLICATE R"(a :: () {} b :: () {} c :: () {} d :: () {} e :: () {} f :: () {} g :: () {} h :: () {} i :: () {} b :: () {})"
+TEST_F(ParseDeclTest, Function_Duplicate_In_Large_Scope) {
+    File file = File("", "", "", FUNCTION_DUPLICATE);
+    Lexer lexer = Lexer(file);
+    TokenStream stream = lexer.unwrap();
+    EXPECT_EXIT(Parser(file, stream), ::testing::ExitedWithCode(1), ".*");
+}
+
+#define FUNCTION_LAZY R"(a :: () i64 { if 1 { ret 1; } ret 2; } b<T> :: (x: T) T { ret x; } c :: { x: i64, get :: (self: c*) i64 { ret self.x; } })"
+TEST_F(ParseDeclTest, Function_Lazy_Bodies) {
+    Options opts = Options();
+    opts.LazyBodies = 1;
+
+    File file = File("", "", "", FUNCTION_LAZY);
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer, &opts);
+    TranslationUnit *unit = parser.get();
+
+    ASSERT_EQ(unit->getDecls().size(), 3);
+    auto *A = cast<FunctionDecl>(unit->getDecls()[0]);
+    auto *B = cast<FunctionDecl>(unit->getDecls()[1]);
+    auto *C = cast<StructDecl>(unit->getDecls()[2]);
+    ASSERT_EQ(C->getFunctions().size(), 1);
+    FunctionDecl *get = C->getFunctions()[0];
+
+    // Nothing past the braces of a body is looked at until it is needed.
+    EXPECT_TRUE(A->isBodyDeferred());
+    EXPECT_TRUE(B->isBodyDeferred());
+    EXPECT_TRUE(get->isBodyDeferred());
+    EXPECT_FALSE(A->empty());
+
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(A->getBody());
+    ASSERT_NE(CS, nullptr);
+    EXPECT_FALSE(A->isBodyDeferred());
+    EXPECT_EQ(CS->getStmts().size(), 2);
+    EXPECT_TRUE(isa<IfStmt>(CS->getStmts()[0]));
+    EXPECT_TRUE(isa<RetStmt>(CS->getStmts()[1]));
+    EXPECT_EQ(A->getBody(), CS);
+
+    // Bodies are parsed in the scope of their function.
+    CS = dyn_cast<CompoundStmt>(get->getBody());
+    ASSERT_NE(CS, nullptr);
+    auto *RS = dyn_cast<RetStmt>(CS->getStmts().at(0));
+    ASSERT_NE(RS, nullptr);
+    EXPECT_EQ(CS->getScope()->getParent(), get->getScope());
+    EXPECT_TRUE(B->isBodyDeferred());
+
+    delete unit;
+}
+
+#define FUNCTION_LAZY_UNTERMINATED R"(a :: () i64 { if 1 { ret 1; } ret 2;)"
+TEST_F(ParseDeclTest, Function_Lazy_Body_Unterminated) {
+    Options opts = Options();
+    opts.LazyBodies = 1;
+
+    File file = File("", "", "", FUNCTION_LAZY_UNTERMINATED);
+    Lexer lexer = Lexer(file);
+    EXPECT_EXIT(Parser(file, lexer, &opts), ::testing::ExitedWithCode(1), 
+        ".*");
+}
+
 } // namespace test
 
 } // namespace meddle
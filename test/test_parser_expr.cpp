@@ -24,18 +24,18 @@ TEST_F(ParseExprTest, IntLiteral_Basic_Init) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i32");
@@ -43,7 +43,7 @@ TEST_F(ParseExprTest, IntLiteral_Basic_Init) {
     EXPECT_TRUE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(VD->getInit());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(VD->getInit());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 5);
     EXPECT_EQ(I->getType()->getName(), "i64");
@@ -60,18 +60,18 @@ TEST_F(ParseExprTest, FPLiteral_Basic_Init) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "f32");
@@ -79,7 +79,7 @@ TEST_F(ParseExprTest, FPLiteral_Basic_Init) {
     EXPECT_TRUE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    FloatLiteral *F = dynamic_cast<FloatLiteral *>(VD->getInit());
+    FloatLiteral *F = dyn_cast<FloatLiteral>(VD->getInit());
     EXPECT_NE(F, nullptr);
     EXPECT_EQ(F->getValue(), 3.14);
     EXPECT_EQ(F->getType()->getName(), "f64");
@@ -96,18 +96,18 @@ TEST_F(ParseExprTest, CharLiteral_Basic_Init) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "char");
@@ -115,7 +115,7 @@ TEST_F(ParseExprTest, CharLiteral_Basic_Init) {
     EXPECT_TRUE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    CharLiteral *C = dynamic_cast<CharLiteral *>(VD->getInit());
+    CharLiteral *C = dyn_cast<CharLiteral>(VD->getInit());
     EXPECT_NE(C, nullptr);
     EXPECT_EQ(C->getValue(), 'a');
     EXPECT_EQ(C->getType()->getName(), "char");
@@ -133,29 +133,29 @@ TEST_F(ParseExprTest, StringLiteral_Basic_Init) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i32");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    CastExpr *CE = dynamic_cast<CastExpr *>(VD->getInit());
+    CastExpr *CE = dyn_cast<CastExpr>(VD->getInit());
     EXPECT_NE(CE, nullptr);
     EXPECT_EQ(CE->getType()->getName(), "i32");
     EXPECT_NE(CE->getExpr(), nullptr);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(CE->getExpr());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(CE->getExpr());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 5);
     EXPECT_EQ(I->getType()->getName(), "i64");
@@ -173,24 +173,24 @@ TEST_F(ParseExprTest, CastExpr_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
     
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "char[7]");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    StringLiteral *SL = dynamic_cast<StringLiteral *>(VD->getInit());
+    StringLiteral *SL = dyn_cast<StringLiteral>(VD->getInit());
     EXPECT_NE(SL, nullptr);
     EXPECT_EQ(SL->getValue(), "hello\n");
     EXPECT_EQ(SL->getType()->getName(), "char[7]");
@@ -207,18 +207,18 @@ TEST_F(ParseExprTest, RefExpr_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
     
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i64");
@@ -226,14 +226,14 @@ TEST_F(ParseExprTest, RefExpr_Basic) {
     EXPECT_TRUE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(VD->getInit());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(VD->getInit());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 0);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS->getStmts()[1]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS->getStmts()[1]);
     EXPECT_NE(RS, nullptr);
     
-    RefExpr *RE = dynamic_cast<RefExpr *>(RS->getExpr());
+    RefExpr *RE = dyn_cast<RefExpr>(RS->getExpr());
     EXPECT_NE(RE, nullptr);
     
     NamedDecl *ND = RE->getRef();
@@ -251,18 +251,18 @@ TEST_F(ParseExprTest, Nil_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i64*");
@@ -270,7 +270,7 @@ TEST_F(ParseExprTest, Nil_Basic) {
     EXPECT_FALSE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    NilLiteral *N = dynamic_cast<NilLiteral *>(VD->getInit());
+    NilLiteral *N = dyn_cast<NilLiteral>(VD->getInit());
     EXPECT_NE(N, nullptr);
     EXPECT_EQ(N->getType()->getName(), "void*");
 
@@ -286,18 +286,18 @@ TEST_F(ParseExprTest, Bool_Basic_True) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "bool");
@@ -305,7 +305,7 @@ TEST_F(ParseExprTest, Bool_Basic_True) {
     EXPECT_FALSE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    BoolLiteral *B = dynamic_cast<BoolLiteral *>(VD->getInit());
+    BoolLiteral *B = dyn_cast<BoolLiteral>(VD->getInit());
     EXPECT_NE(B, nullptr);
     EXPECT_EQ(B->getValue(), true);
 
@@ -321,18 +321,18 @@ TEST_F(ParseExprTest, Bool_Basic_False) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "bool");
@@ -340,7 +340,7 @@ TEST_F(ParseExprTest, Bool_Basic_False) {
     EXPECT_FALSE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    BoolLiteral *B = dynamic_cast<BoolLiteral *>(VD->getInit());
+    BoolLiteral *B = dyn_cast<BoolLiteral>(VD->getInit());
     EXPECT_NE(B, nullptr);
     EXPECT_EQ(B->getValue(), false);
 
@@ -356,18 +356,18 @@ TEST_F(ParseExprTest, Paren_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "bool");
@@ -375,10 +375,10 @@ TEST_F(ParseExprTest, Paren_Basic) {
     EXPECT_FALSE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    ParenExpr *PE = dynamic_cast<ParenExpr *>(VD->getInit());
+    ParenExpr *PE = dyn_cast<ParenExpr>(VD->getInit());
     EXPECT_NE(PE, nullptr);
     
-    BoolLiteral *B = dynamic_cast<BoolLiteral *>(PE->getExpr());
+    BoolLiteral *B = dyn_cast<BoolLiteral>(PE->getExpr());
     EXPECT_NE(B, nullptr);
     
     delete unit;
@@ -393,18 +393,18 @@ TEST_F(ParseExprTest, Sizeof_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i32");
@@ -412,7 +412,7 @@ TEST_F(ParseExprTest, Sizeof_Basic) {
     EXPECT_FALSE(VD->isMutable());
     EXPECT_FALSE(VD->isGlobal());
 
-    SizeofExpr *SE = dynamic_cast<SizeofExpr *>(VD->getInit());
+    SizeofExpr *SE = dyn_cast<SizeofExpr>(VD->getInit());
     EXPECT_NE(SE, nullptr);
     EXPECT_NE(SE->getTarget(), nullptr);
     EXPECT_EQ(SE->getTarget()->getName(), "i32");
@@ -429,27 +429,27 @@ TEST_F(ParseExprTest, Binary_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -464,27 +464,27 @@ TEST_F(ParseExprTest, Binary_Add_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Add_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -499,27 +499,27 @@ TEST_F(ParseExprTest, Binary_Sub_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Sub_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -534,27 +534,27 @@ TEST_F(ParseExprTest, Binary_Mul_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Mul_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -569,27 +569,27 @@ TEST_F(ParseExprTest, Binary_Div_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Div_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -604,27 +604,27 @@ TEST_F(ParseExprTest, Binary_Mod_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Mod_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -639,27 +639,27 @@ TEST_F(ParseExprTest, Binary_And_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::And_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -674,27 +674,27 @@ TEST_F(ParseExprTest, Binary_Or_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Or_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -709,27 +709,27 @@ TEST_F(ParseExprTest, Binary_Xor_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Xor_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -744,27 +744,27 @@ TEST_F(ParseExprTest, Binary_LS_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::LeftShift_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -779,27 +779,27 @@ TEST_F(ParseExprTest, Binary_RS_Assign) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::RightShift_Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -814,27 +814,27 @@ TEST_F(ParseExprTest, Binary_Equals) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Equals);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -849,27 +849,27 @@ TEST_F(ParseExprTest, Binary_NEquals) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::NEquals);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -884,27 +884,27 @@ TEST_F(ParseExprTest, Binary_LessThan) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::LessThan);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -919,27 +919,27 @@ TEST_F(ParseExprTest, Binary_LessThanEquals) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::LessThanEquals);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -954,27 +954,27 @@ TEST_F(ParseExprTest, Binary_GreaterThan) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::GreaterThan);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -989,27 +989,27 @@ TEST_F(ParseExprTest, Binary_GreaterThanEquals) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
     
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::GreaterThanEquals);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1024,27 +1024,27 @@ TEST_F(ParseExprTest, Binary_Add) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
     
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Add);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1059,27 +1059,27 @@ TEST_F(ParseExprTest, Binary_Sub) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Sub);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1094,27 +1094,27 @@ TEST_F(ParseExprTest, Binary_Mul) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Mul);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1129,27 +1129,27 @@ TEST_F(ParseExprTest, Binary_Div) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Div);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1164,27 +1164,27 @@ TEST_F(ParseExprTest, Binary_Mod) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Mod);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1199,27 +1199,27 @@ TEST_F(ParseExprTest, Binary_And) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Bitwise_And);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1234,27 +1234,27 @@ TEST_F(ParseExprTest, Binary_Or) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Bitwise_Or);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1269,27 +1269,27 @@ TEST_F(ParseExprTest, Binary_Xor) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Bitwise_Xor);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1304,27 +1304,27 @@ TEST_F(ParseExprTest, Binary_LS) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::LeftShift);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1339,27 +1339,27 @@ TEST_F(ParseExprTest, Binary_RS) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::RightShift);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1374,27 +1374,27 @@ TEST_F(ParseExprTest, Binary_Logic_And) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Logic_And);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1409,27 +1409,27 @@ TEST_F(ParseExprTest, Binary_Logic_Or) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Logic_Or);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(BS->getRHS());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1444,36 +1444,36 @@ TEST_F(ParseExprTest, Binary_Precedence_Bedmas_One) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Add);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
 
-    BinaryExpr *RHS = dynamic_cast<BinaryExpr *>(BS->getRHS());
+    BinaryExpr *RHS = dyn_cast<BinaryExpr>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
     EXPECT_NE(RHS->getLHS(), nullptr);
     EXPECT_NE(RHS->getRHS(), nullptr);
     EXPECT_EQ(RHS->getKind(), BinaryExpr::Kind::Mul);
 
-    IntegerLiteral *RHS_LHS = dynamic_cast<IntegerLiteral *>(RHS->getLHS());
+    IntegerLiteral *RHS_LHS = dyn_cast<IntegerLiteral>(RHS->getLHS());
     EXPECT_NE(RHS_LHS, nullptr);
 
-    IntegerLiteral *RHS_RHS = dynamic_cast<IntegerLiteral *>(RHS->getRHS());
+    IntegerLiteral *RHS_RHS = dyn_cast<IntegerLiteral>(RHS->getRHS());
     EXPECT_NE(RHS_RHS, nullptr);
 
     delete unit;
@@ -1488,42 +1488,42 @@ TEST_F(ParseExprTest, Binary_Precedence_Bedmas_Two) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *addExpr = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *addExpr = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(addExpr, nullptr);
     EXPECT_EQ(addExpr->getKind(), BinaryExpr::Kind::Add);
 
-    RefExpr *lhs = dynamic_cast<RefExpr *>(addExpr->getLHS());
+    RefExpr *lhs = dyn_cast<RefExpr>(addExpr->getLHS());
     EXPECT_NE(lhs, nullptr);
     EXPECT_EQ(lhs->getName(), "x");
 
-    BinaryExpr *divExpr = dynamic_cast<BinaryExpr *>(addExpr->getRHS());
+    BinaryExpr *divExpr = dyn_cast<BinaryExpr>(addExpr->getRHS());
     EXPECT_NE(divExpr, nullptr);
     EXPECT_EQ(divExpr->getKind(), BinaryExpr::Kind::Div);
 
-    BinaryExpr *mulExpr = dynamic_cast<BinaryExpr *>(divExpr->getLHS());
+    BinaryExpr *mulExpr = dyn_cast<BinaryExpr>(divExpr->getLHS());
     EXPECT_NE(mulExpr, nullptr);
     EXPECT_EQ(mulExpr->getKind(), BinaryExpr::Kind::Mul);
 
-    IntegerLiteral *mulLHS = dynamic_cast<IntegerLiteral *>(mulExpr->getLHS());
+    IntegerLiteral *mulLHS = dyn_cast<IntegerLiteral>(mulExpr->getLHS());
     EXPECT_NE(mulLHS, nullptr);
     EXPECT_EQ(mulLHS->getValue(), 1);
 
-    IntegerLiteral *mulRHS = dynamic_cast<IntegerLiteral *>(mulExpr->getRHS());
+    IntegerLiteral *mulRHS = dyn_cast<IntegerLiteral>(mulExpr->getRHS());
     EXPECT_NE(mulRHS, nullptr);
     EXPECT_EQ(mulRHS->getValue(), 2);
 
-    IntegerLiteral *divRHS = dynamic_cast<IntegerLiteral *>(divExpr->getRHS());
+    IntegerLiteral *divRHS = dyn_cast<IntegerLiteral>(divExpr->getRHS());
     EXPECT_NE(divRHS, nullptr);
     EXPECT_EQ(divRHS->getValue(), 3);
 
@@ -1539,49 +1539,49 @@ TEST_F(ParseExprTest, Binary_Precedence_Bedmas_Three) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Add);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
     EXPECT_EQ(LHS->getName(), "x");
 
-    BinaryExpr *RHS = dynamic_cast<BinaryExpr *>(BS->getRHS());
+    BinaryExpr *RHS = dyn_cast<BinaryExpr>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
     EXPECT_EQ(RHS->getKind(), BinaryExpr::Kind::Mod);
 
-    BinaryExpr *MOD_LHS = dynamic_cast<BinaryExpr *>(RHS->getLHS());
+    BinaryExpr *MOD_LHS = dyn_cast<BinaryExpr>(RHS->getLHS());
     EXPECT_NE(MOD_LHS, nullptr);
     EXPECT_EQ(MOD_LHS->getKind(), BinaryExpr::Kind::Div);
 
-    BinaryExpr *DIV_LHS = dynamic_cast<BinaryExpr *>(MOD_LHS->getLHS());
+    BinaryExpr *DIV_LHS = dyn_cast<BinaryExpr>(MOD_LHS->getLHS());
     EXPECT_NE(DIV_LHS, nullptr);
     EXPECT_EQ(DIV_LHS->getKind(), BinaryExpr::Kind::Mul);
 
-    IntegerLiteral *MUL_LHS = dynamic_cast<IntegerLiteral *>(DIV_LHS->getLHS());
+    IntegerLiteral *MUL_LHS = dyn_cast<IntegerLiteral>(DIV_LHS->getLHS());
     EXPECT_NE(MUL_LHS, nullptr);
     EXPECT_EQ(MUL_LHS->getValue(), 1);
 
-    IntegerLiteral *MUL_RHS = dynamic_cast<IntegerLiteral *>(DIV_LHS->getRHS());
+    IntegerLiteral *MUL_RHS = dyn_cast<IntegerLiteral>(DIV_LHS->getRHS());
     EXPECT_NE(MUL_RHS, nullptr);
     EXPECT_EQ(MUL_RHS->getValue(), 2);
 
-    IntegerLiteral *DIV_RHS = dynamic_cast<IntegerLiteral *>(MOD_LHS->getRHS());
+    IntegerLiteral *DIV_RHS = dyn_cast<IntegerLiteral>(MOD_LHS->getRHS());
     EXPECT_NE(DIV_RHS, nullptr);
     EXPECT_EQ(DIV_RHS->getValue(), 3);
 
-    IntegerLiteral *MOD_RHS = dynamic_cast<IntegerLiteral *>(RHS->getRHS());
+    IntegerLiteral *MOD_RHS = dyn_cast<IntegerLiteral>(RHS->getRHS());
     EXPECT_NE(MOD_RHS, nullptr);
     EXPECT_EQ(MOD_RHS->getValue(), 4);
 
@@ -1597,67 +1597,67 @@ TEST_F(ParseExprTest, Binary_Precedence_Bedmas_Four) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
     
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Add);
     EXPECT_NE(BS->getLHS(), nullptr);
     EXPECT_NE(BS->getRHS(), nullptr);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
     EXPECT_EQ(LHS->getName(), "x");
 
-    BinaryExpr *RHS = dynamic_cast<BinaryExpr *>(BS->getRHS());
+    BinaryExpr *RHS = dyn_cast<BinaryExpr>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
     EXPECT_EQ(RHS->getKind(), BinaryExpr::Kind::Add);
     EXPECT_NE(RHS->getLHS(), nullptr);
     EXPECT_NE(RHS->getRHS(), nullptr);
 
-    BinaryExpr *ADD_LHS = dynamic_cast<BinaryExpr *>(RHS->getLHS());
+    BinaryExpr *ADD_LHS = dyn_cast<BinaryExpr>(RHS->getLHS());
     EXPECT_NE(ADD_LHS, nullptr);
     EXPECT_EQ(ADD_LHS->getKind(), BinaryExpr::Kind::Mod);
     EXPECT_NE(ADD_LHS->getLHS(), nullptr);
     EXPECT_NE(ADD_LHS->getRHS(), nullptr);
 
-    BinaryExpr *MOD_LHS = dynamic_cast<BinaryExpr *>(ADD_LHS->getLHS());
+    BinaryExpr *MOD_LHS = dyn_cast<BinaryExpr>(ADD_LHS->getLHS());
     EXPECT_NE(MOD_LHS, nullptr);
     EXPECT_EQ(MOD_LHS->getKind(), BinaryExpr::Kind::Div);
     EXPECT_NE(MOD_LHS->getLHS(), nullptr);
     EXPECT_NE(MOD_LHS->getRHS(), nullptr);
 
-    BinaryExpr *DIV_LHS = dynamic_cast<BinaryExpr *>(MOD_LHS->getLHS());
+    BinaryExpr *DIV_LHS = dyn_cast<BinaryExpr>(MOD_LHS->getLHS());
     EXPECT_NE(DIV_LHS, nullptr);
     EXPECT_EQ(DIV_LHS->getKind(), BinaryExpr::Kind::Mul);
     EXPECT_NE(DIV_LHS->getLHS(), nullptr);
     EXPECT_NE(DIV_LHS->getRHS(), nullptr);
 
-    IntegerLiteral *MUL_LHS = dynamic_cast<IntegerLiteral *>(DIV_LHS->getLHS());
+    IntegerLiteral *MUL_LHS = dyn_cast<IntegerLiteral>(DIV_LHS->getLHS());
     EXPECT_NE(MUL_LHS, nullptr);
     EXPECT_EQ(MUL_LHS->getValue(), 1);
 
-    IntegerLiteral *MUL_RHS = dynamic_cast<IntegerLiteral *>(DIV_LHS->getRHS());
+    IntegerLiteral *MUL_RHS = dyn_cast<IntegerLiteral>(DIV_LHS->getRHS());
     EXPECT_NE(MUL_RHS, nullptr);
     EXPECT_EQ(MUL_RHS->getValue(), 2);
 
-    IntegerLiteral *DIV_RHS = dynamic_cast<IntegerLiteral *>(MOD_LHS->getRHS());
+    IntegerLiteral *DIV_RHS = dyn_cast<IntegerLiteral>(MOD_LHS->getRHS());
     EXPECT_NE(DIV_RHS, nullptr);
     EXPECT_EQ(DIV_RHS->getValue(), 3);
 
-    IntegerLiteral *MOD_RHS = dynamic_cast<IntegerLiteral *>(ADD_LHS->getRHS());
+    IntegerLiteral *MOD_RHS = dyn_cast<IntegerLiteral>(ADD_LHS->getRHS());
     EXPECT_NE(MOD_RHS, nullptr);
     EXPECT_EQ(MOD_RHS->getValue(), 4);
 
-    IntegerLiteral *ADD_RHS = dynamic_cast<IntegerLiteral *>(RHS->getRHS());
+    IntegerLiteral *ADD_RHS = dyn_cast<IntegerLiteral>(RHS->getRHS());
     EXPECT_NE(ADD_RHS, nullptr);
     EXPECT_EQ(ADD_RHS->getValue(), 5);
     
@@ -1673,33 +1673,33 @@ TEST_F(ParseExprTest, Binary_Precedence_Assignment_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BS = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BS = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BS, nullptr);
     EXPECT_EQ(BS->getKind(), BinaryExpr::Kind::Assign);
 
-    RefExpr *LHS = dynamic_cast<RefExpr *>(BS->getLHS());
+    RefExpr *LHS = dyn_cast<RefExpr>(BS->getLHS());
     EXPECT_NE(LHS, nullptr);
     EXPECT_EQ(LHS->getName(), "x");
 
-    BinaryExpr *RHS = dynamic_cast<BinaryExpr *>(BS->getRHS());
+    BinaryExpr *RHS = dyn_cast<BinaryExpr>(BS->getRHS());
     EXPECT_NE(RHS, nullptr);
     EXPECT_EQ(RHS->getKind(), BinaryExpr::Kind::Add);
 
-    IntegerLiteral *RHS_LHS = dynamic_cast<IntegerLiteral *>(RHS->getLHS());
+    IntegerLiteral *RHS_LHS = dyn_cast<IntegerLiteral>(RHS->getLHS());
     EXPECT_NE(RHS_LHS, nullptr);
     EXPECT_EQ(RHS_LHS->getValue(), 1);
 
-    IntegerLiteral *RHS_RHS = dynamic_cast<IntegerLiteral *>(RHS->getRHS());
+    IntegerLiteral *RHS_RHS = dyn_cast<IntegerLiteral>(RHS->getRHS());
     EXPECT_NE(RHS_RHS, nullptr);
     EXPECT_EQ(RHS_RHS->getValue(), 2);
 
@@ -1715,23 +1715,23 @@ TEST_F(ParseExprTest, Unary_Prefix_Neg) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    IntegerLiteral *INT = dynamic_cast<IntegerLiteral *>(VD->getInit());
+    IntegerLiteral *INT = dyn_cast<IntegerLiteral>(VD->getInit());
     EXPECT_NE(INT, nullptr);
     EXPECT_EQ(INT->getValue(), -5);
 
@@ -1747,28 +1747,28 @@ TEST_F(ParseExprTest, Unary_Prefix_Bitwise_Not) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    UnaryExpr *US = dynamic_cast<UnaryExpr *>(VD->getInit());
+    UnaryExpr *US = dyn_cast<UnaryExpr>(VD->getInit());
     EXPECT_NE(US, nullptr);
     EXPECT_EQ(US->getKind(), UnaryExpr::Kind::Bitwise_Not);
     EXPECT_EQ(US->isPostfix(), false);
 
-    IntegerLiteral *RHS = dynamic_cast<IntegerLiteral *>(US->getExpr());
+    IntegerLiteral *RHS = dyn_cast<IntegerLiteral>(US->getExpr());
     EXPECT_NE(RHS, nullptr);
 
     delete unit;
@@ -1783,31 +1783,31 @@ TEST_F(ParseExprTest, Unary_Prefix_Logical_Not) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    DeclStmt *DS2 = dynamic_cast<DeclStmt *>(CS->getStmts()[1]);
+    DeclStmt *DS2 = dyn_cast<DeclStmt>(CS->getStmts()[1]);
     EXPECT_NE(DS2, nullptr);
 
-    VarDecl *VD2 = dynamic_cast<VarDecl *>(DS2->getDecl());
+    VarDecl *VD2 = dyn_cast<VarDecl>(DS2->getDecl());
     EXPECT_NE(VD2, nullptr);
     EXPECT_EQ(VD2->getName(), "y");
     EXPECT_NE(VD2->getInit(), nullptr);
 
-    UnaryExpr *UN = dynamic_cast<UnaryExpr *>(VD2->getInit());
+    UnaryExpr *UN = dyn_cast<UnaryExpr>(VD2->getInit());
     EXPECT_NE(UN, nullptr);
     EXPECT_EQ(UN->getKind(), UnaryExpr::Kind::Logic_Not);
     EXPECT_EQ(UN->isPostfix(), false);
@@ -1824,31 +1824,31 @@ TEST_F(ParseExprTest, Unary_Prefix_Address_Of) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    DeclStmt *DS2 = dynamic_cast<DeclStmt *>(CS->getStmts()[1]);
+    DeclStmt *DS2 = dyn_cast<DeclStmt>(CS->getStmts()[1]);
     EXPECT_NE(DS2, nullptr);
 
-    VarDecl *VD2 = dynamic_cast<VarDecl *>(DS2->getDecl());
+    VarDecl *VD2 = dyn_cast<VarDecl>(DS2->getDecl());
     EXPECT_NE(VD2, nullptr);
     EXPECT_EQ(VD2->getName(), "y");
     EXPECT_NE(VD2->getInit(), nullptr);
 
-    UnaryExpr *UN = dynamic_cast<UnaryExpr *>(VD2->getInit());
+    UnaryExpr *UN = dyn_cast<UnaryExpr>(VD2->getInit());
     EXPECT_NE(UN, nullptr);
     EXPECT_EQ(UN->getKind(), UnaryExpr::Kind::Address_Of);
     EXPECT_EQ(UN->isPostfix(), false);
@@ -1865,31 +1865,31 @@ TEST_F(ParseExprTest, Unary_Prefix_Dereference_LValue) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BE = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BE = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BE, nullptr);
     EXPECT_NE(BE->getLHS(), nullptr);
     EXPECT_NE(BE->getRHS(), nullptr);
 
-    UnaryExpr *UN = dynamic_cast<UnaryExpr *>(BE->getLHS());
+    UnaryExpr *UN = dyn_cast<UnaryExpr>(BE->getLHS());
     EXPECT_NE(UN, nullptr);
     EXPECT_EQ(UN->getKind(), UnaryExpr::Kind::Dereference);
     EXPECT_EQ(UN->isPostfix(), false);
@@ -1906,31 +1906,31 @@ TEST_F(ParseExprTest, Unary_Prefix_Dereference_RValue) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    DeclStmt *DS2 = dynamic_cast<DeclStmt *>(CS->getStmts()[1]);
+    DeclStmt *DS2 = dyn_cast<DeclStmt>(CS->getStmts()[1]);
     EXPECT_NE(DS2, nullptr);
 
-    VarDecl *VD2 = dynamic_cast<VarDecl *>(DS2->getDecl());
+    VarDecl *VD2 = dyn_cast<VarDecl>(DS2->getDecl());
     EXPECT_NE(VD2, nullptr);
     EXPECT_EQ(VD2->getName(), "y");
     EXPECT_NE(VD2->getInit(), nullptr);
 
-    UnaryExpr *UN = dynamic_cast<UnaryExpr *>(VD2->getInit());
+    UnaryExpr *UN = dyn_cast<UnaryExpr>(VD2->getInit());
     EXPECT_NE(UN, nullptr);
     EXPECT_EQ(UN->getKind(), UnaryExpr::Kind::Dereference);
     EXPECT_EQ(UN->isPostfix(), false);
@@ -1947,26 +1947,26 @@ TEST_F(ParseExprTest, Unary_Prefix_Increment) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    UnaryExpr *UN = dynamic_cast<UnaryExpr *>(ES->getExpr());
+    UnaryExpr *UN = dyn_cast<UnaryExpr>(ES->getExpr());
     EXPECT_NE(UN, nullptr);
     EXPECT_EQ(UN->getKind(), UnaryExpr::Kind::Increment);
     EXPECT_EQ(UN->isPostfix(), false);
@@ -1983,26 +1983,26 @@ TEST_F(ParseExprTest, Unary_Prefix_Decrement) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    UnaryExpr *UN = dynamic_cast<UnaryExpr *>(ES->getExpr());
+    UnaryExpr *UN = dyn_cast<UnaryExpr>(ES->getExpr());
     EXPECT_NE(UN, nullptr);
     EXPECT_EQ(UN->getKind(), UnaryExpr::Kind::Decrement);
     EXPECT_EQ(UN->isPostfix(), false);
@@ -2019,26 +2019,26 @@ TEST_F(ParseExprTest, Unary_Postfix_Increment) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    UnaryExpr *UN = dynamic_cast<UnaryExpr *>(ES->getExpr());
+    UnaryExpr *UN = dyn_cast<UnaryExpr>(ES->getExpr());
     EXPECT_NE(UN, nullptr);
     EXPECT_EQ(UN->getKind(), UnaryExpr::Kind::Increment);
     EXPECT_EQ(UN->isPostfix(), true);
@@ -2055,26 +2055,26 @@ TEST_F(ParseExprTest, Unary_Postfix_Decrement) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    UnaryExpr *UN = dynamic_cast<UnaryExpr *>(ES->getExpr());
+    UnaryExpr *UN = dyn_cast<UnaryExpr>(ES->getExpr());
     EXPECT_NE(UN, nullptr);
     EXPECT_EQ(UN->getKind(), UnaryExpr::Kind::Decrement);
     EXPECT_EQ(UN->isPostfix(), true);
@@ -2091,33 +2091,33 @@ TEST_F(ParseExprTest, Unary_Prefix_Deref_Postfix_Inc) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    BinaryExpr *BE = dynamic_cast<BinaryExpr *>(ES->getExpr());
+    BinaryExpr *BE = dyn_cast<BinaryExpr>(ES->getExpr());
     EXPECT_NE(BE, nullptr);
     EXPECT_NE(BE->getLHS(), nullptr);
     EXPECT_NE(BE->getRHS(), nullptr);
 
-    UnaryExpr *US = dynamic_cast<UnaryExpr *>(BE->getLHS());
+    UnaryExpr *US = dyn_cast<UnaryExpr>(BE->getLHS());
     EXPECT_NE(US, nullptr);
     EXPECT_EQ(US->getKind(), UnaryExpr::Kind::Dereference);
     EXPECT_EQ(US->isPostfix(), false);
 
-    UnaryExpr *US2 = dynamic_cast<UnaryExpr *>(US->getExpr());
+    UnaryExpr *US2 = dyn_cast<UnaryExpr>(US->getExpr());
     EXPECT_NE(US2, nullptr);
     EXPECT_EQ(US2->getKind(), UnaryExpr::Kind::Increment);
     EXPECT_EQ(US2->isPostfix(), true);
 
-    RefExpr *RE = dynamic_cast<RefExpr *>(US2->getExpr());
+    RefExpr *RE = dyn_cast<RefExpr>(US2->getExpr());
     EXPECT_NE(RE, nullptr);
 
     delete unit;
@@ -2132,35 +2132,35 @@ TEST_F(ParseExprTest, Array_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    ArrayExpr *AL = dynamic_cast<ArrayExpr *>(VD->getInit());
+    ArrayExpr *AL = dyn_cast<ArrayExpr>(VD->getInit());
     EXPECT_NE(AL, nullptr);
     EXPECT_EQ(AL->getElements().size(), 3);
 
-    IntegerLiteral *IL1 = dynamic_cast<IntegerLiteral *>(AL->getElements()[0]);
+    IntegerLiteral *IL1 = dyn_cast<IntegerLiteral>(AL->getElements()[0]);
     EXPECT_NE(IL1, nullptr);
     EXPECT_EQ(IL1->getValue(), 1);
 
-    IntegerLiteral *IL2 = dynamic_cast<IntegerLiteral *>(AL->getElements()[1]);
+    IntegerLiteral *IL2 = dyn_cast<IntegerLiteral>(AL->getElements()[1]);
     EXPECT_NE(IL2, nullptr);
     EXPECT_EQ(IL2->getValue(), 2);
 
-    IntegerLiteral *IL3 = dynamic_cast<IntegerLiteral *>(AL->getElements()[2]);
+    IntegerLiteral *IL3 = dyn_cast<IntegerLiteral>(AL->getElements()[2]);
     EXPECT_NE(IL3, nullptr);
     EXPECT_EQ(IL3->getValue(), 3);
 
@@ -2176,34 +2176,34 @@ TEST_F(ParseExprTest, Subscript_Ref_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    SubscriptExpr *SE = dynamic_cast<SubscriptExpr *>(ES->getExpr());
+    SubscriptExpr *SE = dyn_cast<SubscriptExpr>(ES->getExpr());
     EXPECT_NE(SE, nullptr);
     EXPECT_NE(SE->getBase(), nullptr);
     EXPECT_NE(SE->getIndex(), nullptr);
 
-    RefExpr *RE = dynamic_cast<RefExpr *>(SE->getBase());
+    RefExpr *RE = dyn_cast<RefExpr>(SE->getBase());
     EXPECT_NE(RE, nullptr);
     
-    IntegerLiteral *IL = dynamic_cast<IntegerLiteral *>(SE->getIndex());
+    IntegerLiteral *IL = dyn_cast<IntegerLiteral>(SE->getIndex());
     EXPECT_NE(IL, nullptr);
     
     delete unit;
@@ -2218,25 +2218,25 @@ TEST_F(ParseExprTest, Call_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[0]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[0]);
     EXPECT_NE(ES, nullptr);
 
-    CallExpr *CE = dynamic_cast<CallExpr *>(ES->getExpr());
+    CallExpr *CE = dyn_cast<CallExpr>(ES->getExpr());
     EXPECT_NE(CE, nullptr);
     EXPECT_EQ(CE->getArgs().size(), 2); 
 
-    IntegerLiteral *IL1 = dynamic_cast<IntegerLiteral *>(CE->getArgs()[0]);
+    IntegerLiteral *IL1 = dyn_cast<IntegerLiteral>(CE->getArgs()[0]);
     EXPECT_NE(IL1, nullptr);
     
-    IntegerLiteral *IL2 = dynamic_cast<IntegerLiteral *>(CE->getArgs()[1]);
+    IntegerLiteral *IL2 = dyn_cast<IntegerLiteral>(CE->getArgs()[1]);
     EXPECT_NE(IL2, nullptr);
 
     delete unit;
@@ -2251,24 +2251,24 @@ TEST_F(ParseExprTest, Spec_Enum_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 2);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[1]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[1]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
     EXPECT_EQ(VD->getType()->getName(), "Colors");
 
-    RefExpr *RE = dynamic_cast<RefExpr *>(VD->getInit());
+    RefExpr *RE = dyn_cast<RefExpr>(VD->getInit());
     EXPECT_EQ(RE->getName(), "COLORS_RED");
     
     delete unit;
@@ -2283,27 +2283,61 @@ TEST_F(ParseExprTest, Spec_Struct_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 2);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[1]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[1]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    TypeSpecExpr *SP = dynamic_cast<TypeSpecExpr *>(VD->getInit());
+    TypeSpecExpr *SP = dyn_cast<TypeSpecExpr>(VD->getInit());
     EXPECT_NE(SP, nullptr);
     EXPECT_EQ(SP->getName(), "Color");
 
-    CallExpr *CE = dynamic_cast<CallExpr *>(SP->getExpr());
+    CallExpr *CE = dyn_cast<CallExpr>(SP->getExpr());
+    EXPECT_NE(CE, nullptr);
+    
+    delete unit;
+}
+
+#define SPEC_STRUCT_FORWARD R"(test :: () { mut x: i64 = Color::foo(); } Color :: { x: i64, foo :: () i64 { ret 42; } })"
+TEST_F(ParseExprTest, Spec_Struct_Forward) {
+    File file = File("", "", "", SPEC_STRUCT_FORWARD);
+    Lexer lexer = Lexer(file);
+    TokenStream stream = lexer.unwrap();
+    Parser parser = Parser(file, stream);
+    TranslationUnit *unit = parser.get();
+
+    EXPECT_EQ(unit->getDecls().size(), 2);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
+    EXPECT_NE(FN, nullptr);
+    EXPECT_NE(FN->getBody(), nullptr);
+
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
+    EXPECT_NE(CS, nullptr);
+    EXPECT_EQ(CS->getStmts().size(), 1);
+
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
+    EXPECT_NE(DS, nullptr);
+
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
+    EXPECT_NE(VD, nullptr);
+    EXPECT_NE(VD->getInit(), nullptr);
+
+    TypeSpecExpr *SP = dyn_cast<TypeSpecExpr>(VD->getInit());
+    EXPECT_NE(SP, nullptr);
+    EXPECT_EQ(SP->getName(), "Color");
+
+    CallExpr *CE = dyn_cast<CallExpr>(SP->getExpr());
     EXPECT_NE(CE, nullptr);
     
     delete unit;
@@ -2318,23 +2352,23 @@ TEST_F(ParseExprTest, Method_Call_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
 
-    MethodCallExpr *MEC = dynamic_cast<MethodCallExpr *>(ES->getExpr());
+    MethodCallExpr *MEC = dyn_cast<MethodCallExpr>(ES->getExpr());
     EXPECT_NE(MEC, nullptr);
     EXPECT_NE(MEC->getBase(), nullptr);
     EXPECT_EQ(MEC->getName(), "foo");
 
-    RefExpr *RE = dynamic_cast<RefExpr *>(MEC->getBase());
+    RefExpr *RE = dyn_cast<RefExpr>(MEC->getBase());
     EXPECT_NE(RE, nullptr);
     EXPECT_EQ(RE->getName(), "x");
 
@@ -2350,39 +2384,39 @@ TEST_F(ParseExprTest, Struct_Init_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    InitExpr *IE = dynamic_cast<InitExpr *>(VD->getInit());
+    InitExpr *IE = dyn_cast<InitExpr>(VD->getInit());
     EXPECT_NE(IE, nullptr);
     EXPECT_EQ(IE->getFields().size(), 2);
 
-    FieldInitExpr *F1 = dynamic_cast<FieldInitExpr *>(IE->getFields()[0]);
+    FieldInitExpr *F1 = dyn_cast<FieldInitExpr>(IE->getFields()[0]);
     EXPECT_NE(F1, nullptr);
     EXPECT_EQ(F1->getName(), "a");
 
-    IntegerLiteral *IL1 = dynamic_cast<IntegerLiteral *>(F1->getExpr());
+    IntegerLiteral *IL1 = dyn_cast<IntegerLiteral>(F1->getExpr());
     EXPECT_NE(IL1, nullptr);
     EXPECT_EQ(IL1->getValue(), 1);
 
-    FieldInitExpr *F2 = dynamic_cast<FieldInitExpr *>(IE->getFields()[1]);
+    FieldInitExpr *F2 = dyn_cast<FieldInitExpr>(IE->getFields()[1]);
     EXPECT_NE(F2, nullptr);
     EXPECT_EQ(F2->getName(), "b");
 
-    IntegerLiteral *IL2 = dynamic_cast<IntegerLiteral *>(F2->getExpr());
+    IntegerLiteral *IL2 = dyn_cast<IntegerLiteral>(F2->getExpr());
     EXPECT_NE(IL2, nullptr);
     EXPECT_EQ(IL2->getValue(), 2);
     
@@ -2398,51 +2432,51 @@ TEST_F(ParseExprTest, Struct_Nested_Array_Init) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 2);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[1]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[1]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    InitExpr *IE = dynamic_cast<InitExpr *>(VD->getInit());
+    InitExpr *IE = dyn_cast<InitExpr>(VD->getInit());
     EXPECT_NE(IE, nullptr);
     EXPECT_EQ(IE->getFields().size(), 2);
 
-    FieldInitExpr *F1 = dynamic_cast<FieldInitExpr *>(IE->getFields()[0]);
+    FieldInitExpr *F1 = dyn_cast<FieldInitExpr>(IE->getFields()[0]);
     EXPECT_NE(F1, nullptr);
     EXPECT_EQ(F1->getName(), "x");
 
-    ArrayExpr *AE = dynamic_cast<ArrayExpr *>(F1->getExpr());
+    ArrayExpr *AE = dyn_cast<ArrayExpr>(F1->getExpr());
     EXPECT_NE(AE, nullptr);
     EXPECT_EQ(AE->getElements().size(), 3);
 
-    IntegerLiteral *IL1 = dynamic_cast<IntegerLiteral *>(AE->getElements()[0]);
+    IntegerLiteral *IL1 = dyn_cast<IntegerLiteral>(AE->getElements()[0]);
     EXPECT_NE(IL1, nullptr);
     EXPECT_EQ(IL1->getValue(), 1);
 
-    IntegerLiteral *IL2 = dynamic_cast<IntegerLiteral *>(AE->getElements()[1]);
+    IntegerLiteral *IL2 = dyn_cast<IntegerLiteral>(AE->getElements()[1]);
     EXPECT_NE(IL2, nullptr);
     EXPECT_EQ(IL2->getValue(), 2);
 
-    IntegerLiteral *IL3 = dynamic_cast<IntegerLiteral *>(AE->getElements()[2]);
+    IntegerLiteral *IL3 = dyn_cast<IntegerLiteral>(AE->getElements()[2]);
     EXPECT_NE(IL3, nullptr);
     EXPECT_EQ(IL3->getValue(), 3);
 
-    FieldInitExpr *F2 = dynamic_cast<FieldInitExpr *>(IE->getFields()[1]);
+    FieldInitExpr *F2 = dyn_cast<FieldInitExpr>(IE->getFields()[1]);
     EXPECT_NE(F2, nullptr);
     EXPECT_EQ(F2->getName(), "y");
 
-    IntegerLiteral *IL4 = dynamic_cast<IntegerLiteral *>(F2->getExpr());
+    IntegerLiteral *IL4 = dyn_cast<IntegerLiteral>(F2->getExpr());
     EXPECT_NE(IL4, nullptr);
     EXPECT_EQ(IL4->getValue(), 4);
 
@@ -2463,24 +2497,24 @@ TEST_F(ParseExprTest, Unit_Spec_Basic) {
     EXPECT_EQ(USE->getName(), "Space");
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_NE(RS->getExpr(), nullptr);
 
-    UnitSpecExpr *US = dynamic_cast<UnitSpecExpr *>(RS->getExpr());
+    UnitSpecExpr *US = dyn_cast<UnitSpecExpr>(RS->getExpr());
     EXPECT_NE(US, nullptr);
     EXPECT_EQ(US->getName(), "Space");
     EXPECT_EQ(US->getUse(), USE);
 
-    CallExpr *CE = dynamic_cast<CallExpr *>(US->getExpr());
+    CallExpr *CE = dyn_cast<CallExpr>(US->getExpr());
     EXPECT_NE(CE, nullptr);
     
     delete unit;
@@ -2495,18 +2529,18 @@ TEST_F(ParseExprTest, Rune_Syscall_Expr_Basic) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[0]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[0]);
     EXPECT_NE(ES, nullptr);
 
-    RuneSyscallExpr *SE = dynamic_cast<RuneSyscallExpr *>(ES->getExpr());
+    RuneSyscallExpr *SE = dyn_cast<RuneSyscallExpr>(ES->getExpr());
     EXPECT_NE(SE, nullptr);
     EXPECT_EQ(SE->getSyscallNum(), 5);
     EXPECT_EQ(SE->getArgs().size(), 2);
@@ -2523,25 +2557,25 @@ TEST_F(ParseExprTest, Template_Function_Spec) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 2);
-    FunctionDecl *TFN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *TFN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(TFN, nullptr);
     EXPECT_NE(TFN->getBody(), nullptr);
     EXPECT_EQ(TFN->getNumTemplateParams(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[1]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[1]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
     EXPECT_EQ(FN->getNumTemplateParams(), 0);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_NE(RS->getExpr(), nullptr);
 
-    CallExpr *CE = dynamic_cast<CallExpr *>(RS->getExpr());
+    CallExpr *CE = dyn_cast<CallExpr>(RS->getExpr());
     EXPECT_NE(CE, nullptr);
     EXPECT_EQ(CE->getNumTypeArgs(), 1);
 
@@ -2560,28 +2594,28 @@ TEST_F(ParseExprTest, Template_Struct_Spec) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 2);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[1]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[1]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
     EXPECT_EQ(VD->getType()->getName(), "box<i32>");
     
-    InitExpr *IE = dynamic_cast<InitExpr *>(VD->getInit());
+    InitExpr *IE = dyn_cast<InitExpr>(VD->getInit());
     EXPECT_NE(IE, nullptr);
     EXPECT_EQ(IE->getFields().size(), 1);
 
-    FieldInitExpr *F1 = dynamic_cast<FieldInitExpr *>(IE->getFields()[0]);
+    FieldInitExpr *F1 = dyn_cast<FieldInitExpr>(IE->getFields()[0]);
     EXPECT_NE(F1, nullptr);
     EXPECT_EQ(F1->getName(), "x");
     
@@ -2597,28 +2631,28 @@ TEST_F(ParseExprTest, Used_Template_Function_Spec) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    UnitSpecExpr *US = dynamic_cast<UnitSpecExpr *>(VD->getInit());
+    UnitSpecExpr *US = dyn_cast<UnitSpecExpr>(VD->getInit());
     EXPECT_NE(US, nullptr);
     EXPECT_EQ(US->getName(), "Other");
     EXPECT_EQ(US->getUse(), unit->getUses()[0]);
 
-    CallExpr *CE = dynamic_cast<CallExpr *>(US->getExpr());
+    CallExpr *CE = dyn_cast<CallExpr>(US->getExpr());
     EXPECT_NE(CE, nullptr);
     EXPECT_EQ(CE->getNumTypeArgs(), 1);
     
@@ -2634,24 +2668,24 @@ TEST_F(ParseExprTest, Used_Template_Struct_Spec) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "Other::box<i32>");
     EXPECT_NE(VD->getInit(), nullptr);
 
-    InitExpr *IE = dynamic_cast<InitExpr *>(VD->getInit());
+    InitExpr *IE = dyn_cast<InitExpr>(VD->getInit());
     EXPECT_NE(IE, nullptr);
     EXPECT_EQ(IE->getFields().size(), 1);
 
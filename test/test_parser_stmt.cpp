@@ -25,29 +25,29 @@ TEST_F(ParseStmtTest, If_Only_Then_Compound) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    IfStmt *IS = dynamic_cast<IfStmt *>(CS->getStmts()[0]);
+    IfStmt *IS = dyn_cast<IfStmt>(CS->getStmts()[0]);
     EXPECT_NE(IS, nullptr);
     EXPECT_NE(IS->getCond(), nullptr);
     EXPECT_NE(IS->getThen(), nullptr);
     EXPECT_EQ(IS->getElse(), nullptr);
     
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(IS->getCond());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(IS->getCond());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
 
-    CompoundStmt *CS2 = dynamic_cast<CompoundStmt *>(IS->getThen());
+    CompoundStmt *CS2 = dyn_cast<CompoundStmt>(IS->getThen());
     EXPECT_NE(CS2, nullptr);
     EXPECT_EQ(CS2->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS2->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS2->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
@@ -64,25 +64,25 @@ TEST_F(ParseStmtTest, If_Only_Then) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    IfStmt *IS = dynamic_cast<IfStmt *>(CS->getStmts()[0]);
+    IfStmt *IS = dyn_cast<IfStmt>(CS->getStmts()[0]);
     EXPECT_NE(IS, nullptr);
     EXPECT_NE(IS->getCond(), nullptr);
     EXPECT_NE(IS->getThen(), nullptr);
     EXPECT_EQ(IS->getElse(), nullptr);
     
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(IS->getCond());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(IS->getCond());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(IS->getThen());
+    RetStmt *RS = dyn_cast<RetStmt>(IS->getThen());
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
@@ -99,29 +99,29 @@ TEST_F(ParseStmtTest, If_Then_Else) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    IfStmt *IS = dynamic_cast<IfStmt *>(CS->getStmts()[0]);
+    IfStmt *IS = dyn_cast<IfStmt>(CS->getStmts()[0]);
     EXPECT_NE(IS, nullptr);
     EXPECT_NE(IS->getCond(), nullptr);
     EXPECT_NE(IS->getThen(), nullptr);
     EXPECT_NE(IS->getElse(), nullptr);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(IS->getCond());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(IS->getCond());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(IS->getThen());
+    RetStmt *RS = dyn_cast<RetStmt>(IS->getThen());
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
-    RetStmt *RS2 = dynamic_cast<RetStmt *>(IS->getElse());
+    RetStmt *RS2 = dyn_cast<RetStmt>(IS->getElse());
     EXPECT_NE(RS2, nullptr);
     EXPECT_EQ(RS2->getExpr(), nullptr);
 
@@ -138,37 +138,37 @@ TEST_F(ParseStmtTest, If_Then_Compound_Else_Compound) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    IfStmt *IS = dynamic_cast<IfStmt *>(CS->getStmts()[0]);
+    IfStmt *IS = dyn_cast<IfStmt>(CS->getStmts()[0]);
     EXPECT_NE(IS, nullptr);
     EXPECT_NE(IS->getCond(), nullptr);
     EXPECT_NE(IS->getThen(), nullptr);
     EXPECT_NE(IS->getElse(), nullptr);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(IS->getCond());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(IS->getCond());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
 
-    CompoundStmt *CS2 = dynamic_cast<CompoundStmt *>(IS->getThen());
+    CompoundStmt *CS2 = dyn_cast<CompoundStmt>(IS->getThen());
     EXPECT_NE(CS2, nullptr);
     EXPECT_EQ(CS2->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS2->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS2->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
-    CompoundStmt *CS3 = dynamic_cast<CompoundStmt *>(IS->getElse());
+    CompoundStmt *CS3 = dyn_cast<CompoundStmt>(IS->getElse());
     EXPECT_NE(CS3, nullptr);
     EXPECT_EQ(CS3->getStmts().size(), 1);
 
-    RetStmt *RS2 = dynamic_cast<RetStmt *>(CS3->getStmts()[0]);
+    RetStmt *RS2 = dyn_cast<RetStmt>(CS3->getStmts()[0]);
     EXPECT_NE(RS2, nullptr);
     EXPECT_EQ(RS2->getExpr(), nullptr);
 
@@ -185,28 +185,28 @@ TEST_F(ParseStmtTest, Until_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    UntilStmt *US = dynamic_cast<UntilStmt *>(CS->getStmts()[0]);
+    UntilStmt *US = dyn_cast<UntilStmt>(CS->getStmts()[0]);
     EXPECT_NE(US, nullptr);
     EXPECT_NE(US->getCond(), nullptr);
     EXPECT_NE(US->getBody(), nullptr);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(US->getCond());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(US->getCond());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
 
-    CompoundStmt *CS2 = dynamic_cast<CompoundStmt *>(US->getBody());
+    CompoundStmt *CS2 = dyn_cast<CompoundStmt>(US->getBody());
     EXPECT_NE(CS2, nullptr);
     EXPECT_EQ(CS2->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS2->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS2->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
@@ -222,39 +222,39 @@ TEST_F(ParseStmtTest, Match_One_Case) {
     TranslationUnit *unit = parser.get();
 
     EXPECT_EQ(unit->getDecls().size(), 1);
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    MatchStmt *MS = dynamic_cast<MatchStmt *>(CS->getStmts()[0]);
+    MatchStmt *MS = dyn_cast<MatchStmt>(CS->getStmts()[0]);
     EXPECT_NE(MS, nullptr);
     EXPECT_NE(MS->getPattern(), nullptr);
     EXPECT_NE(MS->getCases().size(), 0);
     EXPECT_EQ(MS->getDefault(), nullptr);
     
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(MS->getPattern());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(MS->getPattern());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
     EXPECT_EQ(MS->getCases().size(), 1);
 
-    CaseStmt *CS1 = dynamic_cast<CaseStmt *>(MS->getCases()[0]);
+    CaseStmt *CS1 = dyn_cast<CaseStmt>(MS->getCases()[0]);
     EXPECT_NE(CS1, nullptr);
     EXPECT_NE(CS1->getPattern(), nullptr);
     EXPECT_NE(CS1->getBody(), nullptr);
 
-    IntegerLiteral *I2 = dynamic_cast<IntegerLiteral *>(CS1->getPattern());
+    IntegerLiteral *I2 = dyn_cast<IntegerLiteral>(CS1->getPattern());
     EXPECT_NE(I2, nullptr);
     EXPECT_EQ(I2->getValue(), 1);
 
-    CompoundStmt *CS2 = dynamic_cast<CompoundStmt *>(CS1->getBody());
+    CompoundStmt *CS2 = dyn_cast<CompoundStmt>(CS1->getBody());
     EXPECT_NE(CS2, nullptr);
     EXPECT_EQ(CS2->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS2->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS2->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
@@ -271,51 +271,51 @@ TEST_F(ParseStmtTest, Match_Two_Cases) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    MatchStmt *MS = dynamic_cast<MatchStmt *>(CS->getStmts()[0]);
+    MatchStmt *MS = dyn_cast<MatchStmt>(CS->getStmts()[0]);
     EXPECT_NE(MS, nullptr);
     EXPECT_NE(MS->getPattern(), nullptr);
     EXPECT_EQ(MS->getCases().size(), 2);
     EXPECT_EQ(MS->getDefault(), nullptr);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(MS->getPattern());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(MS->getPattern());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
 
-    CaseStmt *CS1 = dynamic_cast<CaseStmt *>(MS->getCases()[0]);
+    CaseStmt *CS1 = dyn_cast<CaseStmt>(MS->getCases()[0]);
     EXPECT_NE(CS1, nullptr);
     EXPECT_NE(CS1->getPattern(), nullptr);
     EXPECT_NE(CS1->getBody(), nullptr);
 
-    IntegerLiteral *I2 = dynamic_cast<IntegerLiteral *>(CS1->getPattern());
+    IntegerLiteral *I2 = dyn_cast<IntegerLiteral>(CS1->getPattern());
     EXPECT_NE(I2, nullptr);
     EXPECT_EQ(I2->getValue(), 1);
 
-    CompoundStmt *CS2 = dynamic_cast<CompoundStmt *>(CS1->getBody());
+    CompoundStmt *CS2 = dyn_cast<CompoundStmt>(CS1->getBody());
     EXPECT_NE(CS2, nullptr);
     EXPECT_EQ(CS2->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS2->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS2->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
-    CaseStmt *CS3 = dynamic_cast<CaseStmt *>(MS->getCases()[1]);
+    CaseStmt *CS3 = dyn_cast<CaseStmt>(MS->getCases()[1]);
     EXPECT_NE(CS3, nullptr);
     EXPECT_NE(CS3->getPattern(), nullptr);
     EXPECT_NE(CS3->getBody(), nullptr);
 
-    IntegerLiteral *I3 = dynamic_cast<IntegerLiteral *>(CS3->getPattern());
+    IntegerLiteral *I3 = dyn_cast<IntegerLiteral>(CS3->getPattern());
     EXPECT_NE(I3, nullptr);
     EXPECT_EQ(I3->getValue(), 2);
 
-    RetStmt *RS2 = dynamic_cast<RetStmt *>(CS3->getBody());
+    RetStmt *RS2 = dyn_cast<RetStmt>(CS3->getBody());
     EXPECT_NE(RS2, nullptr);
     EXPECT_EQ(RS2->getExpr(), nullptr);
 
@@ -332,42 +332,42 @@ TEST_F(ParseStmtTest, Match_Case_Default) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    MatchStmt *MS = dynamic_cast<MatchStmt *>(CS->getStmts()[0]);
+    MatchStmt *MS = dyn_cast<MatchStmt>(CS->getStmts()[0]);
     EXPECT_NE(MS, nullptr);
     EXPECT_NE(MS->getPattern(), nullptr);
     EXPECT_EQ(MS->getCases().size(), 1);
     EXPECT_NE(MS->getDefault(), nullptr);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(MS->getPattern());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(MS->getPattern());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
 
-    CaseStmt *CS1 = dynamic_cast<CaseStmt *>(MS->getCases()[0]);
+    CaseStmt *CS1 = dyn_cast<CaseStmt>(MS->getCases()[0]);
     EXPECT_NE(CS1, nullptr);
     EXPECT_NE(CS1->getPattern(), nullptr);
     EXPECT_NE(CS1->getBody(), nullptr);
 
-    IntegerLiteral *I2 = dynamic_cast<IntegerLiteral *>(CS1->getPattern());
+    IntegerLiteral *I2 = dyn_cast<IntegerLiteral>(CS1->getPattern());
     EXPECT_NE(I2, nullptr);
     EXPECT_EQ(I2->getValue(), 1);
 
-    CompoundStmt *CS2 = dynamic_cast<CompoundStmt *>(CS1->getBody());
+    CompoundStmt *CS2 = dyn_cast<CompoundStmt>(CS1->getBody());
     EXPECT_NE(CS2, nullptr);
     EXPECT_EQ(CS2->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS2->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS2->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
-    RetStmt *RS2 = dynamic_cast<RetStmt *>(MS->getDefault());
+    RetStmt *RS2 = dyn_cast<RetStmt>(MS->getDefault());
     EXPECT_NE(RS2, nullptr);
     EXPECT_EQ(RS2->getExpr(), nullptr);
 
@@ -384,59 +384,59 @@ TEST_F(ParseStmtTest, Match_Cases_Default) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    MatchStmt *MS = dynamic_cast<MatchStmt *>(CS->getStmts()[0]);
+    MatchStmt *MS = dyn_cast<MatchStmt>(CS->getStmts()[0]);
     EXPECT_NE(MS, nullptr);
     EXPECT_NE(MS->getPattern(), nullptr);
     EXPECT_EQ(MS->getCases().size(), 2);
     EXPECT_NE(MS->getDefault(), nullptr);
 
-    IntegerLiteral *I = dynamic_cast<IntegerLiteral *>(MS->getPattern());
+    IntegerLiteral *I = dyn_cast<IntegerLiteral>(MS->getPattern());
     EXPECT_NE(I, nullptr);
     EXPECT_EQ(I->getValue(), 1);
 
-    CaseStmt *CS1 = dynamic_cast<CaseStmt *>(MS->getCases()[0]);
+    CaseStmt *CS1 = dyn_cast<CaseStmt>(MS->getCases()[0]);
     EXPECT_NE(CS1, nullptr);
     EXPECT_NE(CS1->getPattern(), nullptr);
     EXPECT_NE(CS1->getBody(), nullptr);
 
-    IntegerLiteral *I2 = dynamic_cast<IntegerLiteral *>(CS1->getPattern());
+    IntegerLiteral *I2 = dyn_cast<IntegerLiteral>(CS1->getPattern());
     EXPECT_NE(I2, nullptr);
     EXPECT_EQ(I2->getValue(), 1);
 
-    CompoundStmt *CS2 = dynamic_cast<CompoundStmt *>(CS1->getBody());
+    CompoundStmt *CS2 = dyn_cast<CompoundStmt>(CS1->getBody());
     EXPECT_NE(CS2, nullptr);
     EXPECT_EQ(CS2->getStmts().size(), 1);
 
-    RetStmt *RS = dynamic_cast<RetStmt *>(CS2->getStmts()[0]);
+    RetStmt *RS = dyn_cast<RetStmt>(CS2->getStmts()[0]);
     EXPECT_NE(RS, nullptr);
     EXPECT_EQ(RS->getExpr(), nullptr);
 
-    CaseStmt *CS3 = dynamic_cast<CaseStmt *>(MS->getCases()[1]);
+    CaseStmt *CS3 = dyn_cast<CaseStmt>(MS->getCases()[1]);
     EXPECT_NE(CS3, nullptr);
     EXPECT_NE(CS3->getPattern(), nullptr);
     EXPECT_NE(CS3->getBody(), nullptr);
 
-    IntegerLiteral *I3 = dynamic_cast<IntegerLiteral *>(CS3->getPattern());
+    IntegerLiteral *I3 = dyn_cast<IntegerLiteral>(CS3->getPattern());
     EXPECT_NE(I3, nullptr);
     EXPECT_EQ(I3->getValue(), 2);
 
-    RetStmt *RS2 = dynamic_cast<RetStmt *>(CS3->getBody());
+    RetStmt *RS2 = dyn_cast<RetStmt>(CS3->getBody());
     EXPECT_NE(RS2, nullptr);
     EXPECT_EQ(RS2->getExpr(), nullptr);
 
-    CompoundStmt *CS4 = dynamic_cast<CompoundStmt *>(MS->getDefault());
+    CompoundStmt *CS4 = dyn_cast<CompoundStmt>(MS->getDefault());
     EXPECT_NE(CS4, nullptr);
     EXPECT_EQ(CS4->getStmts().size(), 1);
 
-    RetStmt *RS3 = dynamic_cast<RetStmt *>(CS4->getStmts()[0]);
+    RetStmt *RS3 = dyn_cast<RetStmt>(CS4->getStmts()[0]);
     EXPECT_NE(RS3, nullptr);
     EXPECT_EQ(RS3->getExpr(), nullptr);
 
@@ -453,27 +453,27 @@ TEST_F(ParseStmtTest, Expr_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 2);
 
-    DeclStmt *DS = dynamic_cast<DeclStmt *>(CS->getStmts()[0]);
+    DeclStmt *DS = dyn_cast<DeclStmt>(CS->getStmts()[0]);
     EXPECT_NE(DS, nullptr);
 
-    VarDecl *VD = dynamic_cast<VarDecl *>(DS->getDecl());
+    VarDecl *VD = dyn_cast<VarDecl>(DS->getDecl());
     EXPECT_NE(VD, nullptr);
     EXPECT_EQ(VD->getName(), "x");
     EXPECT_EQ(VD->getType()->getName(), "i64");
 
-    ExprStmt *ES = dynamic_cast<ExprStmt *>(CS->getStmts()[1]);
+    ExprStmt *ES = dyn_cast<ExprStmt>(CS->getStmts()[1]);
     EXPECT_NE(ES, nullptr);
     EXPECT_NE(ES->getExpr(), nullptr);
 
-    RefExpr *RE = dynamic_cast<RefExpr *>(ES->getExpr());
+    RefExpr *RE = dyn_cast<RefExpr>(ES->getExpr());
     EXPECT_NE(RE, nullptr);
 
     delete unit;
@@ -489,15 +489,15 @@ TEST_F(ParseStmtTest, Break_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    BreakStmt *BS = dynamic_cast<BreakStmt *>(CS->getStmts()[0]);
+    BreakStmt *BS = dyn_cast<BreakStmt>(CS->getStmts()[0]);
     EXPECT_NE(BS, nullptr);
 
     delete unit;
@@ -513,15 +513,15 @@ TEST_F(ParseStmtTest, Continue_Basic) {
 
     EXPECT_EQ(unit->getDecls().size(), 1);
 
-    FunctionDecl *FN = dynamic_cast<FunctionDecl *>(unit->getDecls()[0]);
+    FunctionDecl *FN = dyn_cast<FunctionDecl>(unit->getDecls()[0]);
     EXPECT_NE(FN, nullptr);
     EXPECT_NE(FN->getBody(), nullptr);
 
-    CompoundStmt *CS = dynamic_cast<CompoundStmt *>(FN->getBody());
+    CompoundStmt *CS = dyn_cast<CompoundStmt>(FN->getBody());
     EXPECT_NE(CS, nullptr);
     EXPECT_EQ(CS->getStmts().size(), 1);
 
-    ContinueStmt *BS = dynamic_cast<ContinueStmt *>(CS->getStmts()[0]);
+    ContinueStmt *BS = dyn_cast<ContinueStmt>(CS->getStmts()[0]);
     EXPECT_NE(BS, nullptr);
 
     delete unit;
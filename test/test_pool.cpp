@@ -0,0 +1,91 @@
+#include "../compiler/mir/basicblock.h"
+#include "../compiler/mir/builder.h"
+#include "../compiler/mir/function.h"
+#include "../compiler/mir/pool.h"
+#include "../compiler/mir/segment.h"
+
+#include <gtest/gtest.h>
+#include <string>
+
+namespace mir {
+
+namespace test {
+
+class PoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+
+    }
+
+    void TearDown() override {
+
+    }
+};
+
+struct Counted final {
+    unsigned *counter;
+    std::string name;
+
+    Counted(unsigned *C) : counter(C), name("counted") {}
+
+    ~Counted() { ++*counter; }
+};
+
+TEST_F(PoolTest, Destroy_Recycles_Storage) {
+    unsigned destroyed = 0;
+    Pool pool;
+
+    Counted *first = pool.create<Counted>(&destroyed);
+    pool.create<Counted>(&destroyed);
+    size_t reserved = pool.get_bytes_reserved();
+
+    pool.destroy(first);
+    EXPECT_EQ(destroyed, 1);
+    EXPECT_EQ(pool.get_num_live(), 1);
+
+    // The next object of the same size takes the place of the first.
+    Counted *third = pool.create<Counted>(&destroyed);
+    EXPECT_EQ(third, first);
+    EXPECT_EQ(pool.get_num_recycled(), 1);
+    EXPECT_EQ(pool.get_bytes_reserved(), reserved);
+
+    // Destroyed objects are skipped over when the pool is reset.
+    pool.destroy(third);
+    pool.reset();
+    EXPECT_EQ(destroyed, 3);
+    EXPECT_EQ(pool.get_num_live(), 0);
+    EXPECT_EQ(pool.get_bytes_reserved(), 0);
+}
+
+TEST_F(PoolTest, Segment_Remove_Function) {
+    Segment seg(Target(Arch::X86_64, OS::Linux, ABI::SystemV));
+    Builder builder(&seg);
+
+    size_t baseline = seg.get_pool().get_num_live();
+
+    FunctionType *FT = FunctionType::get(&seg, {}, builder.get_i64_ty());
+    Function *FN = seg.create<Function>("foo", FT, Function::Linkage::Internal,
+        &seg, std::vector<Argument *>());
+    BasicBlock *entry = seg.create<BasicBlock>("entry", FN);
+    builder.set_insert(entry);
+    builder.build_ret(ConstantInt::get(&seg, builder.get_i64_ty(), 7));
+
+    size_t live = seg.get_pool().get_num_live();
+    EXPECT_GT(live, baseline);
+
+    // Removing the function hands back its blocks and instructions, but not
+    // the types and constants it used.
+    FN->detach();
+    EXPECT_EQ(seg.get_function("foo"), nullptr);
+    EXPECT_EQ(seg.get_pool().get_num_live(), live - 3);
+
+    // A new function is built in the storage of the old one.
+    Function *bar = seg.create<Function>("bar", FT, Function::Linkage::Internal,
+        &seg, std::vector<Argument *>());
+    EXPECT_EQ(bar, FN);
+    EXPECT_EQ(seg.get_pool().get_num_recycled(), 1);
+}
+
+} // namespace test
+
+} // namespace mir
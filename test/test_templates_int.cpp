@@ -4,6 +4,7 @@
 #include "../compiler/mir/function.h"
 #include "../compiler/mir/segment.h"
 #include "../compiler/parser/parser.h"
+#include "../compiler/tree/substenv.h"
 #include "../compiler/tree/unitman.h"
 
 #include <fstream>
@@ -22,9 +23,6 @@ protected:
     std::ofstream m_File;
 
     void SetUp() override {
-        mir::clear_bb_dict();
-        mir::clear_inst_dict();
-        
         // create a new file /test.mdl
         m_File = std::ofstream("/test.mdl", std::ios::out | std::ios::trunc);
     }
@@ -126,6 +124,243 @@ foo :: () -> i64 {
     delete seg;
 }
 
+TEST_F(IntegratedTemplateTest, Templated_Struct_Specialized_Streamed) {
+    File file = File("test.mdl", "/", "/test.mdl", TEMPLATE_STRUCT_SPEC);
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+
+    UnitManager units;
+    units.addVirtUnit(unit);
+    units.drive(Options());
+
+    Target target = Target(mir::Arch::X86_64, mir::OS::Linux, 
+                           mir::ABI::SystemV);
+
+    Segment *seg = new Segment(target);
+    CGN cgn = CGN(Options(), unit, seg);
+
+    std::stringstream ss;
+    seg->print(ss);
+
+    String expected = R"(target :: x86_64 linux system_v
+
+box<i32> :: type { i32*, i32 }
+
+foo :: () -> i64 {
+    _x := slot box<i32>, align 8
+
+1:
+    $2 := ap i32**, box<i32>* _x, i64 0
+    $3 := reint void* nil -> i32*
+    str i32* $3 -> i32** $2, align 8
+    $4 := ap i32*, box<i32>* _x, i64 1
+    $5 := trunc i64 1 -> i32
+    str i32 $5 -> i32* $4, align 4
+    $6 := ap i32*, box<i32>* _x, i64 1
+    $7 := load i32* $6, align 4
+    $8 := sext i32 $7 -> i64
+    ret i64 $8
+}
+)";
+    EXPECT_EQ(ss.str(), expected);
+
+    delete seg;
+}
+
+#define TEMPLATE_NESTED_TYPE_REF R"(box<T> { x: T*, y: T } foo :: (b: box<box<i32>*>[4]) -> i64 { ret 0; })"
+TEST_F(IntegratedTemplateTest, Templated_Struct_Nested_Type_Ref) {
+    File file = File("test.mdl", "/", "/test.mdl", TEMPLATE_NESTED_TYPE_REF);
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+
+    UnitManager units;
+    units.addVirtUnit(unit);
+    units.drive(Options());
+
+    FunctionDecl *FD = dyn_cast<FunctionDecl>(unit->getDecls().at(1));
+    ASSERT_NE(FD, nullptr);
+
+    Type *T = FD->getParamType(0);
+    EXPECT_EQ(T->getName(), "box<box<i32>*>[4]");
+    ASSERT_TRUE(T->isArray());
+
+    ArrayType *AT = T->asArray();
+    EXPECT_EQ(AT->getSize(), 4);
+    EXPECT_EQ(AT->getElement()->getName(), "box<box<i32>*>");
+    ASSERT_TRUE(AT->getElement()->isStruct());
+
+    // The outer specialization holds a pointer to the inner one.
+    StructType *outer = AT->getElement()->asStruct();
+    Type *field = outer->getFields().at(1);
+    ASSERT_TRUE(field->isPointer());
+    EXPECT_EQ(field->asPointer()->getPointee()->getName(), "box<i32>");
+}
+
+#define TEMPLATE_UNIQUED_TYPES R"(pair<T> { a: T, b: T } box<T> { p: pair<T>, q: T } foo :: (x: box<i32>*, y: box<i32>*) -> i64 { ret 0; } bar :: (z: box<i32>*, w: box<i32>*) -> i64 { ret 1; })"
+TEST_F(IntegratedTemplateTest, Templated_Struct_Uniqued_Types) {
+    File file = File("test.mdl", "/", "/test.mdl", TEMPLATE_UNIQUED_TYPES);
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+
+    UnitManager units;
+    units.addVirtUnit(unit);
+    units.drive(Options());
+
+    FunctionDecl *foo = dyn_cast<FunctionDecl>(unit->getDecls().at(2));
+    FunctionDecl *bar = dyn_cast<FunctionDecl>(unit->getDecls().at(3));
+    ASSERT_NE(foo, nullptr);
+    ASSERT_NE(bar, nullptr);
+
+    // Structurally equal types are the same instance.
+    EXPECT_EQ(foo->getType(), bar->getType());
+
+    Type *ptr = foo->getType()->getParamType(0);
+    ASSERT_TRUE(ptr->isPointer());
+    EXPECT_EQ(ptr, foo->getType()->getParamType(1));
+    EXPECT_EQ(ptr->asPointer(), PointerType::get(unit->getContext(), 
+        ptr->asPointer()->getPointee()));
+
+    // The dependent `pair<T>` field is specialized along with `box<i32>`.
+    StructType *box = ptr->asPointer()->getPointee()->asStruct();
+    EXPECT_EQ(box->getName(), "box<i32>");
+    ASSERT_TRUE(box->getField(0)->isStruct());
+    EXPECT_EQ(box->getField(0)->getName(), "pair<i32>");
+}
+
+#define TEMPLATE_UNIQUED_DEFERRED R"(foo :: (p: box*, q: i64[2]) -> i64 { ret 0; } box :: { x: i64 } bar :: (r: box*, s: i64[2]) -> i64 { ret 1; })"
+TEST_F(IntegratedTemplateTest, Uniqued_Types_Over_Deferred) {
+    File file = File("test.mdl", "/", "/test.mdl", TEMPLATE_UNIQUED_DEFERRED);
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+
+    UnitManager units;
+    units.addVirtUnit(unit);
+    units.drive(Options());
+
+    FunctionDecl *foo = dyn_cast<FunctionDecl>(unit->getDecls().at(0));
+    StructDecl *box = dyn_cast<StructDecl>(unit->getDecls().at(1));
+    FunctionDecl *bar = dyn_cast<FunctionDecl>(unit->getDecls().at(2));
+    ASSERT_NE(foo, nullptr);
+    ASSERT_NE(box, nullptr);
+    ASSERT_NE(bar, nullptr);
+
+    // Types parsed before `box` is declared end up the same instances as the
+    // ones built from the resolved types.
+    Context *ctx = unit->getContext();
+    Type *ptr = PointerType::get(ctx, box->getDefinedType());
+    Type *arr = ArrayType::get(ctx, ctx->getI64Type(), 2);
+    EXPECT_EQ(foo->getType(), bar->getType());
+    EXPECT_EQ(foo->getType()->getParamType(0), ptr);
+    EXPECT_EQ(foo->getType()->getParamType(1), arr);
+    EXPECT_EQ(foo->getType(), FunctionType::get(ctx, { ptr, arr }, 
+        ctx->getI64Type()));
+}
+
+#define TEMPLATE_SPEC_LOOKUP R"(box<T> { x: T*, y: T } foo :: (a: box<i64[2]>*, b: box<i64[3]>*, c: box<i64*>*) -> i64 { ret 0; })"
+TEST_F(IntegratedTemplateTest, Templated_Struct_Specialization_Lookup) {
+    File file = File("test.mdl", "/", "/test.mdl", TEMPLATE_SPEC_LOOKUP);
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+
+    UnitManager units;
+    units.addVirtUnit(unit);
+    units.drive(Options());
+
+    StructDecl *box = dyn_cast<StructDecl>(unit->getDecls().at(0));
+    ASSERT_NE(box, nullptr);
+
+    // Specializations are found by the structure of their arguments, even
+    // when the arguments are spelled with types of another context.
+    Context other;
+    Type *i64 = other.getI64Type();
+    auto *two = box->findSpecialization({ ArrayType::get(&other, i64, 2) });
+    auto *three = box->findSpecialization({ ArrayType::get(&other, i64, 3) });
+    auto *ptr = box->findSpecialization({ PointerType::get(&other, i64) });
+    ASSERT_NE(two, nullptr);
+    ASSERT_NE(three, nullptr);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_NE(two, three);
+    EXPECT_EQ(two->getName(), "box<i64[2]>");
+    EXPECT_EQ(ptr->getName(), "box<i64*>");
+
+    EXPECT_EQ(box->findSpecialization({ ArrayType::get(&other, i64, 4) }), 
+        nullptr);
+    EXPECT_EQ(box->findSpecialization({ other.getI32Type() }), nullptr);
+    EXPECT_EQ(box->fetchSpecialization({ ArrayType::get(&other, i64, 3) }), 
+        three);
+}
+
+TEST_F(IntegratedTemplateTest, SubstEnv_Nested_Environments) {
+    Context ctx;
+    auto *T = ctx.create<TemplateParamDecl>(&ctx, Runes(), Metadata(), "T", 0);
+    auto *U = ctx.create<TemplateParamDecl>(&ctx, Runes(), Metadata(), "U", 0);
+    auto *TT = cast<TemplateParamType>(T->getDefinedType());
+    auto *UT = cast<TemplateParamType>(U->getDefinedType());
+
+    SubstEnv outer({ { TT, ctx.getI32Type() } });
+    SubstEnv inner({ { UT, ctx.getI64Type() } }, &outer);
+    SubstEnv shadow({ { TT, ctx.getI8Type() } }, &outer);
+
+    // Parameters of enclosing environments are found in the inner ones,
+    // unless an inner environment maps them itself.
+    EXPECT_EQ(inner.substParam(TT), ctx.getI32Type());
+    EXPECT_EQ(inner.substParam(UT), ctx.getI64Type());
+    EXPECT_EQ(shadow.substParam(TT), ctx.getI8Type());
+    EXPECT_EQ(outer.getMapping().size(), 1);
+    EXPECT_EQ(inner.getMapping().size(), 2);
+
+    Type *dep = PointerType::get(&ctx, ArrayType::get(&ctx, TT, 4));
+    Type *conc = inner.substType(&ctx, dep);
+    EXPECT_EQ(conc, PointerType::get(&ctx, 
+        ArrayType::get(&ctx, ctx.getI32Type(), 4)));
+    EXPECT_EQ(inner.substType(&ctx, dep), conc);
+    EXPECT_EQ(shadow.substType(&ctx, dep), PointerType::get(&ctx, 
+        ArrayType::get(&ctx, ctx.getI8Type(), 4)));
+}
+
+#define TEMPLATE_LAZY_SPECS R"(foo<T> :: (x: T) -> T { ret x; } bar<T> :: (x: T) -> i8 { ret foo<i8>(1); } qux<T> :: (x: T) -> i64 { ret foo<i64>(2); } baz :: () -> i64 { ret qux<i32>(3); })"
+TEST_F(IntegratedTemplateTest, Lazy_Specializations) {
+    File file = File("test.mdl", "/", "/test.mdl", TEMPLATE_LAZY_SPECS);
+    Lexer lexer = Lexer(file);
+    Parser parser = Parser(file, lexer);
+    TranslationUnit *unit = parser.get();
+
+    UnitManager units;
+    units.addVirtUnit(unit);
+    units.drive(Options());
+
+    Target target = Target(mir::Arch::X86_64, mir::OS::Linux, 
+                           mir::ABI::SystemV);
+
+    // Every specialization that name resolution created is lowered eagerly,
+    // including `foo<i8>`, which only the unused template `bar` refers to.
+    Segment *eager = new Segment(target);
+    CGN eagerCGN = CGN(Options(), unit, eager);
+    EXPECT_NE(eager->get_function("foo<i8>"), nullptr);
+    EXPECT_NE(eager->get_function("foo<i64>"), nullptr);
+    EXPECT_NE(eager->get_function("qux<i32>"), nullptr);
+
+    // Lazily, only those reachable from `baz` are, and `foo<i64>` is found
+    // through the body of `qux<i32>`.
+    Options opts = Options();
+    opts.LazySpecs = 1;
+    Segment *lazy = new Segment(target);
+    CGN lazyCGN = CGN(opts, unit, lazy);
+    EXPECT_EQ(lazy->get_function("foo<i8>"), nullptr);
+    ASSERT_NE(lazy->get_function("foo<i64>"), nullptr);
+    ASSERT_NE(lazy->get_function("qux<i32>"), nullptr);
+    EXPECT_NE(lazy->get_function("foo<i64>")->head(), nullptr);
+    EXPECT_NE(lazy->get_function("qux<i32>")->head(), nullptr);
+
+    delete eager;
+    delete lazy;
+}
+
 } // namespace test
 
 } // namespace meddle
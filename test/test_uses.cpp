@@ -0,0 +1,124 @@
+#include "../compiler/mir/basicblock.h"
+#include "../compiler/mir/builder.h"
+#include "../compiler/mir/function.h"
+#include "../compiler/mir/inst.h"
+#include "../compiler/mir/segment.h"
+
+#include <gtest/gtest.h>
+
+namespace mir {
+
+namespace test {
+
+class UseTest : public ::testing::Test {
+protected:
+    Segment *m_Segment = nullptr;
+    Builder *m_Builder = nullptr;
+    Function *m_Function = nullptr;
+
+    void SetUp() override {
+        m_Segment = new Segment(Target(Arch::X86_64, OS::Linux, ABI::SystemV));
+        m_Builder = new Builder(m_Segment);
+
+        Type *i64 = m_Builder->get_i64_ty();
+        FunctionType *FT = FunctionType::get(m_Segment, { i64, i64 }, i64);
+        m_Function = m_Segment->create<Function>("test", FT,
+            Function::Linkage::Internal, m_Segment, std::vector<Argument *>());
+        m_Function->set_args({
+            m_Segment->create<Argument>("a", i64, m_Function, 0),
+            m_Segment->create<Argument>("b", i64, m_Function, 1),
+        });
+
+        m_Builder->set_insert(
+            m_Segment->create<BasicBlock>("entry", m_Function));
+    }
+
+    void TearDown() override {
+        delete m_Builder;
+        delete m_Segment;
+    }
+};
+
+TEST_F(UseTest, Operands_Are_Uses) {
+    Argument *a = m_Function->get_arg(0);
+    Argument *b = m_Function->get_arg(1);
+
+    Inst *add = static_cast<Inst *>(m_Builder->build_add(a, b));
+    Inst *mul = static_cast<Inst *>(m_Builder->build_smul(add, a));
+
+    EXPECT_EQ(add->get_num_operands(), 2);
+    EXPECT_EQ(add->get_operand(0), a);
+    EXPECT_EQ(add->get_operand(1), b);
+
+    EXPECT_EQ(a->get_num_uses(), 2);
+    EXPECT_TRUE(a->is_used_by(add));
+    EXPECT_TRUE(a->is_used_by(mul));
+    EXPECT_TRUE(add->has_one_use());
+    EXPECT_EQ(add->use_head()->get_user(), mul);
+
+    add->set_operand(1, a);
+    EXPECT_FALSE(b->is_used());
+    EXPECT_EQ(a->get_num_uses(), 3);
+}
+
+TEST_F(UseTest, Replace_All_Uses_With) {
+    Argument *a = m_Function->get_arg(0);
+    Argument *b = m_Function->get_arg(1);
+
+    Inst *add = static_cast<Inst *>(m_Builder->build_add(a, a));
+    RetInst *ret = m_Builder->build_ret(add);
+
+    a->replace_all_uses_with(b);
+    EXPECT_FALSE(a->is_used());
+    EXPECT_EQ(b->get_num_uses(), 2);
+    EXPECT_EQ(add->get_operand(0), b);
+    EXPECT_EQ(add->get_operand(1), b);
+    EXPECT_EQ(ret->get_value(), add);
+}
+
+TEST_F(UseTest, Erase_From_Parent) {
+    Argument *a = m_Function->get_arg(0);
+    Argument *b = m_Function->get_arg(1);
+    BasicBlock *entry = m_Builder->get_insert();
+
+    Inst *add = static_cast<Inst *>(m_Builder->build_add(a, b));
+    Inst *sub = static_cast<Inst *>(m_Builder->build_sub(add, b));
+    RetInst *ret = m_Builder->build_ret(sub);
+
+    // Fold the subtraction away and erase it.
+    sub->replace_all_uses_with(add);
+    sub->erase_from_parent();
+
+    EXPECT_EQ(entry->head(), add);
+    EXPECT_EQ(add->get_next(), ret);
+    EXPECT_EQ(ret->get_prev(), add);
+    EXPECT_EQ(ret->get_value(), add);
+    EXPECT_EQ(b->get_num_uses(), 1);
+
+    // The next instruction of the same kind reuses the erased one.
+    Inst *recycled = static_cast<Inst *>(m_Builder->build_sub(a, b));
+    EXPECT_EQ(recycled, sub);
+}
+
+TEST_F(UseTest, PHI_Incoming_Grows) {
+    Argument *a = m_Function->get_arg(0);
+    Argument *b = m_Function->get_arg(1);
+    BasicBlock *entry = m_Builder->get_insert();
+
+    PHINode *phi = m_Builder->build_phi(m_Builder->get_i64_ty());
+    for (unsigned i = 0; i != 5; ++i)
+        phi->add_incoming(i % 2 ? b : a, entry);
+
+    EXPECT_EQ(phi->get_num_incoming(), 5);
+    EXPECT_EQ(phi->get_incoming_value(4), a);
+    EXPECT_EQ(phi->get_incoming_block(4), entry);
+    EXPECT_EQ(a->get_num_uses(), 3);
+    EXPECT_EQ(b->get_num_uses(), 2);
+
+    for (Use *U = a->use_head(); U; U = U->get_next())
+        EXPECT_EQ(U->get_user(), phi);
+}
+
+} // namespace test
+
+} // namespace mir